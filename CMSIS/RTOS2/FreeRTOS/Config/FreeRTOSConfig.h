@@ -136,6 +136,22 @@
 //  <i> Default: 0
 #define configQUEUE_REGISTRY_SIZE                 0
 
+//  <q>Use light mutexes
+//  <i> Create non-recursive CMSIS-RTOS2 mutexes as FreeRTOS light mutexes.
+//  <i> Light mutexes are taken and released without entering the kernel when uncontended.
+//  <i> Default: 0
+#define configUSE_LIGHT_MUTEXES                   0
+
+//  <q>Use reader-writer locks
+//  <i> Include the reader-writer lock API (rw_lock.h and osRwLock functions).
+//  <i> Default: 0
+#define configUSE_RW_LOCKS                        0
+
+//  <q>Use broadcast channels
+//  <i> Include the broadcast channel API (broadcast.h and osBroadcast functions).
+//  <i> Default: 0
+#define configUSE_BROADCAST_CHANNELS              0
+
 // <h>Event Recorder Configuration
 // <i> Initialize and setup Event Recorder level filtering.
 // <i> Settings have no effect when Event Recorder is not present.
@@ -3642,11 +3642,20 @@ extern void EvrFreeRTOSHeap_Free (void *pvAddress, uint32_t uiSize);
 /* Heap */
 
 #if (!defined(EVR_FREERTOS_DISABLE) && !defined(traceMALLOC_DISABLE))
-  #define traceMALLOC(pv,x)                           EvrFreeRTOSHeap_Malloc(pv,x)
+  #if (defined(configUSE_ALLOC_TRACE) && (configUSE_ALLOC_TRACE == 1))
+    /* Keep feeding the allocation tracer (see alloc_trace.h) */
+    #define traceMALLOC(pv,x)                         do { EvrFreeRTOSHeap_Malloc(pv,x); vAllocTraceRecordMalloc(pv,x,configALLOC_TRACE_GET_CALLER()); } while(0)
+  #else
+    #define traceMALLOC(pv,x)                         EvrFreeRTOSHeap_Malloc(pv,x)
+  #endif
 #endif
 
 #if (!defined(EVR_FREERTOS_DISABLE) && !defined(traceFREE_DISABLE))
-  #define traceFREE(pv,x)                             EvrFreeRTOSHeap_Free(pv,x)
+  #if (defined(configUSE_ALLOC_TRACE) && (configUSE_ALLOC_TRACE == 1))
+    #define traceFREE(pv,x)                           do { EvrFreeRTOSHeap_Free(pv,x); vAllocTraceRecordFree(pv); } while(0)
+  #else
+    #define traceFREE(pv,x)                           EvrFreeRTOSHeap_Free(pv,x)
+  #endif
 #endif
 
 
@@ -120,6 +120,162 @@
 #define configUSE_OS2_CPU_AFFINITY            configUSE_CORE_AFFINITY
 #endif
 
+/*
+  CMSIS-RTOS2 FreeRTOS specific object attributes.
+  Note: These bits can be set in the attr_bits member of the object attributes
+        structure, in addition to the bits defined by CMSIS-RTOS2.
+*/
+
+/*
+  Message queue attribute (osMessageQueueAttr_t::attr_bits) that creates the queue
+  as a single producer single consumer queue (see xQueueCreateSPSC). Exactly one
+  thread or interrupt may put messages into the queue, and exactly one thread or
+  interrupt may get messages from it. Requires configUSE_SPSC_QUEUES == 1.
+*/
+#define osMessageQueueSPSC                    0x00000001U
+
+/*
+  Message queue attribute (osMessageQueueAttr_t::attr_bits) that creates the queue
+  so threads blocked on it are woken in the order in which they blocked instead of
+  in priority order (see xQueueCreateFIFOWaiters). Blocking takes constant time
+  however many threads are waiting, which suits pools of equal priority workers.
+  Cannot be combined with osMessageQueueSPSC.
+*/
+#define osMessageQueueFIFOWaiters             0x00000002U
+
+/*
+  Mutex attribute (osMutexAttr_t::attr_bits) that creates the mutex with the
+  immediate priority ceiling protocol instead of priority inheritance (see
+  xLightMutexCreateWithCeiling). The ceiling is an osPriority_t value, set with
+  osMutexCeilingPriority(), and must be at least the priority of every thread that
+  acquires the mutex. Cannot be combined with osMutexRecursive.
+  Requires configUSE_LIGHT_MUTEXES == 1.
+*/
+#define osMutexPrioCeiling                    0x00000100U
+#define osMutexCeilingPriority(prio)          (osMutexPrioCeiling | (((uint32_t)(prio) & 0xFFU) << 16))
+
+/*
+  CMSIS-RTOS2 FreeRTOS specific reader-writer lock API (see rw_lock.h).
+  A reader-writer lock is held either by any number of readers or by a single writer.
+  Threads waiting to write are preferred over new readers, and a thread holding the
+  lock for writing inherits the priority of threads waiting to write.
+  Read access can be acquired (with timeout 0) and released from an interrupt.
+  Requires configUSE_RW_LOCKS == 1.
+*/
+#if (configUSE_RW_LOCKS == 1)
+
+#include "cmsis_os2.h"                  // ::CMSIS:RTOS2
+
+/// \details Reader-writer lock ID identifies the reader-writer lock.
+typedef void *osRwLockId_t;
+
+/// Attributes structure for reader-writer lock.
+typedef struct {
+  const char                   *name;   ///< name of the reader-writer lock
+  uint32_t                 attr_bits;   ///< attribute bits (reserved, must be 0)
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+} osRwLockAttr_t;
+
+/// Create and Initialize a Reader-Writer Lock object.
+/// \param[in]     attr          reader-writer lock attributes; NULL: default values.
+/// \return reader-writer lock ID for reference by other functions or NULL in case of error.
+extern osRwLockId_t osRwLockNew (const osRwLockAttr_t *attr);
+
+/// Acquire a Reader-Writer Lock for reading or timeout if it is locked for writing.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRwLockAcquireRead (osRwLockId_t rwlock_id, uint32_t timeout);
+
+/// Acquire a Reader-Writer Lock for writing or timeout if it is locked.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRwLockAcquireWrite (osRwLockId_t rwlock_id, uint32_t timeout);
+
+/// Release a Reader-Writer Lock that was acquired by \ref osRwLockAcquireRead or \ref osRwLockAcquireWrite.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRwLockRelease (osRwLockId_t rwlock_id);
+
+/// Delete a Reader-Writer Lock object.
+/// \param[in]     rwlock_id     reader-writer lock ID obtained by \ref osRwLockNew.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osRwLockDelete (osRwLockId_t rwlock_id);
+
+#endif /* (configUSE_RW_LOCKS == 1) */
+
+/*
+  CMSIS-RTOS2 FreeRTOS specific broadcast channel API (see broadcast.h).
+  A broadcast channel delivers every message put into it to every subscriber from
+  a single ring buffer. Each subscriber keeps its own read position in an
+  osBroadcastSubscriber_t variable it owns, so there is no limit on the number of
+  subscribers. Putting never blocks: when the channel is full the oldest message
+  is overwritten, and a subscriber that fell behind is told how many messages it
+  lost. Messages can be put into and got from the channel from an interrupt.
+  Requires configUSE_BROADCAST_CHANNELS == 1.
+*/
+#if (configUSE_BROADCAST_CHANNELS == 1)
+
+#include "cmsis_os2.h"                  // ::CMSIS:RTOS2
+#include "broadcast.h"                  // ARM.FreeRTOS::RTOS:Core
+
+/// \details Broadcast channel ID identifies the broadcast channel.
+typedef void *osBroadcastId_t;
+
+/// Read position of one subscriber to a broadcast channel.
+typedef BroadcastSubscriber_t osBroadcastSubscriber_t;
+
+/// Attributes structure for broadcast channel.
+typedef struct {
+  const char                   *name;   ///< name of the broadcast channel
+  uint32_t                 attr_bits;   ///< attribute bits (reserved, must be 0)
+  void                      *cb_mem;    ///< memory for control block
+  uint32_t                   cb_size;   ///< size of provided memory for control block
+  void                      *mq_mem;    ///< memory for data storage
+  uint32_t                   mq_size;   ///< size of provided memory for data storage
+} osBroadcastAttr_t;
+
+/// Create and Initialize a Broadcast Channel object.
+/// \param[in]     msg_count     maximum number of messages held by the channel.
+/// \param[in]     msg_size      maximum message size in bytes.
+/// \param[in]     attr          broadcast channel attributes; NULL: default values.
+/// \return broadcast channel ID for reference by other functions or NULL in case of error.
+extern osBroadcastId_t osBroadcastNew (uint32_t msg_count, uint32_t msg_size, const osBroadcastAttr_t *attr);
+
+/// Put a Message into a Broadcast Channel, overwriting the oldest message if the channel is full.
+/// \param[in]     bc_id         broadcast channel ID obtained by \ref osBroadcastNew.
+/// \param[in]     msg_ptr       pointer to buffer with message to put into the channel.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osBroadcastPut (osBroadcastId_t bc_id, const void *msg_ptr);
+
+/// Subscribe to a Broadcast Channel, receiving the messages put after this call.
+/// \param[in]     bc_id         broadcast channel ID obtained by \ref osBroadcastNew.
+/// \param[out]    subscriber    pointer to the read position of the subscriber.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osBroadcastSubscribe (osBroadcastId_t bc_id, osBroadcastSubscriber_t *subscriber);
+
+/// Get the next unread Message from a Broadcast Channel or timeout if there is none.
+/// \param[in]     subscriber    pointer to the read position set up by \ref osBroadcastSubscribe.
+/// \param[out]    msg_ptr       pointer to buffer for message to get from the channel.
+/// \param[out]    lost          pointer to buffer for number of messages overwritten before they were read or NULL.
+/// \param[in]     timeout       \ref CMSIS_RTOS_TimeOutValue or 0 in case of no time-out.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osBroadcastGet (osBroadcastSubscriber_t *subscriber, void *msg_ptr, uint32_t *lost, uint32_t timeout);
+
+/// Get number of unread Messages in a Broadcast Channel for a subscriber.
+/// \param[in]     subscriber    pointer to the read position set up by \ref osBroadcastSubscribe.
+/// \return number of unread messages.
+extern uint32_t osBroadcastGetCount (const osBroadcastSubscriber_t *subscriber);
+
+/// Delete a Broadcast Channel object.
+/// \param[in]     bc_id         broadcast channel ID obtained by \ref osBroadcastNew.
+/// \return status code that indicates the execution status of the function.
+extern osStatus_t osBroadcastDelete (osBroadcastId_t bc_id);
+
+#endif /* (configUSE_BROADCAST_CHANNELS == 1) */
+
 /*
   CMSIS-RTOS2 FreeRTOS configuration check (FreeRTOSConfig.h).
 
@@ -30,6 +30,9 @@
 #include "task.h"                       // ARM.FreeRTOS::RTOS:Core
 #include "event_groups.h"               // ARM.FreeRTOS::RTOS:Event Groups
 #include "semphr.h"                     // ARM.FreeRTOS::RTOS:Core
+#include "light_mutex.h"                // ARM.FreeRTOS::RTOS:Core
+#include "rw_lock.h"                    // ARM.FreeRTOS::RTOS:Core
+#include "broadcast.h"                  // ARM.FreeRTOS::RTOS:Core
 #include "timers.h"                     // ARM.FreeRTOS::RTOS:Timers
 
 #include "freertos_mpool.h"             // osMemoryPool definitions
@@ -1729,12 +1732,21 @@ osStatus_t osEventFlagsDelete (osEventFlagsId_t ef_id) {
   Limitations:
   - Priority inherit protocol is used by default, osMutexPrioInherit attribute is ignored.
   - Robust mutex is not supported, NULL is returned if used.
+  - When configUSE_LIGHT_MUTEXES is 1, non-recursive mutexes are created as FreeRTOS
+    light mutexes and are not added to the Queue Registry.
+  - Priority ceiling mutex (osMutexPrioCeiling) requires configUSE_LIGHT_MUTEXES == 1
+    and cannot be recursive, NULL is returned otherwise.
 */
 osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
   SemaphoreHandle_t hMutex;
   uint32_t type;
   uint32_t rmtx;
   int32_t  mem;
+  uint32_t cb_size;
+  #if (configUSE_LIGHT_MUTEXES == 1)
+  UBaseType_t ceil;
+  uint32_t prio;
+  #endif
 
   hMutex = NULL;
 
@@ -1751,11 +1763,21 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
       rmtx = 0U;
     }
 
+    #if (configUSE_LIGHT_MUTEXES == 1)
+    if (rmtx == 0U) {
+      cb_size = sizeof(StaticLightMutex_t);
+    } else {
+      cb_size = sizeof(StaticSemaphore_t);
+    }
+    #else
+    cb_size = sizeof(StaticSemaphore_t);
+    #endif
+
     if ((type & osMutexRobust) != osMutexRobust) {
       mem = -1;
 
       if (attr != NULL) {
-        if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticSemaphore_t))) {
+        if ((attr->cb_mem != NULL) && (attr->cb_size >= cb_size)) {
           /* The memory for control block is provided, use static object */
           mem = 1;
         }
@@ -1770,6 +1792,26 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
         mem = 0;
       }
 
+      #if (configUSE_LIGHT_MUTEXES == 1)
+      ceil = lightmutexNO_PRIORITY_CEILING;
+      #endif
+
+      if ((type & osMutexPrioCeiling) == osMutexPrioCeiling) {
+        #if (configUSE_LIGHT_MUTEXES == 1)
+          prio = (type >> 16) & 0xFFU;
+
+          if ((rmtx != 0U) || (prio < (uint32_t)osPriorityIdle) || (prio > (uint32_t)osPriorityISR) || ((prio - 1U) >= (uint32_t)configMAX_PRIORITIES)) {
+            /* Recursive mutex or ceiling out of range */
+            mem = -1;
+          } else {
+            ceil = (UBaseType_t)(prio - 1U);
+          }
+        #else
+          /* Priority ceiling mutexes are not enabled */
+          mem = -1;
+        #endif
+      }
+
       if (mem == 1) {
         #if (configSUPPORT_STATIC_ALLOCATION == 1)
           if (rmtx != 0U) {
@@ -1778,7 +1820,11 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
             #endif
           }
           else {
+            #if (configUSE_LIGHT_MUTEXES == 1)
+            hMutex = (SemaphoreHandle_t)xLightMutexGenericCreateStatic (ceil, attr->cb_mem);
+            #else
             hMutex = xSemaphoreCreateMutexStatic (attr->cb_mem);
+            #endif
           }
         #endif
       }
@@ -1790,14 +1836,22 @@ osMutexId_t osMutexNew (const osMutexAttr_t *attr) {
               hMutex = xSemaphoreCreateRecursiveMutex ();
               #endif
             } else {
+              #if (configUSE_LIGHT_MUTEXES == 1)
+              hMutex = (SemaphoreHandle_t)xLightMutexGenericCreate (ceil);
+              #else
               hMutex = xSemaphoreCreateMutex ();
+              #endif
             }
           #endif
         }
       }
 
       #if (configQUEUE_REGISTRY_SIZE > 0)
+      #if (configUSE_LIGHT_MUTEXES == 1)
+      if ((hMutex != NULL) && (rmtx != 0U)) {
+      #else
       if (hMutex != NULL) {
+      #endif
         if ((attr != NULL) && (attr->name != NULL)) {
           /* Only non-NULL name objects are added to the Queue Registry */
           vQueueAddToRegistry (hMutex, attr->name);
@@ -1850,7 +1904,11 @@ osStatus_t osMutexAcquire (osMutexId_t mutex_id, uint32_t timeout) {
       #endif
     }
     else {
+      #if (configUSE_LIGHT_MUTEXES == 1)
+      if (xLightMutexTake ((LightMutexHandle_t)hMutex, timeout) != pdPASS) {
+      #else
       if (xSemaphoreTake (hMutex, timeout) != pdPASS) {
+      #endif
         if (timeout != 0U) {
           stat = osErrorTimeout;
         } else {
@@ -1894,7 +1952,11 @@ osStatus_t osMutexRelease (osMutexId_t mutex_id) {
       #endif
     }
     else {
+      #if (configUSE_LIGHT_MUTEXES == 1)
+      if (xLightMutexGive ((LightMutexHandle_t)hMutex) != pdPASS) {
+      #else
       if (xSemaphoreGive (hMutex) != pdPASS) {
+      #endif
         stat = osErrorResource;
       }
     }
@@ -1916,7 +1978,15 @@ osThreadId_t osMutexGetOwner (osMutexId_t mutex_id) {
   if ((IRQ_Context() != 0U) || (hMutex == NULL)) {
     owner = NULL;
   } else {
+    #if (configUSE_LIGHT_MUTEXES == 1)
+    if (((uint32_t)mutex_id & 1U) == 0U) {
+      owner = (osThreadId_t)xLightMutexGetHolder ((LightMutexHandle_t)hMutex);
+    } else {
+      owner = (osThreadId_t)xSemaphoreGetMutexHolder (hMutex);
+    }
+    #else
     owner = (osThreadId_t)xSemaphoreGetMutexHolder (hMutex);
+    #endif
   }
 
   /* Return owner thread ID */
@@ -1941,11 +2011,23 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id) {
     stat = osErrorParameter;
   }
   else {
+    stat = osOK;
+
+    #if (configUSE_LIGHT_MUTEXES == 1)
+    if (((uint32_t)mutex_id & 1U) == 0U) {
+      vLightMutexDelete ((LightMutexHandle_t)hMutex);
+    } else {
+      #if (configQUEUE_REGISTRY_SIZE > 0)
+      vQueueUnregisterQueue (hMutex);
+      #endif
+      vSemaphoreDelete (hMutex);
+    }
+    #else
     #if (configQUEUE_REGISTRY_SIZE > 0)
     vQueueUnregisterQueue (hMutex);
     #endif
-    stat = osOK;
     vSemaphoreDelete (hMutex);
+    #endif
   }
 #else
   (void)mutex_id;
@@ -1958,6 +2040,397 @@ osStatus_t osMutexDelete (osMutexId_t mutex_id) {
 #endif /* (configUSE_OS2_MUTEX == 1) */
 
 
+/* ==== Reader-Writer Lock Management Functions ==== */
+
+#if (configUSE_RW_LOCKS == 1)
+/*
+  Create and Initialize a Reader-Writer Lock object.
+
+  Limitations:
+  - Reader-writer locks are not added to the Queue Registry, the name is ignored.
+*/
+osRwLockId_t osRwLockNew (const osRwLockAttr_t *attr) {
+  RWLockHandle_t hLock;
+  int32_t mem;
+
+  hLock = NULL;
+
+  if (IRQ_Context() == 0U) {
+    mem = -1;
+
+    if (attr != NULL) {
+      if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticRWLock_t))) {
+        /* The memory for control block is provided, use static object */
+        mem = 1;
+      }
+      else {
+        if ((attr->cb_mem == NULL) && (attr->cb_size == 0U)) {
+          /* Control block will be allocated from the dynamic pool */
+          mem = 0;
+        }
+      }
+    }
+    else {
+      mem = 0;
+    }
+
+    if (mem == 1) {
+      #if (configSUPPORT_STATIC_ALLOCATION == 1)
+        hLock = xRWLockCreateStatic (attr->cb_mem);
+      #endif
+    }
+    else {
+      if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+          hLock = xRWLockCreate ();
+        #endif
+      }
+    }
+  }
+
+  /* Return reader-writer lock ID */
+  return ((osRwLockId_t)hLock);
+}
+
+/*
+  Acquire a Reader-Writer Lock for reading or timeout if it is locked for writing.
+
+  Limitations:
+  - When called from an interrupt the timeout must be 0.
+*/
+osStatus_t osRwLockAcquireRead (osRwLockId_t rwlock_id, uint32_t timeout) {
+  RWLockHandle_t hLock = (RWLockHandle_t)rwlock_id;
+  osStatus_t stat;
+
+  stat = osOK;
+
+  if (hLock == NULL) {
+    stat = osErrorParameter;
+  }
+  else if (IRQ_Context() != 0U) {
+    if (timeout != 0U) {
+      stat = osErrorParameter;
+    }
+    else {
+      if (xRWLockAcquireReadFromISR (hLock) != pdPASS) {
+        stat = osErrorResource;
+      }
+    }
+  }
+  else {
+    if (xRWLockAcquireRead (hLock, timeout) != pdPASS) {
+      if (timeout != 0U) {
+        stat = osErrorTimeout;
+      } else {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Acquire a Reader-Writer Lock for writing or timeout if it is locked.
+*/
+osStatus_t osRwLockAcquireWrite (osRwLockId_t rwlock_id, uint32_t timeout) {
+  RWLockHandle_t hLock = (RWLockHandle_t)rwlock_id;
+  osStatus_t stat;
+
+  stat = osOK;
+
+  if (IRQ_Context() != 0U) {
+    stat = osErrorISR;
+  }
+  else if (hLock == NULL) {
+    stat = osErrorParameter;
+  }
+  else {
+    if (xRWLockAcquireWrite (hLock, timeout) != pdPASS) {
+      if (timeout != 0U) {
+        stat = osErrorTimeout;
+      } else {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Release a Reader-Writer Lock that was acquired by osRwLockAcquireRead or osRwLockAcquireWrite.
+*/
+osStatus_t osRwLockRelease (osRwLockId_t rwlock_id) {
+  RWLockHandle_t hLock = (RWLockHandle_t)rwlock_id;
+  osStatus_t stat;
+  BaseType_t yield;
+
+  stat = osOK;
+
+  if (hLock == NULL) {
+    stat = osErrorParameter;
+  }
+  else if (IRQ_Context() != 0U) {
+    yield = pdFALSE;
+
+    if (xRWLockReleaseReadFromISR (hLock, &yield) != pdPASS) {
+      stat = osErrorResource;
+    } else {
+      portYIELD_FROM_ISR (yield);
+    }
+  }
+  else {
+    if (xRWLockGetWriter (hLock) == xTaskGetCurrentTaskHandle()) {
+      if (xRWLockReleaseWrite (hLock) != pdPASS) {
+        stat = osErrorResource;
+      }
+    }
+    else {
+      if (xRWLockReleaseRead (hLock) != pdPASS) {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Delete a Reader-Writer Lock object.
+*/
+osStatus_t osRwLockDelete (osRwLockId_t rwlock_id) {
+  osStatus_t stat;
+
+#ifndef USE_FreeRTOS_HEAP_1
+  RWLockHandle_t hLock = (RWLockHandle_t)rwlock_id;
+
+  if (IRQ_Context() != 0U) {
+    stat = osErrorISR;
+  }
+  else if (hLock == NULL) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat = osOK;
+
+    vRWLockDelete (hLock);
+  }
+#else
+  (void)rwlock_id;
+  stat = osError;
+#endif
+
+  /* Return execution status */
+  return (stat);
+}
+#endif /* (configUSE_RW_LOCKS == 1) */
+
+
+/* ==== Broadcast Channel Management Functions ==== */
+
+#if (configUSE_BROADCAST_CHANNELS == 1)
+/*
+  Create and Initialize a Broadcast Channel object.
+
+  Limitations:
+  - The memory for control block and and message data must be provided in the
+    osBroadcastAttr_t structure in order to allocate object statically.
+  - Broadcast channels are not added to the Queue Registry, the name is ignored.
+*/
+osBroadcastId_t osBroadcastNew (uint32_t msg_count, uint32_t msg_size, const osBroadcastAttr_t *attr) {
+  BroadcastHandle_t hChannel;
+  int32_t mem;
+
+  hChannel = NULL;
+
+  if ((IRQ_Context() == 0U) && (msg_count > 0U) && (msg_size > 0U)) {
+    mem = -1;
+
+    if (attr != NULL) {
+      if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticBroadcast_t)) &&
+          (attr->mq_mem != NULL) && (attr->mq_size >= (msg_count * msg_size))) {
+        /* The memory for control block and message data is provided, use static object */
+        mem = 1;
+      }
+      else {
+        if ((attr->cb_mem == NULL) && (attr->cb_size == 0U) &&
+            (attr->mq_mem == NULL) && (attr->mq_size == 0U)) {
+          /* Control block will be allocated from the dynamic pool */
+          mem = 0;
+        }
+      }
+    }
+    else {
+      mem = 0;
+    }
+
+    if (mem == 1) {
+      #if (configSUPPORT_STATIC_ALLOCATION == 1)
+        hChannel = xBroadcastCreateStatic (msg_count, msg_size, attr->mq_mem, attr->cb_mem);
+      #endif
+    }
+    else {
+      if (mem == 0) {
+        #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
+          hChannel = xBroadcastCreate (msg_count, msg_size);
+        #endif
+      }
+    }
+  }
+
+  /* Return broadcast channel ID */
+  return ((osBroadcastId_t)hChannel);
+}
+
+/*
+  Put a Message into a Broadcast Channel, overwriting the oldest message if the channel is full.
+*/
+osStatus_t osBroadcastPut (osBroadcastId_t bc_id, const void *msg_ptr) {
+  BroadcastHandle_t hChannel = (BroadcastHandle_t)bc_id;
+  osStatus_t stat;
+  BaseType_t yield;
+
+  stat = osOK;
+
+  if ((hChannel == NULL) || (msg_ptr == NULL)) {
+    stat = osErrorParameter;
+  }
+  else if (IRQ_Context() != 0U) {
+    yield = pdFALSE;
+
+    vBroadcastPublishFromISR (hChannel, msg_ptr, &yield);
+    portYIELD_FROM_ISR (yield);
+  }
+  else {
+    vBroadcastPublish (hChannel, msg_ptr);
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Subscribe to a Broadcast Channel, receiving the messages put after this call.
+*/
+osStatus_t osBroadcastSubscribe (osBroadcastId_t bc_id, osBroadcastSubscriber_t *subscriber) {
+  BroadcastHandle_t hChannel = (BroadcastHandle_t)bc_id;
+  osStatus_t stat;
+
+  if (IRQ_Context() != 0U) {
+    stat = osErrorISR;
+  }
+  else if ((hChannel == NULL) || (subscriber == NULL)) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat = osOK;
+
+    vBroadcastSubscribe (hChannel, subscriber);
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Get the next unread Message from a Broadcast Channel or timeout if there is none.
+
+  Limitations:
+  - When called from an interrupt the timeout must be 0.
+*/
+osStatus_t osBroadcastGet (osBroadcastSubscriber_t *subscriber, void *msg_ptr, uint32_t *lost, uint32_t timeout) {
+  osStatus_t stat;
+  UBaseType_t items_lost;
+  BaseType_t rval;
+
+  stat = osOK;
+  items_lost = 0U;
+
+  if ((subscriber == NULL) || (subscriber->xChannel == NULL) || (msg_ptr == NULL)) {
+    stat = osErrorParameter;
+  }
+  else if (IRQ_Context() != 0U) {
+    if (timeout != 0U) {
+      stat = osErrorParameter;
+    }
+    else {
+      if (xBroadcastReceiveFromISR (subscriber, msg_ptr, &items_lost) != pdPASS) {
+        stat = osErrorResource;
+      }
+    }
+  }
+  else {
+    rval = xBroadcastReceive (subscriber, msg_ptr, &items_lost, (TickType_t)timeout);
+
+    if (rval != pdPASS) {
+      if (timeout != 0U) {
+        stat = osErrorTimeout;
+      } else {
+        stat = osErrorResource;
+      }
+    }
+  }
+
+  if (lost != NULL) {
+    *lost = (uint32_t)items_lost;
+  }
+
+  /* Return execution status */
+  return (stat);
+}
+
+/*
+  Get number of unread Messages in a Broadcast Channel for a subscriber.
+*/
+uint32_t osBroadcastGetCount (const osBroadcastSubscriber_t *subscriber) {
+  uint32_t count;
+
+  if ((subscriber == NULL) || (subscriber->xChannel == NULL)) {
+    count = 0U;
+  }
+  else {
+    count = (uint32_t)uxBroadcastItemsWaiting (subscriber);
+  }
+
+  /* Return number of unread messages */
+  return (count);
+}
+
+/*
+  Delete a Broadcast Channel object.
+*/
+osStatus_t osBroadcastDelete (osBroadcastId_t bc_id) {
+  osStatus_t stat;
+
+#ifndef USE_FreeRTOS_HEAP_1
+  BroadcastHandle_t hChannel = (BroadcastHandle_t)bc_id;
+
+  if (IRQ_Context() != 0U) {
+    stat = osErrorISR;
+  }
+  else if (hChannel == NULL) {
+    stat = osErrorParameter;
+  }
+  else {
+    stat = osOK;
+
+    vBroadcastDelete (hChannel);
+  }
+#else
+  (void)bc_id;
+  stat = osError;
+#endif
+
+  /* Return execution status */
+  return (stat);
+}
+#endif /* (configUSE_BROADCAST_CHANNELS == 1) */
+
+
 /* ==== Semaphore Management Functions ==== */
 
 /*
@@ -2173,12 +2646,14 @@ osStatus_t osSemaphoreDelete (osSemaphoreId_t semaphore_id) {
 */
 osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, const osMessageQueueAttr_t *attr) {
   QueueHandle_t hQueue;
+  uint8_t type;
   int32_t mem;
 
   hQueue = NULL;
 
   if ((IRQ_Context() == 0U) && (msg_count > 0U) && (msg_size > 0U)) {
     mem = -1;
+    type = queueQUEUE_TYPE_BASE;
 
     if (attr != NULL) {
       if ((attr->cb_mem != NULL) && (attr->cb_size >= sizeof(StaticQueue_t)) &&
@@ -2198,15 +2673,33 @@ osMessageQueueId_t osMessageQueueNew (uint32_t msg_count, uint32_t msg_size, con
       mem = 0;
     }
 
+    if ((attr != NULL) && ((attr->attr_bits & osMessageQueueSPSC) == osMessageQueueSPSC)) {
+      #if (configUSE_SPSC_QUEUES == 1)
+        type = queueQUEUE_TYPE_SPSC;
+      #else
+        /* Single producer single consumer queues are not enabled */
+        mem = -1;
+      #endif
+    }
+
+    if ((attr != NULL) && ((attr->attr_bits & osMessageQueueFIFOWaiters) == osMessageQueueFIFOWaiters)) {
+      if (type == queueQUEUE_TYPE_BASE) {
+        type = queueQUEUE_TYPE_FIFO_WAITERS;
+      } else {
+        /* Waiter order does not apply to single producer single consumer queues */
+        mem = -1;
+      }
+    }
+
     if (mem == 1) {
       #if (configSUPPORT_STATIC_ALLOCATION == 1)
-        hQueue = xQueueCreateStatic (msg_count, msg_size, attr->mq_mem, attr->cb_mem);
+        hQueue = xQueueGenericCreateStatic (msg_count, msg_size, attr->mq_mem, attr->cb_mem, type);
       #endif
     }
     else {
       if (mem == 0) {
         #if (configSUPPORT_DYNAMIC_ALLOCATION == 1)
-          hQueue = xQueueCreate (msg_count, msg_size);
+          hQueue = xQueueGenericCreate (msg_count, msg_size, type);
         #endif
       }
     }
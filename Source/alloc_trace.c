@@ -0,0 +1,458 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers.  That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "alloc_trace.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* Set configUSE_STATS_FORMATTING_FUNCTIONS to 2 to include the report
+ * formatting function but without including stdio.h here. */
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS == 1 )
+    #include <stdio.h>
+#endif
+
+/* This entire source file will be skipped if the application is not configured
+ * to include the allocation tracer.  This #if is closed at the very bottom of
+ * this file.  If you want to include the allocation tracer then ensure
+ * configUSE_ALLOC_TRACE is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_ALLOC_TRACE == 1 )
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 in FreeRTOSConfig.h to use the allocation tracer.
+    #endif
+
+    #if ( INCLUDE_xTaskGetSchedulerState != 1 )
+        #error INCLUDE_xTaskGetSchedulerState must be set to 1 in FreeRTOSConfig.h to use the allocation tracer.
+    #endif
+
+    #if ( configALLOC_TRACE_MAX_RECORDS < 1 )
+        #error configALLOC_TRACE_MAX_RECORDS must be at least 1
+    #endif
+
+/* Returns the index of the slot in which a record for pvAddress is placed if
+ * there are no collisions.  The low bits of heap addresses are always zero so
+ * are discarded before the address is hashed. */
+    #define allocHOME_SLOT( pvAddress )    ( ( UBaseType_t ) ( ( ( ( size_t ) ( pvAddress ) ) / ( size_t ) portBYTE_ALIGNMENT ) % ( size_t ) configALLOC_TRACE_MAX_RECORDS ) )
+
+/* Returns the slot that follows uxSlot, wrapping at the end of the table. */
+    #define allocNEXT_SLOT( uxSlot )       ( ( ( uxSlot ) + 1U ) % ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS )
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the slot that holds the record for pvAddress, or
+ * configALLOC_TRACE_MAX_RECORDS if pvAddress is not recorded.
+ */
+    static UBaseType_t prvFindRecord( const void * pvAddress ) PRIVILEGED_FUNCTION;
+
+/*
+ * Empties the slot at uxSlot, then moves any records that follow it in the
+ * same probe sequence back so every record remains reachable from its home
+ * slot without needing deleted markers.
+ */
+    static void prvRemoveRecord( UBaseType_t uxSlot ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+/* Open addressed hash table of the live allocations, indexed by address.  A
+ * slot is empty when its pvAddress member is NULL. */
+    PRIVILEGED_DATA static AllocTraceRecord_t xAllocTraceRecords[ configALLOC_TRACE_MAX_RECORDS ];
+
+/* The number of occupied slots in xAllocTraceRecords. */
+    PRIVILEGED_DATA static UBaseType_t uxAllocTraceRecordCount = ( UBaseType_t ) 0U;
+
+/* The number of allocations that were not recorded because the table was full. */
+    PRIVILEGED_DATA static UBaseType_t uxAllocTraceDroppedCount = ( UBaseType_t ) 0U;
+
+/*-----------------------------------------------------------*/
+
+    void vAllocTraceRecordMalloc( void * pvAddress,
+                                  size_t xSize,
+                                  void * pvCaller ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxSlot;
+        AllocTraceRecord_t * pxRecord;
+
+        /* Failed allocations are not recorded. */
+        if( pvAddress != NULL )
+        {
+            if( uxAllocTraceRecordCount < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS )
+            {
+                uxSlot = allocHOME_SLOT( pvAddress );
+
+                while( xAllocTraceRecords[ uxSlot ].pvAddress != NULL )
+                {
+                    uxSlot = allocNEXT_SLOT( uxSlot );
+                }
+
+                pxRecord = &( xAllocTraceRecords[ uxSlot ] );
+                pxRecord->pvAddress = pvAddress;
+                pxRecord->pvCaller = pvCaller;
+                pxRecord->xSize = xSize;
+                pxRecord->xTimeStamp = xTaskGetTickCount();
+
+                /* Before the scheduler has started the current task handle
+                 * does not identify the task making the allocation. */
+                if( xTaskGetSchedulerState() != taskSCHEDULER_NOT_STARTED )
+                {
+                    pxRecord->xTask = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    pxRecord->xTask = NULL;
+                }
+
+                uxAllocTraceRecordCount++;
+            }
+            else
+            {
+                uxAllocTraceDroppedCount++;
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vAllocTraceRecordFree( void * pvAddress ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxSlot;
+
+        uxSlot = prvFindRecord( pvAddress );
+
+        /* The block will not be found if it was allocated while the table was
+         * full. */
+        if( uxSlot < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS )
+        {
+            prvRemoveRecord( uxSlot );
+            uxAllocTraceRecordCount--;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvFindRecord( const void * pvAddress ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxSlot, uxProbes;
+        UBaseType_t uxReturn = ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS;
+
+        if( pvAddress != NULL )
+        {
+            uxSlot = allocHOME_SLOT( pvAddress );
+
+            for( uxProbes = 0; uxProbes < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS; uxProbes++ )
+            {
+                if( xAllocTraceRecords[ uxSlot ].pvAddress == pvAddress )
+                {
+                    uxReturn = uxSlot;
+                    break;
+                }
+                else if( xAllocTraceRecords[ uxSlot ].pvAddress == NULL )
+                {
+                    /* The end of the probe sequence was reached. */
+                    break;
+                }
+                else
+                {
+                    uxSlot = allocNEXT_SLOT( uxSlot );
+                }
+            }
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRemoveRecord( UBaseType_t uxSlot ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxEmptySlot = uxSlot;
+        UBaseType_t uxHomeSlot, uxProbes;
+        BaseType_t xCanMove;
+
+        /* The probe sequence ends at the next empty slot, or after visiting
+         * every other slot if the table is full. */
+        for( uxProbes = 1; uxProbes < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS; uxProbes++ )
+        {
+            uxSlot = allocNEXT_SLOT( uxSlot );
+
+            if( xAllocTraceRecords[ uxSlot ].pvAddress == NULL )
+            {
+                break;
+            }
+
+            /* The record in uxSlot can only be moved back into uxEmptySlot if
+             * its home slot does not lie cyclically between the two, otherwise
+             * it would end up in front of its home slot. */
+            uxHomeSlot = allocHOME_SLOT( xAllocTraceRecords[ uxSlot ].pvAddress );
+
+            if( uxEmptySlot <= uxSlot )
+            {
+                xCanMove = ( ( uxHomeSlot <= uxEmptySlot ) || ( uxHomeSlot > uxSlot ) ) ? pdTRUE : pdFALSE;
+            }
+            else
+            {
+                xCanMove = ( ( uxHomeSlot <= uxEmptySlot ) && ( uxHomeSlot > uxSlot ) ) ? pdTRUE : pdFALSE;
+            }
+
+            if( xCanMove != pdFALSE )
+            {
+                xAllocTraceRecords[ uxEmptySlot ] = xAllocTraceRecords[ uxSlot ];
+                uxEmptySlot = uxSlot;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        xAllocTraceRecords[ uxEmptySlot ].pvAddress = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxAllocTraceGetRecords( AllocTraceRecord_t * pxRecords,
+                                        UBaseType_t uxMaxRecords ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxSlot, uxReturn = 0;
+
+        /* The table is only updated by pvPortMalloc() and vPortFree() with the
+         * scheduler suspended. */
+        vTaskSuspendAll();
+        {
+            for( uxSlot = 0; ( uxSlot < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS ) && ( uxReturn < uxMaxRecords ); uxSlot++ )
+            {
+                if( xAllocTraceRecords[ uxSlot ].pvAddress != NULL )
+                {
+                    pxRecords[ uxReturn ] = xAllocTraceRecords[ uxSlot ];
+                    uxReturn++;
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxAllocTraceGetSummary( AllocTraceSummary_t * pxSummary,
+                                        UBaseType_t uxMaxEntries ) /* PRIVILEGED_FUNCTION */
+    {
+        UBaseType_t uxSlot, uxEntry, uxReturn = 0;
+        const AllocTraceRecord_t * pxRecord;
+        TickType_t xNow;
+
+        vTaskSuspendAll();
+        {
+            xNow = xTaskGetTickCount();
+
+            for( uxSlot = 0; uxSlot < ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS; uxSlot++ )
+            {
+                pxRecord = &( xAllocTraceRecords[ uxSlot ] );
+
+                if( pxRecord->pvAddress != NULL )
+                {
+                    /* Is there already a group for this call site and task? */
+                    for( uxEntry = 0; uxEntry < uxReturn; uxEntry++ )
+                    {
+                        if( ( pxSummary[ uxEntry ].pvCaller == pxRecord->pvCaller ) &&
+                            ( pxSummary[ uxEntry ].xTask == pxRecord->xTask ) )
+                        {
+                            break;
+                        }
+                    }
+
+                    if( uxEntry < uxReturn )
+                    {
+                        pxSummary[ uxEntry ].uxAllocations++;
+                        pxSummary[ uxEntry ].xTotalSize += pxRecord->xSize;
+
+                        /* Compare ages rather than absolute tick counts so the
+                         * result remains correct when the tick count overflows. */
+                        if( ( xNow - pxRecord->xTimeStamp ) > ( xNow - pxSummary[ uxEntry ].xOldestTimeStamp ) )
+                        {
+                            pxSummary[ uxEntry ].xOldestTimeStamp = pxRecord->xTimeStamp;
+                        }
+                    }
+                    else if( uxReturn < uxMaxEntries )
+                    {
+                        pxSummary[ uxReturn ].pvCaller = pxRecord->pvCaller;
+                        pxSummary[ uxReturn ].xTask = pxRecord->xTask;
+                        pxSummary[ uxReturn ].uxAllocations = 1;
+                        pxSummary[ uxReturn ].xTotalSize = pxRecord->xSize;
+                        pxSummary[ uxReturn ].xOldestTimeStamp = pxRecord->xTimeStamp;
+                        uxReturn++;
+                    }
+                    else
+                    {
+                        /* No space to start another group. */
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxAllocTraceGetDroppedCount( void ) /* PRIVILEGED_FUNCTION */
+    {
+        return uxAllocTraceDroppedCount;
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+
+        void vAllocTraceReport( char * pcWriteBuffer,
+                                size_t uxBufferLength ) /* PRIVILEGED_FUNCTION */
+        {
+            AllocTraceSummary_t * pxSummary;
+            UBaseType_t uxEntries, x;
+            int iSnprintfReturnValue;
+            size_t uxConsumedBufferLength = 0;
+            const char * pcTaskName;
+
+            #if ( configUSE_TRACE_FACILITY == 1 )
+                TaskStatus_t * pxTaskStatusArray;
+                UBaseType_t uxTasks, y;
+            #endif
+
+            /* Make sure the write buffer does not contain a string. */
+            *pcWriteBuffer = ( char ) 0x00;
+
+            /* Allocate a summary entry for every record that could exist.  The
+             * allocation will itself appear in the report. */
+            pxSummary = pvPortMalloc( ( size_t ) configALLOC_TRACE_MAX_RECORDS * sizeof( AllocTraceSummary_t ) );
+
+            if( pxSummary != NULL )
+            {
+                uxEntries = uxAllocTraceGetSummary( pxSummary, ( UBaseType_t ) configALLOC_TRACE_MAX_RECORDS );
+
+                #if ( configUSE_TRACE_FACILITY == 1 )
+                {
+                    /* Task names are looked up from the task status array
+                     * rather than the task handles, as the task that made an
+                     * allocation may since have been deleted. */
+                    uxTasks = uxTaskGetNumberOfTasks();
+                    pxTaskStatusArray = pvPortMalloc( uxTasks * sizeof( TaskStatus_t ) );
+
+                    if( pxTaskStatusArray != NULL )
+                    {
+                        uxTasks = uxTaskGetSystemState( pxTaskStatusArray, uxTasks, NULL );
+                    }
+                    else
+                    {
+                        uxTasks = 0;
+                    }
+                }
+                #endif /* configUSE_TRACE_FACILITY */
+
+                /* The address of the record table lets the host side tools
+                 * work out where the executable was loaded. */
+                iSnprintfReturnValue = snprintf( pcWriteBuffer,
+                                                 uxBufferLength,
+                                                 "xAllocTraceRecords=%p dropped=%u\r\n",
+                                                 ( void * ) xAllocTraceRecords,
+                                                 ( unsigned int ) uxAllocTraceDroppedCount );
+
+                for( x = 0; ( x <= uxEntries ) && ( iSnprintfReturnValue >= 0 ); x++ )
+                {
+                    if( ( size_t ) iSnprintfReturnValue >= ( uxBufferLength - uxConsumedBufferLength ) )
+                    {
+                        /* The buffer is full - keep what fitted. */
+                        break;
+                    }
+
+                    uxConsumedBufferLength += ( size_t ) iSnprintfReturnValue;
+
+                    if( x == uxEntries )
+                    {
+                        break;
+                    }
+
+                    pcTaskName = ( pxSummary[ x ].xTask == NULL ) ? "-" : "?";
+
+                    #if ( configUSE_TRACE_FACILITY == 1 )
+                    {
+                        for( y = 0; y < uxTasks; y++ )
+                        {
+                            if( pxTaskStatusArray[ y ].xHandle == pxSummary[ x ].xTask )
+                            {
+                                pcTaskName = pxTaskStatusArray[ y ].pcTaskName;
+                                break;
+                            }
+                        }
+                    }
+                    #endif
+
+                    /* caller, task handle, task name, allocations, bytes, oldest. */
+                    iSnprintfReturnValue = snprintf( &( pcWriteBuffer[ uxConsumedBufferLength ] ),
+                                                     uxBufferLength - uxConsumedBufferLength,
+                                                     "%p\t%p\t%s\t%u\t%u\t%u\r\n",
+                                                     pxSummary[ x ].pvCaller,
+                                                     ( void * ) pxSummary[ x ].xTask,
+                                                     pcTaskName,
+                                                     ( unsigned int ) pxSummary[ x ].uxAllocations,
+                                                     ( unsigned int ) pxSummary[ x ].xTotalSize,
+                                                     ( unsigned int ) pxSummary[ x ].xOldestTimeStamp );
+                }
+
+                #if ( configUSE_TRACE_FACILITY == 1 )
+                {
+                    vPortFree( pxTaskStatusArray );
+                }
+                #endif
+
+                vPortFree( pxSummary );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+    #endif /* configUSE_STATS_FORMATTING_FUNCTIONS */
+/*-----------------------------------------------------------*/
+
+#endif /* configUSE_ALLOC_TRACE == 1 */
@@ -0,0 +1,647 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "broadcast.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include broadcast channel functionality. This #if is closed at the very
+ * bottom of this file. If you want to include broadcast channels then ensure
+ * configUSE_BROADCAST_CHANNELS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_BROADCAST_CHANNELS == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define broadcastYIELD_IF_USING_PREEMPTION()
+    #else
+        #define broadcastYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+/*
+ * Items are identified by a sequence number that counts every item ever
+ * published to the channel, and wraps.  The channel holds the uxLength most
+ * recent items, the newest of which has sequence number uxPublished - 1 and is
+ * held in the slot before uxNextSlot.  A subscriber only holds the sequence
+ * number of the next item it will read, so the number of items it has not
+ * read is always uxPublished minus that number, even after wrapping.
+ */
+    typedef struct BroadcastDefinition
+    {
+        uint8_t * pucStorage;          /**< Points to the ring buffer of uxLength items. */
+        UBaseType_t uxLength;          /**< The number of items the ring buffer holds. */
+        UBaseType_t uxItemSize;        /**< The size of each item in bytes. */
+        UBaseType_t uxPublished;       /**< The number of items ever published, modulo the range of UBaseType_t. */
+        UBaseType_t uxNextSlot;        /**< The slot the next published item is written to. */
+        List_t xTasksWaitingToReceive; /**< List of tasks that are blocked waiting for an item to be published.  Stored in priority order. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the channel is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } Broadcast_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the members of a newly allocated channel.
+ */
+    static void prvInitialiseNewChannel( const UBaseType_t uxLength,
+                                         const UBaseType_t uxItemSize,
+                                         uint8_t * pucStorage,
+                                         Broadcast_t * const pxChannel ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies an item into the channel and unblocks all the tasks waiting to
+ * receive.  Must be called from within a critical section.  Returns pdTRUE if
+ * an unblocked task has a priority above the priority of the calling task.
+ */
+    static BaseType_t prvPublishItem( Broadcast_t * const pxChannel,
+                                      const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copies the next item the subscriber has not read into pvBuffer if there is
+ * one, skipping over any items that have been overwritten.  Must be called
+ * from within a critical section.  Returns pdPASS if an item was copied.
+ */
+    static BaseType_t prvReceiveItem( BroadcastSubscriber_t * const pxSubscriber,
+                                      void * pvBuffer,
+                                      UBaseType_t * puxItemsLost ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        BroadcastHandle_t xBroadcastCreateStatic( UBaseType_t uxLength,
+                                                  UBaseType_t uxItemSize,
+                                                  uint8_t * pucStorageBuffer,
+                                                  StaticBroadcast_t * pxChannelBuffer )
+        {
+            Broadcast_t * pxChannel = NULL;
+
+            traceENTER_xBroadcastCreateStatic( uxLength, uxItemSize, pucStorageBuffer, pxChannelBuffer );
+
+            configASSERT( uxLength > ( UBaseType_t ) 0 );
+            configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+            configASSERT( pucStorageBuffer );
+            configASSERT( pxChannelBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticBroadcast_t equals the size of the real
+                 * channel structure. */
+                volatile size_t xSize = sizeof( StaticBroadcast_t );
+                configASSERT( xSize == sizeof( Broadcast_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            if( ( uxLength > ( UBaseType_t ) 0 ) &&
+                ( uxItemSize > ( UBaseType_t ) 0 ) &&
+                ( pucStorageBuffer != NULL ) &&
+                ( pxChannelBuffer != NULL ) )
+            {
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxChannel = ( Broadcast_t * ) pxChannelBuffer;
+
+                prvInitialiseNewChannel( uxLength, uxItemSize, pucStorageBuffer, pxChannel );
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note that
+                     * this channel was created statically in case the channel is
+                     * later deleted. */
+                    pxChannel->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xBroadcastCreateStatic( pxChannel );
+
+            return pxChannel;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength,
+                                            UBaseType_t uxItemSize )
+        {
+            Broadcast_t * pxChannel = NULL;
+            size_t xStorageSizeInBytes;
+            uint8_t * pucStorage;
+
+            traceENTER_xBroadcastCreate( uxLength, uxItemSize );
+
+            if( ( uxLength > ( UBaseType_t ) 0 ) &&
+                ( uxItemSize > ( UBaseType_t ) 0 ) &&
+                /* Check for multiplication overflow. */
+                ( ( SIZE_MAX / uxLength ) >= uxItemSize ) &&
+                /* Check for addition overflow. */
+                /* MISRA Ref 14.3.1 [Configuration dependent invariant] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-143. */
+                /* coverity[misra_c_2012_rule_14_3_violation] */
+                ( ( SIZE_MAX - sizeof( Broadcast_t ) ) >= ( size_t ) ( ( size_t ) uxLength * ( size_t ) uxItemSize ) ) )
+            {
+                xStorageSizeInBytes = ( size_t ) ( ( size_t ) uxLength * ( size_t ) uxItemSize );
+
+                /* The channel structure and the ring buffer are allocated in
+                 * one block. */
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxChannel = ( Broadcast_t * ) pvPortMalloc( sizeof( Broadcast_t ) + xStorageSizeInBytes );
+
+                if( pxChannel != NULL )
+                {
+                    /* Jump past the channel structure to find the location of
+                     * the ring buffer. */
+                    pucStorage = ( uint8_t * ) pxChannel;
+                    pucStorage += sizeof( Broadcast_t );
+
+                    prvInitialiseNewChannel( uxLength, uxItemSize, pucStorage, pxChannel );
+
+                    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                    {
+                        /* Both static and dynamic allocation can be used, so note
+                         * this channel was allocated dynamically in case the
+                         * channel is later deleted. */
+                        pxChannel->ucStaticallyAllocated = pdFALSE;
+                    }
+                    #endif /* configSUPPORT_STATIC_ALLOCATION */
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                configASSERT( pxChannel );
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xBroadcastCreate( pxChannel );
+
+            return pxChannel;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vBroadcastSubscribe( BroadcastHandle_t xChannel,
+                              BroadcastSubscriber_t * pxSubscriber )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+
+        traceENTER_vBroadcastSubscribe( xChannel, pxSubscriber );
+
+        configASSERT( pxChannel );
+        configASSERT( pxSubscriber );
+
+        pxSubscriber->xChannel = pxChannel;
+
+        /* Read uxPublished in a critical section in case it is not updated
+         * atomically. */
+        taskENTER_CRITICAL();
+        {
+            pxSubscriber->uxNextItem = pxChannel->uxPublished;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vBroadcastSubscribe();
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastPublish( BroadcastHandle_t xChannel,
+                            const void * pvItem )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+        BaseType_t xYieldRequired;
+
+        traceENTER_vBroadcastPublish( xChannel, pvItem );
+
+        configASSERT( pxChannel );
+        configASSERT( pvItem );
+
+        taskENTER_CRITICAL();
+        {
+            xYieldRequired = prvPublishItem( pxChannel, pvItem );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            broadcastYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vBroadcastPublish();
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastPublishFromISR( BroadcastHandle_t xChannel,
+                                   const void * pvItem,
+                                   BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vBroadcastPublishFromISR( xChannel, pvItem, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxChannel );
+        configASSERT( pvItem );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum system call (or maximum API call) interrupt priority.
+         * Interrupts that are above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( prvPublishItem( pxChannel, pvItem ) != pdFALSE )
+            {
+                if( pxHigherPriorityTaskWoken != NULL )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_vBroadcastPublishFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xBroadcastReceive( BroadcastSubscriber_t * pxSubscriber,
+                                  void * pvBuffer,
+                                  UBaseType_t * puxItemsLost,
+                                  TickType_t xTicksToWait )
+    {
+        Broadcast_t * pxChannel;
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn;
+        BaseType_t xShouldBlock;
+        BaseType_t xAlreadyYielded;
+
+        traceENTER_xBroadcastReceive( pxSubscriber, pvBuffer, puxItemsLost, xTicksToWait );
+
+        configASSERT( pxSubscriber );
+        configASSERT( pvBuffer );
+
+        pxChannel = pxSubscriber->xChannel;
+        configASSERT( pxChannel );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* Try without suspending the scheduler first, as a subscriber that
+         * keeps up normally finds the item it is waiting for already
+         * published. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = prvReceiveItem( pxSubscriber, pvBuffer, puxItemsLost );
+        }
+        taskEXIT_CRITICAL();
+
+        if( ( xReturn == errQUEUE_EMPTY ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+
+            do
+            {
+                xShouldBlock = pdFALSE;
+
+                vTaskSuspendAll();
+                {
+                    /* Items are only published from within a critical section,
+                     * so checking for an item and joining the list of waiting
+                     * tasks must be atomic. */
+                    taskENTER_CRITICAL();
+                    {
+                        xReturn = prvReceiveItem( pxSubscriber, pvBuffer, puxItemsLost );
+
+                        if( xReturn == pdPASS )
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                        else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+                        {
+                            traceBLOCKING_ON_BROADCAST_RECEIVE( pxChannel );
+                            vTaskPlaceOnEventList( &( pxChannel->xTasksWaitingToReceive ), xTicksToWait );
+                            xShouldBlock = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    taskEXIT_CRITICAL();
+                }
+                xAlreadyYielded = xTaskResumeAll();
+
+                if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+                {
+                    taskYIELD_WITHIN_API();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            } while( xShouldBlock != pdFALSE );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xBroadcastReceive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xBroadcastReceiveFromISR( BroadcastSubscriber_t * pxSubscriber,
+                                         void * pvBuffer,
+                                         UBaseType_t * puxItemsLost )
+    {
+        BaseType_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xBroadcastReceiveFromISR( pxSubscriber, pvBuffer, puxItemsLost );
+
+        configASSERT( pxSubscriber );
+        configASSERT( pxSubscriber->xChannel );
+        configASSERT( pvBuffer );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xReturn = prvReceiveItem( pxSubscriber, pvBuffer, puxItemsLost );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xBroadcastReceiveFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxBroadcastItemsWaiting( const BroadcastSubscriber_t * pxSubscriber )
+    {
+        const Broadcast_t * pxChannel;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxBroadcastItemsWaiting( pxSubscriber );
+
+        configASSERT( pxSubscriber );
+
+        pxChannel = pxSubscriber->xChannel;
+        configASSERT( pxChannel );
+
+        /* uxPublished is a single UBaseType_t, so is read atomically and no
+         * critical section is needed.  This lets the function be called from
+         * an interrupt. */
+        uxReturn = pxChannel->uxPublished - pxSubscriber->uxNextItem;
+
+        if( uxReturn > pxChannel->uxLength )
+        {
+            /* Items the subscriber has not read have been overwritten. */
+            uxReturn = pxChannel->uxLength;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_uxBroadcastItemsWaiting( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vBroadcastDelete( BroadcastHandle_t xChannel )
+    {
+        Broadcast_t * const pxChannel = xChannel;
+
+        traceENTER_vBroadcastDelete( xChannel );
+
+        configASSERT( pxChannel );
+        configASSERT( listLIST_IS_EMPTY( &( pxChannel->xTasksWaitingToReceive ) ) != pdFALSE );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The channel can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxChannel );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The channel could have been allocated statically or dynamically,
+             * so check before attempting to free the memory. */
+            if( pxChannel->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxChannel );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vBroadcastDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewChannel( const UBaseType_t uxLength,
+                                         const UBaseType_t uxItemSize,
+                                         uint8_t * pucStorage,
+                                         Broadcast_t * const pxChannel )
+    {
+        pxChannel->pucStorage = pucStorage;
+        pxChannel->uxLength = uxLength;
+        pxChannel->uxItemSize = uxItemSize;
+        pxChannel->uxPublished = ( UBaseType_t ) 0U;
+        pxChannel->uxNextSlot = ( UBaseType_t ) 0U;
+        vListInitialise( &( pxChannel->xTasksWaitingToReceive ) );
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvPublishItem( Broadcast_t * const pxChannel,
+                                      const void * pvItem )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        traceBROADCAST_PUBLISH( pxChannel );
+
+        ( void ) memcpy( ( void * ) &( pxChannel->pucStorage[ pxChannel->uxNextSlot * pxChannel->uxItemSize ] ), pvItem, ( size_t ) pxChannel->uxItemSize );
+
+        ( pxChannel->uxNextSlot )++;
+
+        if( pxChannel->uxNextSlot == pxChannel->uxLength )
+        {
+            pxChannel->uxNextSlot = ( UBaseType_t ) 0U;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        ( pxChannel->uxPublished )++;
+
+        /* Every waiting subscriber now has an item to read. */
+        while( listLIST_IS_EMPTY( &( pxChannel->xTasksWaitingToReceive ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxChannel->xTasksWaitingToReceive ) ) != pdFALSE )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvReceiveItem( BroadcastSubscriber_t * const pxSubscriber,
+                                      void * pvBuffer,
+                                      UBaseType_t * puxItemsLost )
+    {
+        const Broadcast_t * const pxChannel = pxSubscriber->xChannel;
+        UBaseType_t uxUnread;
+        UBaseType_t uxLost = ( UBaseType_t ) 0U;
+        UBaseType_t uxSlot;
+        BaseType_t xReturn = errQUEUE_EMPTY;
+
+        uxUnread = pxChannel->uxPublished - pxSubscriber->uxNextItem;
+
+        if( uxUnread != ( UBaseType_t ) 0U )
+        {
+            if( uxUnread > pxChannel->uxLength )
+            {
+                /* The publisher has overwritten items this subscriber had not
+                 * read, so skip to the oldest item that is still held. */
+                uxLost = uxUnread - pxChannel->uxLength;
+                uxUnread = pxChannel->uxLength;
+                traceBROADCAST_OVERRUN( pxChannel, uxLost );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* The item to read was published uxUnread items ago, so is held
+             * uxUnread slots before the next slot to be written. */
+            if( pxChannel->uxNextSlot >= uxUnread )
+            {
+                uxSlot = pxChannel->uxNextSlot - uxUnread;
+            }
+            else
+            {
+                uxSlot = ( UBaseType_t ) ( pxChannel->uxLength - ( uxUnread - pxChannel->uxNextSlot ) );
+            }
+
+            ( void ) memcpy( pvBuffer, ( const void * ) &( pxChannel->pucStorage[ uxSlot * pxChannel->uxItemSize ] ), ( size_t ) pxChannel->uxItemSize );
+
+            pxSubscriber->uxNextItem = ( UBaseType_t ) ( pxChannel->uxPublished - uxUnread );
+            ( pxSubscriber->uxNextItem )++;
+            xReturn = pdPASS;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( puxItemsLost != NULL )
+        {
+            *puxItemsLost = uxLost;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include broadcast channel functionality. If you want to include broadcast
+ * channels then ensure configUSE_BROADCAST_CHANNELS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_BROADCAST_CHANNELS == 1 */
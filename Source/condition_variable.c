@@ -0,0 +1,411 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "semphr.h"
+#include "condition_variable.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include condition variable functionality. This #if is closed at the very
+ * bottom of this file. If you want to include condition variables then ensure
+ * configUSE_CONDITION_VARIABLES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define condvarYIELD_IF_USING_PREEMPTION()
+    #else
+        #define condvarYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+    typedef struct CondVarDefinition
+    {
+        List_t xTasksWaiting;            /**< List of tasks that are blocked waiting for the condition variable to be signalled.  Stored in priority order. */
+        SemaphoreHandle_t xMutex;        /**< The mutex given back by the tasks in xTasksWaiting. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the condition variable is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } CondVar_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the members of a newly allocated condition variable.
+ */
+    static void prvInitialiseNewCondVar( CondVar_t * const pxCondVar ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t * pxCondVarBuffer )
+        {
+            CondVar_t * pxCondVar;
+
+            traceENTER_xCondVarCreateStatic( pxCondVarBuffer );
+
+            /* A StaticCondVar_t object must be provided. */
+            configASSERT( pxCondVarBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticCondVar_t equals the size of the real
+                 * condition variable structure. */
+                volatile size_t xSize = sizeof( StaticCondVar_t );
+                configASSERT( xSize == sizeof( CondVar_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxCondVar = ( CondVar_t * ) pxCondVarBuffer;
+
+            if( pxCondVar != NULL )
+            {
+                prvInitialiseNewCondVar( pxCondVar );
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note that
+                     * this condition variable was created statically in case it
+                     * is later deleted. */
+                    pxCondVar->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+            }
+
+            traceRETURN_xCondVarCreateStatic( pxCondVar );
+
+            return pxCondVar;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        CondVarHandle_t xCondVarCreate( void )
+        {
+            CondVar_t * pxCondVar;
+
+            traceENTER_xCondVarCreate();
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxCondVar = ( CondVar_t * ) pvPortMalloc( sizeof( CondVar_t ) );
+
+            if( pxCondVar != NULL )
+            {
+                prvInitialiseNewCondVar( pxCondVar );
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note
+                     * this condition variable was allocated dynamically in case
+                     * it is later deleted. */
+                    pxCondVar->ucStaticallyAllocated = pdFALSE;
+                }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+            }
+
+            traceRETURN_xCondVarCreate( pxCondVar );
+
+            return pxCondVar;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCondVarWait( CondVarHandle_t xCondVar,
+                             SemaphoreHandle_t xMutex,
+                             TickType_t xTicksToWait )
+    {
+        CondVar_t * const pxCondVar = xCondVar;
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn;
+        BaseType_t xMutexGiven;
+        BaseType_t xShouldBlock = pdFALSE;
+        BaseType_t xAlreadyYielded;
+
+        traceENTER_xCondVarWait( xCondVar, xMutex, xTicksToWait );
+
+        configASSERT( pxCondVar );
+        configASSERT( xMutex );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( xTaskGetSchedulerState() != taskSCHEDULER_SUSPENDED );
+        }
+        #endif
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        /* No other task can signal the condition variable while the scheduler
+         * is suspended, so giving back the mutex and joining the list of
+         * waiting tasks is atomic as far as other tasks are concerned.  The
+         * mutex must be given back before the task is placed on the event list
+         * because giving it back may disinherit a priority, which moves the
+         * task within the ready lists. */
+        vTaskSuspendAll();
+        {
+            xMutexGiven = xSemaphoreGive( xMutex );
+
+            /* The calling task must hold the mutex. */
+            configASSERT( xMutexGiven == pdPASS );
+            ( void ) xMutexGiven;
+
+            taskENTER_CRITICAL();
+            {
+                /* All the tasks waiting at the same time must give back the
+                 * same mutex, as xCondVarBroadcast() moves them all onto its
+                 * list of waiting tasks. */
+                configASSERT( ( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) != pdFALSE ) || ( pxCondVar->xMutex == xMutex ) );
+                pxCondVar->xMutex = xMutex;
+
+                if( xTicksToWait != ( TickType_t ) 0 )
+                {
+                    vTaskPlaceOnEventList( &( pxCondVar->xTasksWaiting ), xTicksToWait );
+                    xShouldBlock = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The task was woken by xCondVarSignal(), by xCondVarBroadcast(), by
+         * the mutex being given back after xCondVarBroadcast() moved the task
+         * onto the list of tasks waiting for the mutex, or by xTicksToWait
+         * expiring. */
+        if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE )
+        {
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        /* The mutex is taken again whether or not the wait timed out, so the
+         * caller can always check the condition. */
+        while( xSemaphoreTake( xMutex, portMAX_DELAY ) == pdFAIL )
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xCondVarWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCondVarSignal( CondVarHandle_t xCondVar )
+    {
+        CondVar_t * const pxCondVar = xCondVar;
+        BaseType_t xReturn = pdFALSE;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xCondVarSignal( xCondVar );
+
+        configASSERT( pxCondVar );
+
+        taskENTER_CRITICAL();
+        {
+            if( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+            {
+                /* The unblocked task takes the mutex again itself, blocking on
+                 * it if it is still held. */
+                xYieldRequired = xTaskRemoveFromEventList( &( pxCondVar->xTasksWaiting ) );
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            condvarYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xCondVarSignal( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xCondVarBroadcast( CondVarHandle_t xCondVar )
+    {
+        CondVar_t * const pxCondVar = xCondVar;
+        BaseType_t xReturn = pdFALSE;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xCondVarBroadcast( xCondVar );
+
+        configASSERT( pxCondVar );
+
+        taskENTER_CRITICAL();
+        {
+            if( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+            {
+                /* Unblock the highest priority task.  If the mutex is held then
+                 * that task blocks on the mutex, so the mutex holder inherits a
+                 * priority at least as high as that of any of the other waiting
+                 * tasks. */
+                xYieldRequired = xTaskRemoveFromEventList( &( pxCondVar->xTasksWaiting ) );
+
+                /* Only one task at a time can take the mutex, so while it is
+                 * held the other waiting tasks are moved directly onto the list
+                 * of tasks waiting for it, and are unblocked one at a time as it
+                 * is given back.  Otherwise they are all unblocked now. */
+                if( xQueueRequeueWaitingTasks( pxCondVar->xMutex, &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+                {
+                    while( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) == pdFALSE )
+                    {
+                        if( xTaskRemoveFromEventList( &( pxCondVar->xTasksWaiting ) ) != pdFALSE )
+                        {
+                            xYieldRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            condvarYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xCondVarBroadcast( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vCondVarDelete( CondVarHandle_t xCondVar )
+    {
+        CondVar_t * const pxCondVar = xCondVar;
+
+        traceENTER_vCondVarDelete( xCondVar );
+
+        configASSERT( pxCondVar );
+        configASSERT( listLIST_IS_EMPTY( &( pxCondVar->xTasksWaiting ) ) != pdFALSE );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The condition variable can only have been allocated dynamically -
+             * free it again. */
+            vPortFree( pxCondVar );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The condition variable could have been allocated statically or
+             * dynamically, so check before attempting to free the memory. */
+            if( pxCondVar->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxCondVar );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vCondVarDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewCondVar( CondVar_t * const pxCondVar )
+    {
+        vListInitialise( &( pxCondVar->xTasksWaiting ) );
+        pxCondVar->xMutex = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include condition variable functionality. If you want to include condition
+ * variables then ensure configUSE_CONDITION_VARIABLES is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_CONDITION_VARIABLES == 1 */
@@ -40,6 +40,10 @@
 #include "timers.h"
 #include "event_groups.h"
 
+#if ( configUSE_WAIT_ANY == 1 )
+    #include "wait_any.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
@@ -60,11 +64,29 @@
             UBaseType_t uxEventGroupNumber;
         #endif
 
+        #if ( configUSE_WAIT_ANY == 1 )
+            WaitAnyObject_t * pxWaitAnyObjects; /**< Chain of the pxWaitAny() calls that include this event group, or NULL if there are none. */
+        #endif
+
         #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
             uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the event group is statically allocated to ensure no attempt is made to free the memory. */
         #endif
     } EventGroup_t;
 
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configEVENT_GROUP_ARENA_SIZE > 0 ) )
+
+/* Dynamically created event groups are taken from this arena, and only from
+ * the heap once it is exhausted. */
+        PRIVILEGED_DATA static EventGroup_t xEventGroupArenaStorage[ configEVENT_GROUP_ARENA_SIZE ];
+        PRIVILEGED_DATA static KernelObjectArena_t xEventGroupArena = { xEventGroupArenaStorage, sizeof( EventGroup_t ), ( UBaseType_t ) configEVENT_GROUP_ARENA_SIZE, ( UBaseType_t ) 0U, NULL };
+
+        #define eventALLOCATE_EVENT_GROUP()             ( ( EventGroup_t * ) pvTaskAllocateKernelObject( &xEventGroupArena ) )
+        #define eventFREE_EVENT_GROUP( pxEventBits )    vTaskFreeKernelObject( &xEventGroupArena, ( pxEventBits ) )
+    #else
+        #define eventALLOCATE_EVENT_GROUP()             ( ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) ) )
+        #define eventFREE_EVENT_GROUP( pxEventBits )    vPortFree( pxEventBits )
+    #endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -113,6 +135,12 @@
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    pxEventBits->pxWaitAnyObjects = NULL;
+                }
+                #endif /* configUSE_WAIT_ANY */
+
                 #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note that
@@ -151,13 +179,19 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxEventBits = ( EventGroup_t * ) pvPortMalloc( sizeof( EventGroup_t ) );
+            pxEventBits = eventALLOCATE_EVENT_GROUP();
 
             if( pxEventBits != NULL )
             {
                 pxEventBits->uxEventBits = 0;
                 vListInitialise( &( pxEventBits->xTasksWaitingForBits ) );
 
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    pxEventBits->pxWaitAnyObjects = NULL;
+                }
+                #endif /* configUSE_WAIT_ANY */
+
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
                     /* Both static and dynamic allocation can be used, so note this
@@ -632,6 +666,27 @@
                 pxListItem = pxNext;
             }
 
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                /* Tasks blocked in pxWaitAny() are only accessed from critical
+                 * sections.  They see the bits before any are cleared on exit,
+                 * as the tasks unblocked above did.  Any task unblocked here is
+                 * switched to by xTaskResumeAll() if necessary. */
+                taskENTER_CRITICAL();
+                {
+                    if( pxEventBits->pxWaitAnyObjects != NULL )
+                    {
+                        ( void ) xWaitAnyNotifyReady( pxEventBits->pxWaitAnyObjects, pxEventBits->uxEventBits );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            #endif /* configUSE_WAIT_ANY */
+
             /* Clear any bits that matched when the eventCLEAR_EVENTS_ON_EXIT_BIT
              * bit was set in the control word. */
             pxEventBits->uxEventBits &= ~uxBitsToClear;
@@ -656,6 +711,13 @@
 
         configASSERT( pxEventBits );
 
+        #if ( configUSE_WAIT_ANY == 1 )
+        {
+            /* A task must not be waiting on the event group in pxWaitAny(). */
+            configASSERT( pxEventBits->pxWaitAnyObjects == NULL );
+        }
+        #endif
+
         pxTasksWaitingForBits = &( pxEventBits->xTasksWaitingForBits );
 
         vTaskSuspendAll();
@@ -676,7 +738,7 @@
         {
             /* The event group can only have been allocated dynamically - free
              * it again. */
-            vPortFree( pxEventBits );
+            eventFREE_EVENT_GROUP( pxEventBits );
         }
         #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
         {
@@ -684,7 +746,7 @@
              * dynamically, so check before attempting to free the memory. */
             if( pxEventBits->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
             {
-                vPortFree( pxEventBits );
+                eventFREE_EVENT_GROUP( pxEventBits );
             }
             else
             {
@@ -881,6 +943,52 @@
     #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
+    #if ( configUSE_WAIT_ANY == 1 )
+
+        BaseType_t xEventGroupAddToWaitAny( EventGroupHandle_t xEventGroup,
+                                            WaitAnyObject_t * pxObject )
+        {
+            EventGroup_t * pxEventBits = xEventGroup;
+            BaseType_t xReturn;
+
+            traceENTER_xEventGroupAddToWaitAny( xEventGroup, pxObject );
+
+            configASSERT( pxEventBits );
+
+            /* This function should not be called by application code.  It is
+             * designed for use by pxWaitAny(), and must be called from a
+             * critical section. */
+            vWaitAnyLinkObject( &( pxEventBits->pxWaitAnyObjects ), pxObject );
+            xReturn = ( ( pxEventBits->uxEventBits & pxObject->uxBitsToWaitFor ) != ( EventBits_t ) 0 ) ? pdTRUE : pdFALSE;
+
+            traceRETURN_xEventGroupAddToWaitAny( xReturn );
+
+            return xReturn;
+        }
+
+    #endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_WAIT_ANY == 1 )
+
+        void vEventGroupRemoveFromWaitAny( EventGroupHandle_t xEventGroup,
+                                           WaitAnyObject_t * pxObject )
+        {
+            EventGroup_t * pxEventBits = xEventGroup;
+
+            traceENTER_vEventGroupRemoveFromWaitAny( xEventGroup, pxObject );
+
+            configASSERT( pxEventBits );
+
+            /* Must be called from a critical section. */
+            vWaitAnyUnlinkObject( &( pxEventBits->pxWaitAnyObjects ), pxObject );
+
+            traceRETURN_vEventGroupRemoveFromWaitAny();
+        }
+
+    #endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
 /* This entire source file will be skipped if the application is not configured
  * to include event groups functionality. If you want to include event groups
  * then ensure configUSE_EVENT_GROUPS is set to 1 in FreeRTOSConfig.h. */
@@ -111,6 +111,37 @@
  * lowest priority. */
 #define configMAX_PRIORITIES                       5
 
+/* Set configUSE_EDF_SCHEDULING to 1 to schedule the tasks admitted with
+ * xTaskEDFAdmit() by earliest deadline first.  Admitted tasks run at
+ * configEDF_PRIORITY, which must be reserved for them, and among themselves
+ * the task with the earliest deadline runs.  Tasks of higher priority preempt
+ * them as usual.  Not available when configNUMBER_OF_CORES is greater than 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_EDF_SCHEDULING                   0
+#define configEDF_PRIORITY                         ( configMAX_PRIORITIES - 2 )
+
+/* configEDF_UTILISATION_BOUND is the percentage of the processor time that
+ * xTaskEDFAdmit() can reserve for EDF tasks in total, which leaves the rest for
+ * tasks of higher priority.  Defaults to 100 if left undefined. */
+#define configEDF_UTILISATION_BOUND                100
+
+/* Set configUSE_TASK_BUDGETS to 1 to include vTaskSetBudget(), which limits
+ * the processor time a task can use at its priority in each period, demoting
+ * the task once its budget is exhausted.  configTASK_BUDGET_MAX_REPLENISHMENTS
+ * sets the number of pending replenishments held per task.  Not available when
+ * configNUMBER_OF_CORES is greater than 1.  Both default to 0 and 4
+ * respectively if left undefined. */
+#define configUSE_TASK_BUDGETS                     0
+#define configTASK_BUDGET_MAX_REPLENISHMENTS       4
+
+/* Set configUSE_PERIODIC_TASKS to 1 to include vTaskPeriodicStart() and
+ * xTaskPeriodicWait(), with which the kernel counts the deadline misses and
+ * overruns of periodic tasks and keeps a histogram of their response times with
+ * configPERIODIC_TASK_HISTOGRAM_BUCKETS buckets.  Both default to 0 and 8
+ * respectively if left undefined. */
+#define configUSE_PERIODIC_TASKS                   0
+#define configPERIODIC_TASK_HISTOGRAM_BUCKETS      8
+
 /* configMINIMAL_STACK_SIZE defines the size of the stack used by the Idle task
  * (in words, not in bytes!).  The kernel does not use this constant for any
  * other purpose.  Demo applications use the constant to make the demos somewhat
@@ -155,6 +186,59 @@
  * kernel aware debugger.  Defaults to 0 if left undefined. */
 #define configQUEUE_REGISTRY_SIZE                  0
 
+/* Set configUSE_SPSC_QUEUES to 1 to include support for queues created with
+ * xQueueCreateSPSC().  Such queues have exactly one sending task or interrupt
+ * and one receiving task or interrupt, and move data without entering a
+ * critical section.  Defaults to 0 if left undefined. */
+#define configUSE_SPSC_QUEUES                      0
+
+/* configQUEUE_SPSC_NOTIFICATION_INDEX sets the index in the task notification
+ * array used to block the sending or receiving task of a queue created with
+ * xQueueCreateSPSC().  Defaults to 0 if left undefined. */
+#define configQUEUE_SPSC_NOTIFICATION_INDEX        0
+
+/* Set configUSE_LIGHT_MUTEXES to 1 to include the light mutex API from
+ * light_mutex.h.  A light mutex is taken and given with a single compare and
+ * swap when there is no contention, and only enters the kernel to block and to
+ * apply priority inheritance.  configUSE_MUTEXES must also be set to 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_LIGHT_MUTEXES                    0
+
+/* configPRIORITY_INHERITANCE_DEPTH sets how far priority inheritance follows a
+ * chain of mutex holders that are themselves blocked on mutexes.  With 1 only
+ * the holder of the mutex a task blocks on inherits its priority.  With N, the
+ * holder of the mutex that holder is blocked on inherits it too, and so on for
+ * up to N holders.  The chain is walked from within a critical section, so N
+ * bounds the time taken to block on, or time out from, a mutex.  Defaults to 1
+ * if left undefined. */
+#define configPRIORITY_INHERITANCE_DEPTH           1
+
+/* Set configUSE_RW_LOCKS to 1 to include the reader-writer lock API from
+ * rw_lock.h.  A reader-writer lock can be held by any number of readers at
+ * once, or by one writer, and prefers writers over new readers.
+ * configUSE_MUTEXES must also be set to 1.  Defaults to 0 if left undefined. */
+#define configUSE_RW_LOCKS                         0
+
+/* Set configUSE_CONDITION_VARIABLES to 1 to include the condition variable API
+ * from condition_variable.h.  A condition variable gives back a mutex and
+ * blocks the calling task in one step, and wakes waiting tasks in priority
+ * order.  configUSE_MUTEXES must also be set to 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_CONDITION_VARIABLES              0
+
+/* Set configUSE_WAIT_ANY to 1 to include the pxWaitAny() API from wait_any.h,
+ * which blocks a task until any one of a set of queues, semaphores, event
+ * groups, stream buffers and task notifications is ready.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_WAIT_ANY                         0
+
+/* Set configUSE_BROADCAST_CHANNELS to 1 to include the broadcast channel API
+ * from broadcast.h.  A broadcast channel delivers every published item to
+ * every subscriber from a single ring buffer, and overwrites the oldest item
+ * rather than blocking the publisher when a subscriber falls behind.  Defaults
+ * to 0 if left undefined. */
+#define configUSE_BROADCAST_CHANNELS               0
+
 /* Set configENABLE_BACKWARD_COMPATIBILITY to 1 to map function names and
  * datatypes from old version of FreeRTOS to their latest equivalent.  Defaults
  * to 1 if left undefined. */
@@ -264,6 +348,19 @@
 
 #define configUSE_STREAM_BUFFERS    1
 
+/* Set configUSE_MULTI_PRODUCER_STREAM_BUFFERS to 1 to include support for
+ * stream and message buffers created with xStreamBufferCreateMultiProducer() or
+ * xMessageBufferCreateMultiProducer().  Any number of tasks and interrupts can
+ * write to such a buffer at once without a critical section around the copy.
+ * Defaults to 0 if left undefined. */
+#define configUSE_MULTI_PRODUCER_STREAM_BUFFERS    0
+
+/* Set configUSE_STREAM_BUFFER_COALESCING to 1 to include
+ * xStreamBufferSetNotificationCoalescing(), which lets a stream or message
+ * buffer hold off waking its reader until a number of bytes or ticks have
+ * passed.  Defaults to 0 if left undefined. */
+#define configUSE_STREAM_BUFFER_COALESCING    0
+
 /******************************************************************************/
 /* Memory allocation related definitions. *************************************/
 /******************************************************************************/
@@ -307,6 +404,43 @@
  * catch pointer corruptions. Defaults to 0 if left undefined. */
 #define configENABLE_HEAP_PROTECTOR                  0
 
+/* Set configHEAP_INCREMENTAL_STATS to 1 to have heap_4.c and heap_5.c update
+ * the free block statistics as memory is allocated and freed, so
+ * vPortGetHeapStats() never walks the free list, and to include
+ * vPortGetHeapHistogram() in the build.  Allocations are then never smaller
+ * than twice the size of the heap's block header.  Defaults to 0 if left
+ * undefined. */
+#define configHEAP_INCREMENTAL_STATS                 0
+
+/* Sets the number of size buckets in the free block histogram returned by
+ * vPortGetHeapHistogram().  Defaults to 16 if left undefined. */
+#define configHEAP_HISTOGRAM_BUCKETS                 16
+
+/* Set configUSE_ALLOC_TRACE to 1 to have alloc_trace.c record the call site,
+ * owning task, size and time of every live heap allocation so leaks can be
+ * attributed to the code that made them.  The FreeRTOS/source/alloc_trace.c
+ * source file must be included in the build if configUSE_ALLOC_TRACE is set to
+ * 1.  Defaults to 0 if left undefined. */
+#define configUSE_ALLOC_TRACE                        0
+
+/* Sets the maximum number of live allocations the allocation tracer can record
+ * at once.  Allocations made while the record table is full are counted but not
+ * recorded.  Defaults to 64 if left undefined. */
+#define configALLOC_TRACE_MAX_RECORDS                64
+
+/* Set configTASK_ARENA_SIZE, configQUEUE_ARENA_SIZE, configTIMER_ARENA_SIZE and
+ * configEVENT_GROUP_ARENA_SIZE to the number of task control blocks, queues,
+ * software timers and event groups respectively to hold in statically allocated
+ * arenas.  Objects created with the dynamic allocation API take their control
+ * block from the arena in constant time, and return it when they are deleted,
+ * so creating and deleting them does not fragment the heap.  Task stacks and
+ * queue storage areas are still allocated from the heap.  The heap is used if
+ * an arena is exhausted.  Each defaults to 0 (no arena) if left undefined. */
+#define configTASK_ARENA_SIZE                        0
+#define configQUEUE_ARENA_SIZE                       0
+#define configTIMER_ARENA_SIZE                       0
+#define configEVENT_GROUP_ARENA_SIZE                 0
+
 /******************************************************************************/
 /* Interrupt nesting behaviour configuration. *********************************/
 /******************************************************************************/
@@ -341,6 +475,8 @@
 #define configUSE_TICK_HOOK                   0
 #define configUSE_MALLOC_FAILED_HOOK          0
 #define configUSE_DAEMON_TASK_STARTUP_HOOK    0
+#define configUSE_EDF_DEADLINE_MISS_HOOK      0
+#define configUSE_PERIODIC_TASK_OVERRUN_HOOK  0
 
 /* Set configUSE_SB_COMPLETED_CALLBACK to 1 to have send and receive completed
  * callbacks for each instance of a stream buffer or message buffer. When the
@@ -403,6 +539,23 @@
  * priority. Defaults to 0 if left undefined. */
 #define configMAX_CO_ROUTINE_PRIORITIES    1
 
+/* Set configUSE_EXECUTORS to 1 to include the executor API from executor.h,
+ * which runs many stackless handlers from a single task and supersedes
+ * co-routines.  configUSE_WAIT_ANY must also be set to 1.  Defaults to 0 if
+ * left undefined. */
+#define configUSE_EXECUTORS                0
+
+/* configEXECUTOR_MAX_PRIORITIES defines the number of priorities available to
+ * the handlers in each executor.  Any number of handlers can share the same
+ * priority.  Defaults to 4 if left undefined. */
+#define configEXECUTOR_MAX_PRIORITIES      4
+
+/* Set configUSE_TASK_GROUPS to 1 to include the task group API from
+ * task_group.h, which runs many run-to-completion members on the stack of a
+ * single task.  Not available when configNUMBER_OF_CORES is greater than 1.
+ * Defaults to 0 if left undefined. */
+#define configUSE_TASK_GROUPS              0
+
 /******************************************************************************/
 /* Debugging assistance. ******************************************************/
 /******************************************************************************/
@@ -540,6 +693,15 @@
  * if left undefined. */
 #define configTASK_DEFAULT_CORE_AFFINITY          tskNO_AFFINITY
 
+/* When using SMP with core affinity feature enabled, set
+ * configUSE_PER_CORE_READY_LISTS to 1 to hold tasks that may only run on one
+ * core in ready lists of that core, and all other tasks in shared ready lists.
+ * A core selecting a task then searches only its own lists and the shared
+ * lists, rather than passing over tasks that are tied to other cores.  Requires
+ * configRUN_MULTIPLE_PRIORITIES to be set to 1.  Defaults to 0 if left
+ * undefined. */
+#define configUSE_PER_CORE_READY_LISTS            0
+
 /* When using SMP (i.e. configNUMBER_OF_CORES is greater than one), if
  * configUSE_TASK_PREEMPTION_DISABLE is set to 1, individual tasks can be set to
  * either pre-emptive or co-operative mode using the vTaskPreemptionDisable and
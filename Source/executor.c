@@ -0,0 +1,1152 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "executor.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include executor functionality. This #if is closed at the very bottom of
+ * this file. If you want to include executors then ensure configUSE_EXECUTORS
+ * is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_EXECUTORS == 1 )
+
+    #if ( configUSE_WAIT_ANY != 1 )
+        #error configUSE_WAIT_ANY must be set to 1 in FreeRTOSConfig.h to use executors.
+    #endif
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define executorYIELD_IF_USING_PREEMPTION()
+    #else
+        #define executorYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+/* Values of the ucState member of ExecutorHandler_t.  A handler that is
+ * waiting moves to PENDING, from any context, when the event it is waiting
+ * for happens.  All the other changes of state are made by the host task. */
+    #define executorSTATE_IDLE       ( ( uint8_t ) 0U ) /* Not in an executor, or finished. */
+    #define executorSTATE_READY      ( ( uint8_t ) 1U ) /* In one of the executor's ready chains. */
+    #define executorSTATE_RUNNING    ( ( uint8_t ) 2U ) /* Being called by the host task. */
+    #define executorSTATE_WAITING    ( ( uint8_t ) 3U ) /* Waiting for an event, and possibly in a delayed chain. */
+    #define executorSTATE_PENDING    ( ( uint8_t ) 4U ) /* In the executor's pending chain. */
+
+/* Bits of the ucFlags member of ExecutorHandler_t. */
+    #define executorFLAG_DELAYED               ( ( uint8_t ) 0x01U ) /* The handler is in one of the delayed chains. */
+    #define executorFLAG_AWAIT_NOTIFICATION    ( ( uint8_t ) 0x02U ) /* Waiting for xExecutorNotify(). */
+    #define executorFLAG_TIMED_OUT             ( ( uint8_t ) 0x04U ) /* The last wait timed out. */
+
+/*
+ * Handlers that are ready to run are held in one first in first out chain per
+ * priority, like the ready lists of tasks.  Handlers that are waiting with a
+ * timeout are held in one of two delayed chains ordered by wake time, the
+ * second of which holds the handlers whose wake time has overflowed the tick
+ * count, as in timers.c.  A handler is never ready and delayed at the same
+ * time, so both kinds of chain are linked through the same pxNext member of
+ * ExecutorHandler_t.  The delayed chains are also linked backwards through
+ * pxPrevious, so a handler whose event happens before its timeout is removed
+ * from them without searching.
+ *
+ * Events can happen in any context, but only the host task touches the ready
+ * and delayed chains, so a handler whose event has happened is first pushed
+ * onto pxPendingHandlers, from within a critical section, and moved to a ready
+ * chain the next time the host task runs.  The host task blocks on
+ * xContext.xTaskWaiting, which is the list that xWaitAnyNotifyReady() and
+ * xExecutorNotify() unblock.
+ */
+    typedef struct ExecutorDefinition
+    {
+        WaitAnyContext_t xContext;                                          /**< Shared by the await slots of all the handlers. */
+        ExecutorHandler_t * pxReadyHandlers[ configEXECUTOR_MAX_PRIORITIES ];   /**< The first ready handler of each priority. */
+        ExecutorHandler_t * pxLastReadyHandlers[ configEXECUTOR_MAX_PRIORITIES ]; /**< The last ready handler of each priority, valid only if there is a first. */
+        ExecutorHandler_t * pxDelayedHandlers;                              /**< The delayed chain currently being used. */
+        ExecutorHandler_t * pxOverflowDelayedHandlers;                      /**< The delayed chain currently being used to hold handlers that have overflowed the current tick count. */
+        ExecutorHandler_t * volatile pxPendingHandlers;                     /**< The most recent handler to become pending, linked to the others through pxNextPending. */
+        TickType_t xTimeNow;                                                /**< The tick count when the delayed chains were last checked. */
+        UBaseType_t uxTopReadyPriority;                                 /**< No ready handler has a priority above this. */
+    } Executor_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the members of a newly allocated executor.
+ */
+    static void prvInitialiseNewExecutor( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Pushes a handler onto the executor's pending chain.  Must be called from
+ * within a critical section.
+ */
+    static void prvMakeHandlerPending( ExecutorHandler_t * const pxHandler ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by xWaitAnyNotifyReady(), from within a critical section, when an
+ * object a handler is waiting for becomes ready.
+ */
+    static void prvHandlerReady( WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the host task if it is blocked.  Must be called from within a
+ * critical section.  Returns pdTRUE if the host task has a priority above the
+ * priority of the calling task.
+ */
+    static BaseType_t prvWakeHost( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Adds a handler to the end of the ready chain for its priority.
+ */
+    static void prvAddHandlerToReadyList( Executor_t * const pxExecutor,
+                                          ExecutorHandler_t * const pxHandler ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves all the pending handlers to the ready chains, in the order in which
+ * they became pending.
+ */
+    static void prvProcessPendingHandlers( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Inserts a handler into the delayed chain pointed to by ppxDelayedHandlers,
+ * in order of wake time.
+ */
+    static void prvInsertDelayedHandler( ExecutorHandler_t ** const ppxDelayedHandlers,
+                                         ExecutorHandler_t * const pxHandler ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes a handler from whichever of the delayed chains it is in, in constant
+ * time.
+ */
+    static void prvRemoveDelayedHandler( Executor_t * const pxExecutor,
+                                         const ExecutorHandler_t * const pxHandler ) PRIVILEGED_FUNCTION;
+
+/*
+ * Moves the handlers whose timeout has expired from the delayed chains to the
+ * ready chains.
+ */
+    static void prvProcessDelayedHandlers( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes the handler at the head of the current delayed chain, and makes it
+ * ready if it is still waiting.
+ */
+    static void prvTimeOutHandler( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the number of ticks until the next timeout expires, or portMAX_DELAY
+ * if no handler is delayed.
+ */
+    static TickType_t prvGetTicksToNextTimeout( const Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Blocks the host task until a handler becomes pending or xTicksToWait ticks
+ * have passed.
+ */
+    static void prvWaitForHandlers( Executor_t * const pxExecutor,
+                                    TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Runs the highest priority ready handler once.
+ */
+    static void prvRunHandler( Executor_t * const pxExecutor ) PRIVILEGED_FUNCTION;
+
+/*
+ * Common implementation of the vExecutorAwait...() functions.  The handler
+ * waits for the object described by pxAwaitSlot if it is not NULL, otherwise
+ * for what ucFlags says.
+ */
+    static void prvAwait( ExecutorHandler_t * const pxHandler,
+                          ExecutorAwaitSlot_t * const pxAwaitSlot,
+                          uint8_t ucFlags,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        ExecutorHandle_t xExecutorCreateStatic( StaticExecutor_t * pxExecutorBuffer )
+        {
+            Executor_t * pxExecutor = NULL;
+
+            traceENTER_xExecutorCreateStatic( pxExecutorBuffer );
+
+            configASSERT( pxExecutorBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticExecutor_t equals the size of the real
+                 * executor structure. */
+                volatile size_t xSize = sizeof( StaticExecutor_t );
+                configASSERT( xSize == sizeof( Executor_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            if( pxExecutorBuffer != NULL )
+            {
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxExecutor = ( Executor_t * ) pxExecutorBuffer;
+
+                prvInitialiseNewExecutor( pxExecutor );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xExecutorCreateStatic( pxExecutor );
+
+            return pxExecutor;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        ExecutorHandle_t xExecutorCreate( void )
+        {
+            Executor_t * pxExecutor;
+
+            traceENTER_xExecutorCreate();
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxExecutor = ( Executor_t * ) pvPortMalloc( sizeof( Executor_t ) );
+
+            if( pxExecutor != NULL )
+            {
+                prvInitialiseNewExecutor( pxExecutor );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xExecutorCreate( pxExecutor );
+
+            return pxExecutor;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    void vExecutorRun( ExecutorHandle_t xExecutor )
+    {
+        Executor_t * const pxExecutor = xExecutor;
+        TickType_t xTicksToWait;
+
+        traceENTER_vExecutorRun( xExecutor );
+
+        configASSERT( pxExecutor );
+
+        for( ; ; )
+        {
+            prvProcessPendingHandlers( pxExecutor );
+            prvProcessDelayedHandlers( pxExecutor );
+
+            /* Run one handler at a time, so a handler that becomes ready while
+             * another is running is considered before the next handler is
+             * chosen. */
+            while( ( pxExecutor->uxTopReadyPriority > ( UBaseType_t ) 0U ) &&
+                   ( pxExecutor->pxReadyHandlers[ pxExecutor->uxTopReadyPriority ] == NULL ) )
+            {
+                pxExecutor->uxTopReadyPriority--;
+            }
+
+            if( pxExecutor->pxReadyHandlers[ pxExecutor->uxTopReadyPriority ] != NULL )
+            {
+                prvRunHandler( pxExecutor );
+            }
+            else
+            {
+                xTicksToWait = prvGetTicksToNextTimeout( pxExecutor );
+
+                if( xTicksToWait != ( TickType_t ) 0 )
+                {
+                    prvWaitForHandlers( pxExecutor, xTicksToWait );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorAddHandler( ExecutorHandle_t xExecutor,
+                              ExecutorHandler_t * pxHandler,
+                              ExecutorHandlerFunction_t pxHandlerFunction,
+                              void * pvParameters,
+                              UBaseType_t uxPriority )
+    {
+        Executor_t * const pxExecutor = xExecutor;
+        BaseType_t xYieldRequired;
+
+        traceENTER_vExecutorAddHandler( xExecutor, pxHandler, pxHandlerFunction, pvParameters, uxPriority );
+
+        configASSERT( pxExecutor );
+        configASSERT( pxHandler );
+        configASSERT( pxHandlerFunction );
+        configASSERT( uxPriority < ( UBaseType_t ) configEXECUTOR_MAX_PRIORITIES );
+
+        pxHandler->pxNext = NULL;
+        pxHandler->pxPrevious = NULL;
+        pxHandler->pxNextPending = NULL;
+        pxHandler->pxAwaitSlot = NULL;
+        pxHandler->xExecutor = pxExecutor;
+        pxHandler->pxHandlerFunction = pxHandlerFunction;
+        pxHandler->pvParameters = pvParameters;
+        pxHandler->ulNotifiedValue = 0U;
+        pxHandler->usResumePoint = 0U;
+        pxHandler->ucFlags = 0U;
+
+        if( uxPriority >= ( UBaseType_t ) configEXECUTOR_MAX_PRIORITIES )
+        {
+            pxHandler->uxPriority = ( UBaseType_t ) configEXECUTOR_MAX_PRIORITIES - ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            pxHandler->uxPriority = uxPriority;
+        }
+
+        taskENTER_CRITICAL();
+        {
+            prvMakeHandlerPending( pxHandler );
+            xYieldRequired = prvWakeHost( pxExecutor );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            executorYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vExecutorAddHandler();
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorAwaitQueue( ExecutorHandler_t * pxHandler,
+                              ExecutorAwaitSlot_t * pxAwaitSlot,
+                              QueueHandle_t xQueue,
+                              TickType_t xTicksToWait )
+    {
+        traceENTER_vExecutorAwaitQueue( pxHandler, pxAwaitSlot, xQueue, xTicksToWait );
+
+        configASSERT( pxHandler );
+        configASSERT( pxAwaitSlot );
+
+        vWaitAnySetQueue( &( pxAwaitSlot->xObject ), xQueue );
+        prvAwait( pxHandler, pxAwaitSlot, 0U, xTicksToWait );
+
+        traceRETURN_vExecutorAwaitQueue();
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUPS == 1 )
+
+        void vExecutorAwaitEventGroup( ExecutorHandler_t * pxHandler,
+                                       ExecutorAwaitSlot_t * pxAwaitSlot,
+                                       EventGroupHandle_t xEventGroup,
+                                       EventBits_t uxBitsToWaitFor,
+                                       TickType_t xTicksToWait )
+        {
+            traceENTER_vExecutorAwaitEventGroup( pxHandler, pxAwaitSlot, xEventGroup, uxBitsToWaitFor, xTicksToWait );
+
+            configASSERT( pxHandler );
+            configASSERT( pxAwaitSlot );
+
+            vWaitAnySetEventGroup( &( pxAwaitSlot->xObject ), xEventGroup, uxBitsToWaitFor );
+            prvAwait( pxHandler, pxAwaitSlot, 0U, xTicksToWait );
+
+            traceRETURN_vExecutorAwaitEventGroup();
+        }
+
+    #endif /* configUSE_EVENT_GROUPS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFERS == 1 )
+
+        void vExecutorAwaitStreamBuffer( ExecutorHandler_t * pxHandler,
+                                         ExecutorAwaitSlot_t * pxAwaitSlot,
+                                         StreamBufferHandle_t xStreamBuffer,
+                                         TickType_t xTicksToWait )
+        {
+            traceENTER_vExecutorAwaitStreamBuffer( pxHandler, pxAwaitSlot, xStreamBuffer, xTicksToWait );
+
+            configASSERT( pxHandler );
+            configASSERT( pxAwaitSlot );
+
+            vWaitAnySetStreamBuffer( &( pxAwaitSlot->xObject ), xStreamBuffer );
+            prvAwait( pxHandler, pxAwaitSlot, 0U, xTicksToWait );
+
+            traceRETURN_vExecutorAwaitStreamBuffer();
+        }
+
+    #endif /* configUSE_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    void vExecutorAwaitNotification( ExecutorHandler_t * pxHandler,
+                                     TickType_t xTicksToWait )
+    {
+        traceENTER_vExecutorAwaitNotification( pxHandler, xTicksToWait );
+
+        configASSERT( pxHandler );
+
+        prvAwait( pxHandler, NULL, executorFLAG_AWAIT_NOTIFICATION, xTicksToWait );
+
+        traceRETURN_vExecutorAwaitNotification();
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorDelay( ExecutorHandler_t * pxHandler,
+                         TickType_t xTicksToDelay )
+    {
+        traceENTER_vExecutorDelay( pxHandler, xTicksToDelay );
+
+        configASSERT( pxHandler );
+
+        /* Nothing can make the handler ready, so it runs again when the delay
+         * times out. */
+        prvAwait( pxHandler, NULL, 0U, xTicksToDelay );
+
+        traceRETURN_vExecutorDelay();
+    }
+/*-----------------------------------------------------------*/
+
+    void vExecutorYield( ExecutorHandler_t * pxHandler )
+    {
+        traceENTER_vExecutorYield( pxHandler );
+
+        configASSERT( pxHandler );
+        configASSERT( pxHandler->ucState == executorSTATE_RUNNING );
+
+        /* prvRunHandler() places the handler at the end of its ready chain
+         * when it returns. */
+        pxHandler->ucFlags = 0U;
+        pxHandler->ucState = executorSTATE_READY;
+
+        traceRETURN_vExecutorYield();
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorTimedOut( const ExecutorHandler_t * pxHandler )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xExecutorTimedOut( pxHandler );
+
+        configASSERT( pxHandler );
+
+        if( ( pxHandler->ucFlags & executorFLAG_TIMED_OUT ) != 0U )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xExecutorTimedOut( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorNotify( ExecutorHandler_t * pxHandler,
+                                uint32_t ulBitsToSet )
+    {
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xExecutorNotify( pxHandler, ulBitsToSet );
+
+        configASSERT( pxHandler );
+        configASSERT( ulBitsToSet != 0U );
+
+        taskENTER_CRITICAL();
+        {
+            pxHandler->ulNotifiedValue |= ulBitsToSet;
+
+            if( ( pxHandler->ucState == executorSTATE_WAITING ) &&
+                ( ( pxHandler->ucFlags & executorFLAG_AWAIT_NOTIFICATION ) != 0U ) )
+            {
+                prvMakeHandlerPending( pxHandler );
+                xYieldRequired = prvWakeHost( pxHandler->xExecutor );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            executorYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xExecutorNotify( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xExecutorNotifyFromISR( ExecutorHandler_t * pxHandler,
+                                       uint32_t ulBitsToSet,
+                                       BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xExecutorNotifyFromISR( pxHandler, ulBitsToSet, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxHandler );
+        configASSERT( ulBitsToSet != 0U );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum system call (or maximum API call) interrupt priority.
+         * Interrupts that are above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            pxHandler->ulNotifiedValue |= ulBitsToSet;
+
+            if( ( pxHandler->ucState == executorSTATE_WAITING ) &&
+                ( ( pxHandler->ucFlags & executorFLAG_AWAIT_NOTIFICATION ) != 0U ) )
+            {
+                prvMakeHandlerPending( pxHandler );
+
+                if( ( prvWakeHost( pxHandler->xExecutor ) != pdFALSE ) &&
+                    ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xExecutorNotifyFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    uint32_t ulExecutorTakeNotification( ExecutorHandler_t * pxHandler )
+    {
+        uint32_t ulReturn;
+
+        traceENTER_ulExecutorTakeNotification( pxHandler );
+
+        configASSERT( pxHandler );
+
+        taskENTER_CRITICAL();
+        {
+            ulReturn = pxHandler->ulNotifiedValue;
+            pxHandler->ulNotifiedValue = 0U;
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_ulExecutorTakeNotification( ulReturn );
+
+        return ulReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewExecutor( Executor_t * const pxExecutor )
+    {
+        UBaseType_t uxPriority;
+
+        vListInitialise( &( pxExecutor->xContext.xTaskWaiting ) );
+        pxExecutor->xContext.pxReady = NULL;
+        pxExecutor->xContext.pxReadyFunction = prvHandlerReady;
+
+        for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configEXECUTOR_MAX_PRIORITIES; uxPriority++ )
+        {
+            pxExecutor->pxReadyHandlers[ uxPriority ] = NULL;
+            pxExecutor->pxLastReadyHandlers[ uxPriority ] = NULL;
+        }
+
+        pxExecutor->pxDelayedHandlers = NULL;
+        pxExecutor->pxOverflowDelayedHandlers = NULL;
+        pxExecutor->pxPendingHandlers = NULL;
+        pxExecutor->xTimeNow = xTaskGetTickCount();
+        pxExecutor->uxTopReadyPriority = ( UBaseType_t ) 0U;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvMakeHandlerPending( ExecutorHandler_t * const pxHandler )
+    {
+        Executor_t * const pxExecutor = pxHandler->xExecutor;
+
+        pxHandler->ucState = executorSTATE_PENDING;
+        pxHandler->pxNextPending = pxExecutor->pxPendingHandlers;
+        pxExecutor->pxPendingHandlers = pxHandler;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvHandlerReady( WaitAnyObject_t * pxObject )
+    {
+        ExecutorHandler_t * pxHandler;
+
+        /* xObject is the first member of ExecutorAwaitSlot_t. */
+        /* MISRA Ref 11.3.2 [Containing structure] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+        /* coverity[misra_c_2012_rule_11_3_violation] */
+        pxHandler = ( ( ExecutorAwaitSlot_t * ) pxObject )->pxHandler;
+
+        /* The object stays linked in until the host task unlinks it, so it can
+         * report ready again after the handler has become pending. */
+        if( pxHandler->ucState == executorSTATE_WAITING )
+        {
+            prvMakeHandlerPending( pxHandler );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvWakeHost( Executor_t * const pxExecutor )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        if( listLIST_IS_EMPTY( &( pxExecutor->xContext.xTaskWaiting ) ) == pdFALSE )
+        {
+            xReturn = xTaskRemoveFromEventList( &( pxExecutor->xContext.xTaskWaiting ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAddHandlerToReadyList( Executor_t * const pxExecutor,
+                                          ExecutorHandler_t * const pxHandler )
+    {
+        const UBaseType_t uxPriority = pxHandler->uxPriority;
+
+        if( uxPriority > pxExecutor->uxTopReadyPriority )
+        {
+            pxExecutor->uxTopReadyPriority = uxPriority;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxHandler->ucState = executorSTATE_READY;
+        pxHandler->pxNext = NULL;
+
+        if( pxExecutor->pxReadyHandlers[ uxPriority ] == NULL )
+        {
+            pxExecutor->pxReadyHandlers[ uxPriority ] = pxHandler;
+        }
+        else
+        {
+            pxExecutor->pxLastReadyHandlers[ uxPriority ]->pxNext = pxHandler;
+        }
+
+        pxExecutor->pxLastReadyHandlers[ uxPriority ] = pxHandler;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvProcessPendingHandlers( Executor_t * const pxExecutor )
+    {
+        ExecutorHandler_t * pxPending;
+        ExecutorHandler_t * pxReversed = NULL;
+        ExecutorHandler_t * pxHandler;
+
+        taskENTER_CRITICAL();
+        {
+            pxPending = pxExecutor->pxPendingHandlers;
+            pxExecutor->pxPendingHandlers = NULL;
+        }
+        taskEXIT_CRITICAL();
+
+        /* The pending chain is a stack, so reverse it to make the handlers
+         * ready in the order in which their events happened. */
+        while( pxPending != NULL )
+        {
+            pxHandler = pxPending;
+            pxPending = pxHandler->pxNextPending;
+            pxHandler->pxNextPending = pxReversed;
+            pxReversed = pxHandler;
+        }
+
+        while( pxReversed != NULL )
+        {
+            pxHandler = pxReversed;
+            pxReversed = pxHandler->pxNextPending;
+
+            /* Nothing else changes the state of a pending handler, but the
+             * object it waited for can still report ready until it is
+             * unlinked. */
+            if( pxHandler->pxAwaitSlot != NULL )
+            {
+                taskENTER_CRITICAL();
+                {
+                    vWaitAnyRemoveObject( &( pxExecutor->xContext ), &( pxHandler->pxAwaitSlot->xObject ) );
+                }
+                taskEXIT_CRITICAL();
+
+                pxHandler->pxAwaitSlot = NULL;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( ( pxHandler->ucFlags & executorFLAG_DELAYED ) != 0U )
+            {
+                prvRemoveDelayedHandler( pxExecutor, pxHandler );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxHandler->ucFlags = 0U;
+            prvAddHandlerToReadyList( pxExecutor, pxHandler );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInsertDelayedHandler( ExecutorHandler_t ** const ppxDelayedHandlers,
+                                         ExecutorHandler_t * const pxHandler )
+    {
+        ExecutorHandler_t * pxPrevious = NULL;
+        ExecutorHandler_t * pxNext = *ppxDelayedHandlers;
+
+        /* Handlers with the same wake time time out in the order in which they
+         * were delayed, as with vListInsert(). */
+        while( ( pxNext != NULL ) && ( pxNext->xTimeToWake <= pxHandler->xTimeToWake ) )
+        {
+            pxPrevious = pxNext;
+            pxNext = pxNext->pxNext;
+        }
+
+        pxHandler->pxPrevious = pxPrevious;
+        pxHandler->pxNext = pxNext;
+
+        if( pxPrevious == NULL )
+        {
+            *ppxDelayedHandlers = pxHandler;
+        }
+        else
+        {
+            pxPrevious->pxNext = pxHandler;
+        }
+
+        if( pxNext != NULL )
+        {
+            pxNext->pxPrevious = pxHandler;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRemoveDelayedHandler( Executor_t * const pxExecutor,
+                                         const ExecutorHandler_t * const pxHandler )
+    {
+        if( pxHandler->pxPrevious != NULL )
+        {
+            pxHandler->pxPrevious->pxNext = pxHandler->pxNext;
+        }
+        else if( pxExecutor->pxDelayedHandlers == pxHandler )
+        {
+            pxExecutor->pxDelayedHandlers = pxHandler->pxNext;
+        }
+        else
+        {
+            /* The handler's wake time has overflowed the tick count. */
+            configASSERT( pxExecutor->pxOverflowDelayedHandlers == pxHandler );
+            pxExecutor->pxOverflowDelayedHandlers = pxHandler->pxNext;
+        }
+
+        if( pxHandler->pxNext != NULL )
+        {
+            pxHandler->pxNext->pxPrevious = pxHandler->pxPrevious;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvProcessDelayedHandlers( Executor_t * const pxExecutor )
+    {
+        TickType_t xTimeNow;
+        ExecutorHandler_t * pxTemp;
+
+        xTimeNow = xTaskGetTickCount();
+
+        /* If the tick count has overflowed since the chains were last checked
+         * then every handler in the current chain has timed out, and the
+         * overflow chain becomes the current chain. */
+        if( xTimeNow < pxExecutor->xTimeNow )
+        {
+            while( pxExecutor->pxDelayedHandlers != NULL )
+            {
+                prvTimeOutHandler( pxExecutor );
+            }
+
+            pxTemp = pxExecutor->pxDelayedHandlers;
+            pxExecutor->pxDelayedHandlers = pxExecutor->pxOverflowDelayedHandlers;
+            pxExecutor->pxOverflowDelayedHandlers = pxTemp;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxExecutor->xTimeNow = xTimeNow;
+
+        while( ( pxExecutor->pxDelayedHandlers != NULL ) &&
+               ( pxExecutor->pxDelayedHandlers->xTimeToWake <= xTimeNow ) )
+        {
+            prvTimeOutHandler( pxExecutor );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvTimeOutHandler( Executor_t * const pxExecutor )
+    {
+        ExecutorHandler_t * const pxHandler = pxExecutor->pxDelayedHandlers;
+        BaseType_t xTimedOut = pdFALSE;
+
+        prvRemoveDelayedHandler( pxExecutor, pxHandler );
+
+        /* The event may have happened at the same time, in which case the
+         * handler is pending and is made ready by prvProcessPendingHandlers()
+         * instead. */
+        taskENTER_CRITICAL();
+        {
+            pxHandler->ucFlags = ( uint8_t ) ( pxHandler->ucFlags & ( uint8_t ) ~executorFLAG_DELAYED );
+
+            if( pxHandler->ucState == executorSTATE_WAITING )
+            {
+                if( pxHandler->pxAwaitSlot != NULL )
+                {
+                    vWaitAnyRemoveObject( &( pxExecutor->xContext ), &( pxHandler->pxAwaitSlot->xObject ) );
+                    pxHandler->pxAwaitSlot = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Stop notifications from making the handler pending. */
+                pxHandler->ucState = executorSTATE_READY;
+                xTimedOut = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xTimedOut != pdFALSE )
+        {
+            pxHandler->ucFlags = executorFLAG_TIMED_OUT;
+            prvAddHandlerToReadyList( pxExecutor, pxHandler );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvGetTicksToNextTimeout( const Executor_t * const pxExecutor )
+    {
+        TickType_t xReturn;
+        TickType_t xTimeNow;
+        TickType_t xNextWakeTime;
+
+        xTimeNow = xTaskGetTickCount();
+
+        if( xTimeNow < pxExecutor->xTimeNow )
+        {
+            /* The tick count has overflowed, so the delayed chains must be
+             * checked straight away. */
+            xReturn = ( TickType_t ) 0;
+        }
+        else if( pxExecutor->pxDelayedHandlers != NULL )
+        {
+            xNextWakeTime = pxExecutor->pxDelayedHandlers->xTimeToWake;
+
+            if( xNextWakeTime <= xTimeNow )
+            {
+                xReturn = ( TickType_t ) 0;
+            }
+            else
+            {
+                xReturn = xNextWakeTime - xTimeNow;
+            }
+        }
+        else if( pxExecutor->pxOverflowDelayedHandlers != NULL )
+        {
+            /* The subtraction wraps to give the time remaining until a wake
+             * time that is beyond the overflow of the tick count. */
+            xNextWakeTime = pxExecutor->pxOverflowDelayedHandlers->xTimeToWake;
+            xReturn = xNextWakeTime - xTimeNow;
+        }
+        else
+        {
+            xReturn = portMAX_DELAY;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvWaitForHandlers( Executor_t * const pxExecutor,
+                                    TickType_t xTicksToWait )
+    {
+        BaseType_t xShouldBlock = pdFALSE;
+        BaseType_t xAlreadyYielded;
+
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                if( pxExecutor->pxPendingHandlers == NULL )
+                {
+                    traceBLOCKING_ON_EXECUTOR( pxExecutor );
+                    vTaskPlaceOnEventList( &( pxExecutor->xContext.xTaskWaiting ), xTicksToWait );
+                    xShouldBlock = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRunHandler( Executor_t * const pxExecutor )
+    {
+        ExecutorHandler_t * const pxHandler = pxExecutor->pxReadyHandlers[ pxExecutor->uxTopReadyPriority ];
+
+        pxExecutor->pxReadyHandlers[ pxExecutor->uxTopReadyPriority ] = pxHandler->pxNext;
+
+        pxHandler->ucState = executorSTATE_RUNNING;
+        traceEXECUTOR_HANDLER_RUN( pxHandler );
+        pxHandler->pxHandlerFunction( pxHandler, pxHandler->pvParameters );
+
+        if( pxHandler->ucState == executorSTATE_RUNNING )
+        {
+            /* The handler returned without awaiting anything, so it has
+             * finished. */
+            pxHandler->ucState = executorSTATE_IDLE;
+        }
+        else if( pxHandler->ucState == executorSTATE_READY )
+        {
+            /* The handler yielded, or what it awaited was already ready. */
+            prvAddHandlerToReadyList( pxExecutor, pxHandler );
+        }
+        else
+        {
+            /* The handler is waiting, or became pending while it was still
+             * running. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvAwait( ExecutorHandler_t * const pxHandler,
+                          ExecutorAwaitSlot_t * const pxAwaitSlot,
+                          uint8_t ucFlags,
+                          TickType_t xTicksToWait )
+    {
+        Executor_t * const pxExecutor = pxHandler->xExecutor;
+        BaseType_t xReady = pdFALSE;
+        BaseType_t xDelay = pdFALSE;
+
+        /* Only a handler that is running can wait, and it can only wait for
+         * one thing at a time. */
+        configASSERT( pxHandler->ucState == executorSTATE_RUNNING );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxAwaitSlot != NULL )
+            {
+                pxAwaitSlot->pxHandler = pxHandler;
+                xReady = xWaitAnyAddObject( &( pxExecutor->xContext ), &( pxAwaitSlot->xObject ) );
+
+                /* The slot only stays linked in if the handler is going to
+                 * wait. */
+                if( ( xReady != pdFALSE ) || ( xTicksToWait == ( TickType_t ) 0 ) )
+                {
+                    vWaitAnyRemoveObject( &( pxExecutor->xContext ), &( pxAwaitSlot->xObject ) );
+                }
+                else
+                {
+                    pxHandler->pxAwaitSlot = pxAwaitSlot;
+                }
+            }
+            else if( ( ucFlags & executorFLAG_AWAIT_NOTIFICATION ) != 0U )
+            {
+                if( pxHandler->ulNotifiedValue != 0U )
+                {
+                    xReady = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xReady != pdFALSE )
+            {
+                pxHandler->ucFlags = 0U;
+                pxHandler->ucState = executorSTATE_READY;
+            }
+            else if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                pxHandler->ucFlags = executorFLAG_TIMED_OUT;
+                pxHandler->ucState = executorSTATE_READY;
+            }
+            else if( xTicksToWait != portMAX_DELAY )
+            {
+                pxHandler->ucFlags = ( uint8_t ) ( ucFlags | executorFLAG_DELAYED );
+                pxHandler->ucState = executorSTATE_WAITING;
+                xDelay = pdTRUE;
+            }
+            else
+            {
+                pxHandler->ucFlags = ucFlags;
+                pxHandler->ucState = executorSTATE_WAITING;
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        /* Only the host task uses the delayed chains, so the handler can be
+         * placed in one outside the critical section, even if it has become
+         * pending in the meantime. */
+        if( xDelay != pdFALSE )
+        {
+            /* Delays are measured from the time the delayed chains were last
+             * checked, which is just before the handler started running, so
+             * the handler cannot be placed in the wrong chain if the tick count
+             * has overflowed since. */
+            pxHandler->xTimeToWake = pxExecutor->xTimeNow + xTicksToWait;
+
+            if( pxHandler->xTimeToWake < pxExecutor->xTimeNow )
+            {
+                /* Wake time has overflowed.  Place this handler in the
+                 * overflow chain. */
+                prvInsertDelayedHandler( &( pxExecutor->pxOverflowDelayedHandlers ), pxHandler );
+            }
+            else
+            {
+                /* The wake time has not overflowed, so the current chain is
+                 * used. */
+                prvInsertDelayedHandler( &( pxExecutor->pxDelayedHandlers ), pxHandler );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include executor functionality. If you want to include executors then
+ * ensure configUSE_EXECUTORS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_EXECUTORS == 1 */
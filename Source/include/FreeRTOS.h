@@ -94,6 +94,60 @@
     #define configUSE_MALLOC_FAILED_HOOK    0
 #endif
 
+/* Set configHEAP_INCREMENTAL_STATS to 1 to have heap_4.c and heap_5.c maintain
+ * the free block statistics as blocks are allocated and freed, rather than
+ * walking the free list each time vPortGetHeapStats() is called. */
+#ifndef configHEAP_INCREMENTAL_STATS
+    #define configHEAP_INCREMENTAL_STATS    0
+#endif
+
+/* The number of size buckets in the free block histogram returned by
+ * vPortGetHeapHistogram().  Only used if configHEAP_INCREMENTAL_STATS is 1. */
+#ifndef configHEAP_HISTOGRAM_BUCKETS
+    #define configHEAP_HISTOGRAM_BUCKETS    16
+#endif
+
+/* Set configUSE_ALLOC_TRACE to 1 to have alloc_trace.c record every live heap
+ * allocation, together with its call site and owning task. */
+#ifndef configUSE_ALLOC_TRACE
+    #define configUSE_ALLOC_TRACE    0
+#endif
+
+/* The maximum number of live allocations that can be recorded at once. */
+#ifndef configALLOC_TRACE_MAX_RECORDS
+    #define configALLOC_TRACE_MAX_RECORDS    64
+#endif
+
+/* Returns the return address of the function in which it is used, which when
+ * used in traceMALLOC() is the call site of pvPortMalloc(). */
+#ifndef configALLOC_TRACE_GET_CALLER
+    #if defined( __GNUC__ )
+        #define configALLOC_TRACE_GET_CALLER()    __builtin_return_address( 0 )
+    #else
+        #define configALLOC_TRACE_GET_CALLER()    NULL
+    #endif
+#endif
+
+/* The number of task control blocks, queues, software timers and event groups
+ * that are held in preallocated arenas rather than being allocated from the
+ * FreeRTOS heap when the object is created dynamically.  0 disables the arena
+ * for that object type. */
+#ifndef configTASK_ARENA_SIZE
+    #define configTASK_ARENA_SIZE    0
+#endif
+
+#ifndef configQUEUE_ARENA_SIZE
+    #define configQUEUE_ARENA_SIZE    0
+#endif
+
+#ifndef configTIMER_ARENA_SIZE
+    #define configTIMER_ARENA_SIZE    0
+#endif
+
+#ifndef configEVENT_GROUP_ARENA_SIZE
+    #define configEVENT_GROUP_ARENA_SIZE    0
+#endif
+
 #ifndef configASSERT
     #define configASSERT( x )
     #define configASSERT_DEFINED    0
@@ -518,6 +572,10 @@
     #endif
 #endif
 
+#ifndef configUSE_PER_CORE_READY_LISTS
+    #define configUSE_PER_CORE_READY_LISTS    0
+#endif
+
 #ifndef configUSE_PASSIVE_IDLE_HOOK
     #define configUSE_PASSIVE_IDLE_HOOK    0
 #endif /* configUSE_PASSIVE_IDLE_HOOK */
@@ -895,11 +953,19 @@
 #endif
 
 #ifndef traceMALLOC
-    #define traceMALLOC( pvAddress, uiSize )
+    #if ( configUSE_ALLOC_TRACE == 1 )
+        #define traceMALLOC( pvAddress, uiSize )    vAllocTraceRecordMalloc( ( pvAddress ), ( uiSize ), configALLOC_TRACE_GET_CALLER() )
+    #else
+        #define traceMALLOC( pvAddress, uiSize )
+    #endif
 #endif
 
 #ifndef traceFREE
-    #define traceFREE( pvAddress, uiSize )
+    #if ( configUSE_ALLOC_TRACE == 1 )
+        #define traceFREE( pvAddress, uiSize )    vAllocTraceRecordFree( pvAddress )
+    #else
+        #define traceFREE( pvAddress, uiSize )
+    #endif
 #endif
 
 #ifndef traceEVENT_GROUP_CREATE
@@ -1026,6 +1092,54 @@
     #define traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer )
 #endif
 
+#ifndef traceBLOCKING_ON_WAIT_ANY
+    #define traceBLOCKING_ON_WAIT_ANY( pxObjects, uxObjectCount )
+#endif
+
+#ifndef traceBLOCKING_ON_BROADCAST_RECEIVE
+    #define traceBLOCKING_ON_BROADCAST_RECEIVE( xChannel )
+#endif
+
+#ifndef traceBROADCAST_PUBLISH
+    #define traceBROADCAST_PUBLISH( xChannel )
+#endif
+
+#ifndef traceBLOCKING_ON_EXECUTOR
+    #define traceBLOCKING_ON_EXECUTOR( xExecutor )
+#endif
+
+#ifndef traceEXECUTOR_HANDLER_RUN
+    #define traceEXECUTOR_HANDLER_RUN( pxHandler )
+#endif
+
+#ifndef traceBLOCKING_ON_TASK_GROUP
+    #define traceBLOCKING_ON_TASK_GROUP( xGroup )
+#endif
+
+#ifndef traceTASK_GROUP_MEMBER_RUN
+    #define traceTASK_GROUP_MEMBER_RUN( pxMember, ulEvents )
+#endif
+
+#ifndef traceTASK_EDF_DEADLINE_MISSED
+    #define traceTASK_EDF_DEADLINE_MISSED( pxTask, xLateness )
+#endif
+
+#ifndef traceTASK_BUDGET_EXHAUSTED
+    #define traceTASK_BUDGET_EXHAUSTED( pxTask )
+#endif
+
+#ifndef traceTASK_BUDGET_REPLENISHED
+    #define traceTASK_BUDGET_REPLENISHED( pxTask )
+#endif
+
+#ifndef traceTASK_PERIODIC_DEADLINE_MISSED
+    #define traceTASK_PERIODIC_DEADLINE_MISSED( pxTask, xLateness )
+#endif
+
+#ifndef traceBROADCAST_OVERRUN
+    #define traceBROADCAST_OVERRUN( xChannel, uxItemsLost )
+#endif
+
 #ifndef traceSTREAM_BUFFER_SEND
     #define traceSTREAM_BUFFER_SEND( xStreamBuffer, xBytesSent )
 #endif
@@ -1486,6 +1600,14 @@
     #define traceRETURN_vQueueWaitForMessageRestricted()
 #endif
 
+#ifndef traceENTER_xQueueRequeueWaitingTasks
+    #define traceENTER_xQueueRequeueWaitingTasks( xMutex, pxEventList )
+#endif
+
+#ifndef traceRETURN_xQueueRequeueWaitingTasks
+    #define traceRETURN_xQueueRequeueWaitingTasks( xReturn )
+#endif
+
 #ifndef traceENTER_xQueueCreateSet
     #define traceENTER_xQueueCreateSet( uxEventQueueLength )
 #endif
@@ -2082,6 +2204,14 @@
     #define traceRETURN_vTaskPlaceOnUnorderedEventList()
 #endif
 
+#ifndef traceENTER_vTaskPlaceOnFIFOEventList
+    #define traceENTER_vTaskPlaceOnFIFOEventList( pxEventList, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vTaskPlaceOnFIFOEventList
+    #define traceRETURN_vTaskPlaceOnFIFOEventList()
+#endif
+
 #ifndef traceENTER_vTaskPlaceOnEventListRestricted
     #define traceENTER_vTaskPlaceOnEventListRestricted( pxEventList, xTicksToWait, xWaitIndefinitely )
 #endif
@@ -2330,6 +2460,30 @@
     #define traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB )
 #endif
 
+#ifndef traceENTER_xTaskDecrementMutexHeldCount
+    #define traceENTER_xTaskDecrementMutexHeldCount()
+#endif
+
+#ifndef traceRETURN_xTaskDecrementMutexHeldCount
+    #define traceRETURN_xTaskDecrementMutexHeldCount( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskPriorityRaiseToCeiling
+    #define traceENTER_vTaskPriorityRaiseToCeiling( uxCeilingPriority )
+#endif
+
+#ifndef traceRETURN_vTaskPriorityRaiseToCeiling
+    #define traceRETURN_vTaskPriorityRaiseToCeiling()
+#endif
+
+#ifndef traceENTER_vTaskSetMutexWaitedOn
+    #define traceENTER_vTaskSetMutexWaitedOn( pxMutexHolder )
+#endif
+
+#ifndef traceRETURN_vTaskSetMutexWaitedOn
+    #define traceRETURN_vTaskSetMutexWaitedOn()
+#endif
+
 #ifndef traceENTER_ulTaskGenericNotifyTake
     #define traceENTER_ulTaskGenericNotifyTake( uxIndexToWaitOn, xClearCountOnExit, xTicksToWait )
 #endif
@@ -2482,6 +2636,14 @@
     #define traceRETURN_xStreamBufferSetTriggerLevel( xReturn )
 #endif
 
+#ifndef traceENTER_xStreamBufferSetNotificationCoalescing
+    #define traceENTER_xStreamBufferSetNotificationCoalescing( xStreamBuffer, xCoalesceBytes, xCoalesceTicks )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSetNotificationCoalescing
+    #define traceRETURN_xStreamBufferSetNotificationCoalescing( xReturn )
+#endif
+
 #ifndef traceENTER_xStreamBufferSpacesAvailable
     #define traceENTER_xStreamBufferSpacesAvailable( xStreamBuffer )
 #endif
@@ -2514,6 +2676,22 @@
     #define traceRETURN_xStreamBufferSendFromISR( xReturn )
 #endif
 
+#ifndef traceENTER_xStreamBufferSendV
+    #define traceENTER_xStreamBufferSendV( xStreamBuffer, pxVectors, xVectorCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendV
+    #define traceRETURN_xStreamBufferSendV( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferSendVFromISR
+    #define traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferSendVFromISR
+    #define traceRETURN_xStreamBufferSendVFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_xStreamBufferReceive
     #define traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait )
 #endif
@@ -2538,6 +2716,102 @@
     #define traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength )
 #endif
 
+#ifndef traceENTER_xStreamBufferReceiveV
+    #define traceENTER_xStreamBufferReceiveV( xStreamBuffer, pxVectors, xVectorCount, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveV
+    #define traceRETURN_xStreamBufferReceiveV( xReceivedLength )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceiveVFromISR
+    #define traceENTER_xStreamBufferReceiveVFromISR( xStreamBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveVFromISR
+    #define traceRETURN_xStreamBufferReceiveVFromISR( xReceivedLength )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceiveBatch
+    #define traceENTER_xStreamBufferReceiveBatch( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveBatch
+    #define traceRETURN_xStreamBufferReceiveBatch( xMessages )
+#endif
+
+#ifndef traceENTER_xStreamBufferReceiveBatchFromISR
+    #define traceENTER_xStreamBufferReceiveBatchFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReceiveBatchFromISR
+    #define traceRETURN_xStreamBufferReceiveBatchFromISR( xMessages )
+#endif
+
+#ifndef traceENTER_xStreamBufferAcquireWrite
+    #define traceENTER_xStreamBufferAcquireWrite( xStreamBuffer, ppvData, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferAcquireWrite
+    #define traceRETURN_xStreamBufferAcquireWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferAcquireWriteFromISR
+    #define traceENTER_xStreamBufferAcquireWriteFromISR( xStreamBuffer, ppvData )
+#endif
+
+#ifndef traceRETURN_xStreamBufferAcquireWriteFromISR
+    #define traceRETURN_xStreamBufferAcquireWriteFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWrite
+    #define traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xDataLengthBytes )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWrite
+    #define traceRETURN_xStreamBufferCommitWrite( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferCommitWriteFromISR
+    #define traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferCommitWriteFromISR
+    #define traceRETURN_xStreamBufferCommitWriteFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferAcquireRead
+    #define traceENTER_xStreamBufferAcquireRead( xStreamBuffer, ppvData, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xStreamBufferAcquireRead
+    #define traceRETURN_xStreamBufferAcquireRead( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferAcquireReadFromISR
+    #define traceENTER_xStreamBufferAcquireReadFromISR( xStreamBuffer, ppvData )
+#endif
+
+#ifndef traceRETURN_xStreamBufferAcquireReadFromISR
+    #define traceRETURN_xStreamBufferAcquireReadFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReleaseRead
+    #define traceENTER_xStreamBufferReleaseRead( xStreamBuffer, xBufferLengthBytes )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReleaseRead
+    #define traceRETURN_xStreamBufferReleaseRead( xReturn )
+#endif
+
+#ifndef traceENTER_xStreamBufferReleaseReadFromISR
+    #define traceENTER_xStreamBufferReleaseReadFromISR( xStreamBuffer, xBufferLengthBytes, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xStreamBufferReleaseReadFromISR
+    #define traceRETURN_xStreamBufferReleaseReadFromISR( xReturn )
+#endif
+
 #ifndef traceENTER_xStreamBufferIsEmpty
     #define traceENTER_xStreamBufferIsEmpty( xStreamBuffer )
 #endif
@@ -2682,230 +2956,988 @@
     #define traceRETURN_xCoRoutineRemoveFromEventList( xReturn )
 #endif
 
-#ifndef configGENERATE_RUN_TIME_STATS
-    #define configGENERATE_RUN_TIME_STATS    0
+#ifndef traceENTER_xLightMutexGenericCreate
+    #define traceENTER_xLightMutexGenericCreate( uxCeilingPriority )
 #endif
 
-#if ( configGENERATE_RUN_TIME_STATS == 1 )
+#ifndef traceRETURN_xLightMutexGenericCreate
+    #define traceRETURN_xLightMutexGenericCreate( pxMutex )
+#endif
 
-    #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
-        #error If configGENERATE_RUN_TIME_STATS is defined then portCONFIGURE_TIMER_FOR_RUN_TIME_STATS must also be defined.  portCONFIGURE_TIMER_FOR_RUN_TIME_STATS should call a port layer function to setup a peripheral timer/counter that can then be used as the run time counter time base.
-    #endif /* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS */
+#ifndef traceENTER_xLightMutexGenericCreateStatic
+    #define traceENTER_xLightMutexGenericCreateStatic( uxCeilingPriority, pxMutexBuffer )
+#endif
 
-    #ifndef portGET_RUN_TIME_COUNTER_VALUE
-        #ifndef portALT_GET_RUN_TIME_COUNTER_VALUE
-            #error If configGENERATE_RUN_TIME_STATS is defined then either portGET_RUN_TIME_COUNTER_VALUE or portALT_GET_RUN_TIME_COUNTER_VALUE must also be defined.  See the examples provided and the FreeRTOS web site for more information.
-        #endif /* portALT_GET_RUN_TIME_COUNTER_VALUE */
-    #endif /* portGET_RUN_TIME_COUNTER_VALUE */
+#ifndef traceRETURN_xLightMutexGenericCreateStatic
+    #define traceRETURN_xLightMutexGenericCreateStatic( pxMutex )
+#endif
 
-#endif /* configGENERATE_RUN_TIME_STATS */
+#ifndef traceENTER_xLightMutexTake
+    #define traceENTER_xLightMutexTake( xMutex, xTicksToWait )
+#endif
 
-#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
-    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#ifndef traceRETURN_xLightMutexTake
+    #define traceRETURN_xLightMutexTake( xReturn )
 #endif
 
-#ifndef portPRIVILEGE_BIT
-    #define portPRIVILEGE_BIT    ( ( UBaseType_t ) 0x00 )
+#ifndef traceENTER_xLightMutexGive
+    #define traceENTER_xLightMutexGive( xMutex )
 #endif
 
-#ifndef portYIELD_WITHIN_API
-    #define portYIELD_WITHIN_API    portYIELD
+#ifndef traceRETURN_xLightMutexGive
+    #define traceRETURN_xLightMutexGive( xReturn )
 #endif
 
-#ifndef portSUPPRESS_TICKS_AND_SLEEP
-    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
+#ifndef traceENTER_xLightMutexGetHolder
+    #define traceENTER_xLightMutexGetHolder( xMutex )
 #endif
 
-#ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
-    #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
+#ifndef traceRETURN_xLightMutexGetHolder
+    #define traceRETURN_xLightMutexGetHolder( xReturn )
 #endif
 
-#if configEXPECTED_IDLE_TIME_BEFORE_SLEEP < 2
-    #error configEXPECTED_IDLE_TIME_BEFORE_SLEEP must not be less than 2
+#ifndef traceENTER_vLightMutexDelete
+    #define traceENTER_vLightMutexDelete( xMutex )
 #endif
 
-#ifndef configUSE_TICKLESS_IDLE
-    #define configUSE_TICKLESS_IDLE    0
+#ifndef traceRETURN_vLightMutexDelete
+    #define traceRETURN_vLightMutexDelete()
 #endif
 
-#ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
-    #define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#ifndef traceENTER_xRWLockCreate
+    #define traceENTER_xRWLockCreate()
 #endif
 
-#ifndef configPRE_SLEEP_PROCESSING
-    #define configPRE_SLEEP_PROCESSING( x )
+#ifndef traceRETURN_xRWLockCreate
+    #define traceRETURN_xRWLockCreate( pxLock )
 #endif
 
-#ifndef configPOST_SLEEP_PROCESSING
-    #define configPOST_SLEEP_PROCESSING( x )
+#ifndef traceENTER_xRWLockCreateStatic
+    #define traceENTER_xRWLockCreateStatic( pxLockBuffer )
 #endif
 
-#ifndef configUSE_QUEUE_SETS
-    #define configUSE_QUEUE_SETS    0
+#ifndef traceRETURN_xRWLockCreateStatic
+    #define traceRETURN_xRWLockCreateStatic( pxLock )
 #endif
 
-#ifndef portTASK_USES_FLOATING_POINT
-    #define portTASK_USES_FLOATING_POINT()
+#ifndef traceENTER_xRWLockAcquireRead
+    #define traceENTER_xRWLockAcquireRead( xLock, xTicksToWait )
 #endif
 
-#ifndef portALLOCATE_SECURE_CONTEXT
-    #define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
+#ifndef traceRETURN_xRWLockAcquireRead
+    #define traceRETURN_xRWLockAcquireRead( xReturn )
 #endif
 
-#ifndef portDONT_DISCARD
-    #define portDONT_DISCARD
+#ifndef traceENTER_xRWLockAcquireReadFromISR
+    #define traceENTER_xRWLockAcquireReadFromISR( xLock )
 #endif
 
-#ifndef configUSE_TIME_SLICING
-    #define configUSE_TIME_SLICING    1
+#ifndef traceRETURN_xRWLockAcquireReadFromISR
+    #define traceRETURN_xRWLockAcquireReadFromISR( xReturn )
 #endif
 
-#ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
-    #define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS    0
+#ifndef traceENTER_xRWLockReleaseRead
+    #define traceENTER_xRWLockReleaseRead( xLock )
 #endif
 
-#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
-    #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#ifndef traceRETURN_xRWLockReleaseRead
+    #define traceRETURN_xRWLockReleaseRead( xReturn )
 #endif
 
-#ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
-    #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
+#ifndef traceENTER_xRWLockReleaseReadFromISR
+    #define traceENTER_xRWLockReleaseReadFromISR( xLock, pxHigherPriorityTaskWoken )
 #endif
 
-#ifndef configUSE_TRACE_FACILITY
-    #define configUSE_TRACE_FACILITY    0
+#ifndef traceRETURN_xRWLockReleaseReadFromISR
+    #define traceRETURN_xRWLockReleaseReadFromISR( xReturn )
 #endif
 
-#ifndef mtCOVERAGE_TEST_MARKER
-    #define mtCOVERAGE_TEST_MARKER()
+#ifndef traceENTER_xRWLockAcquireWrite
+    #define traceENTER_xRWLockAcquireWrite( xLock, xTicksToWait )
 #endif
 
-#ifndef mtCOVERAGE_TEST_DELAY
-    #define mtCOVERAGE_TEST_DELAY()
+#ifndef traceRETURN_xRWLockAcquireWrite
+    #define traceRETURN_xRWLockAcquireWrite( xReturn )
 #endif
 
-#ifndef portASSERT_IF_IN_ISR
-    #define portASSERT_IF_IN_ISR()
+#ifndef traceENTER_xRWLockReleaseWrite
+    #define traceENTER_xRWLockReleaseWrite( xLock )
 #endif
 
-#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
-    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#ifndef traceRETURN_xRWLockReleaseWrite
+    #define traceRETURN_xRWLockReleaseWrite( xReturn )
 #endif
 
-#ifndef configAPPLICATION_ALLOCATED_HEAP
-    #define configAPPLICATION_ALLOCATED_HEAP    0
+#ifndef traceENTER_xRWLockGetWriter
+    #define traceENTER_xRWLockGetWriter( xLock )
 #endif
 
-#ifndef configENABLE_HEAP_PROTECTOR
-    #define configENABLE_HEAP_PROTECTOR    0
+#ifndef traceRETURN_xRWLockGetWriter
+    #define traceRETURN_xRWLockGetWriter( xReturn )
 #endif
 
-#ifndef configUSE_TASK_NOTIFICATIONS
-    #define configUSE_TASK_NOTIFICATIONS    1
+#ifndef traceENTER_uxRWLockGetReaderCount
+    #define traceENTER_uxRWLockGetReaderCount( xLock )
 #endif
 
-#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
-    #define configTASK_NOTIFICATION_ARRAY_ENTRIES    1
+#ifndef traceRETURN_uxRWLockGetReaderCount
+    #define traceRETURN_uxRWLockGetReaderCount( uxReturn )
 #endif
 
-#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
-    #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#ifndef traceENTER_vRWLockDelete
+    #define traceENTER_vRWLockDelete( xLock )
 #endif
 
-#ifndef configUSE_POSIX_ERRNO
-    #define configUSE_POSIX_ERRNO    0
+#ifndef traceRETURN_vRWLockDelete
+    #define traceRETURN_vRWLockDelete()
 #endif
 
-#ifndef configUSE_SB_COMPLETED_CALLBACK
+#ifndef traceENTER_xCondVarCreate
+    #define traceENTER_xCondVarCreate()
+#endif
 
-/* By default per-instance callbacks are not enabled for stream buffer or message buffer. */
-    #define configUSE_SB_COMPLETED_CALLBACK    0
+#ifndef traceRETURN_xCondVarCreate
+    #define traceRETURN_xCondVarCreate( pxCondVar )
 #endif
 
-#ifndef portTICK_TYPE_IS_ATOMIC
-    #define portTICK_TYPE_IS_ATOMIC    0
+#ifndef traceENTER_xCondVarCreateStatic
+    #define traceENTER_xCondVarCreateStatic( pxCondVarBuffer )
 #endif
 
-#ifndef configSUPPORT_STATIC_ALLOCATION
-    /* Defaults to 0 for backward compatibility. */
-    #define configSUPPORT_STATIC_ALLOCATION    0
+#ifndef traceRETURN_xCondVarCreateStatic
+    #define traceRETURN_xCondVarCreateStatic( pxCondVar )
 #endif
 
-#ifndef configKERNEL_PROVIDED_STATIC_MEMORY
-    #define configKERNEL_PROVIDED_STATIC_MEMORY    0
+#ifndef traceENTER_xCondVarWait
+    #define traceENTER_xCondVarWait( xCondVar, xMutex, xTicksToWait )
 #endif
 
-#ifndef configSUPPORT_DYNAMIC_ALLOCATION
-    /* Defaults to 1 for backward compatibility. */
-    #define configSUPPORT_DYNAMIC_ALLOCATION    1
+#ifndef traceRETURN_xCondVarWait
+    #define traceRETURN_xCondVarWait( xReturn )
 #endif
 
-#if ( ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
-    #error configUSE_STATS_FORMATTING_FUNCTIONS cannot be used without dynamic allocation, but configSUPPORT_DYNAMIC_ALLOCATION is not set to 1.
+#ifndef traceENTER_xCondVarSignal
+    #define traceENTER_xCondVarSignal( xCondVar )
 #endif
 
-#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
-    #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
-        #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
-    #endif
+#ifndef traceRETURN_xCondVarSignal
+    #define traceRETURN_xCondVarSignal( xReturn )
 #endif
 
-#ifndef configSTATS_BUFFER_MAX_LENGTH
-    #define configSTATS_BUFFER_MAX_LENGTH    0xFFFF
+#ifndef traceENTER_xCondVarBroadcast
+    #define traceENTER_xCondVarBroadcast( xCondVar )
 #endif
 
-#ifndef configSTACK_DEPTH_TYPE
+#ifndef traceRETURN_xCondVarBroadcast
+    #define traceRETURN_xCondVarBroadcast( xReturn )
+#endif
 
-/* Defaults to StackType_t for backward compatibility, but can be overridden
- * in FreeRTOSConfig.h if StackType_t is too restrictive. */
-    #define configSTACK_DEPTH_TYPE    StackType_t
+#ifndef traceENTER_vCondVarDelete
+    #define traceENTER_vCondVarDelete( xCondVar )
 #endif
 
-#ifndef configRUN_TIME_COUNTER_TYPE
+#ifndef traceRETURN_vCondVarDelete
+    #define traceRETURN_vCondVarDelete()
+#endif
 
-/* Defaults to uint32_t for backward compatibility, but can be overridden in
- * FreeRTOSConfig.h if uint32_t is too restrictive. */
+#ifndef traceENTER_vWaitAnySetQueue
+    #define traceENTER_vWaitAnySetQueue( pxObject, xQueue )
+#endif
 
-    #define configRUN_TIME_COUNTER_TYPE    uint32_t
+#ifndef traceRETURN_vWaitAnySetQueue
+    #define traceRETURN_vWaitAnySetQueue()
 #endif
 
-#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+#ifndef traceENTER_vWaitAnySetEventGroup
+    #define traceENTER_vWaitAnySetEventGroup( pxObject, xEventGroup, uxBitsToWaitFor )
+#endif
 
-/* Defaults to size_t for backward compatibility, but can be overridden
- * in FreeRTOSConfig.h if lengths will always be less than the number of bytes
- * in a size_t. */
-    #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
+#ifndef traceRETURN_vWaitAnySetEventGroup
+    #define traceRETURN_vWaitAnySetEventGroup()
 #endif
 
-/* Sanity check the configuration. */
-#if ( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
-    #error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
+#ifndef traceENTER_vWaitAnySetStreamBuffer
+    #define traceENTER_vWaitAnySetStreamBuffer( pxObject, xStreamBuffer )
 #endif
 
-#if ( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
-    #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
+#ifndef traceRETURN_vWaitAnySetStreamBuffer
+    #define traceRETURN_vWaitAnySetStreamBuffer()
 #endif
 
-#if ( ( configRUN_MULTIPLE_PRIORITIES == 0 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
-    #error configRUN_MULTIPLE_PRIORITIES must be set to 1 to use task preemption disable
+#ifndef traceENTER_vWaitAnySetNotification
+    #define traceENTER_vWaitAnySetNotification( pxObject, uxIndexToWaitOn )
 #endif
 
-#if ( ( configUSE_PREEMPTION == 0 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
-    #error configUSE_PREEMPTION must be set to 1 to use task preemption disable
+#ifndef traceRETURN_vWaitAnySetNotification
+    #define traceRETURN_vWaitAnySetNotification()
 #endif
 
-#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
-    #error configUSE_TASK_PREEMPTION_DISABLE is not supported in single core FreeRTOS
+#ifndef traceENTER_pxWaitAny
+    #define traceENTER_pxWaitAny( pxObjects, uxObjectCount, xTicksToWait )
 #endif
 
-#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_AFFINITY != 0 ) )
-    #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
+#ifndef traceRETURN_pxWaitAny
+    #define traceRETURN_pxWaitAny( pxReadyObject )
+#endif
+
+#ifndef traceENTER_xWaitAnyAddObject
+    #define traceENTER_xWaitAnyAddObject( pxContext, pxObject )
+#endif
+
+#ifndef traceRETURN_xWaitAnyAddObject
+    #define traceRETURN_xWaitAnyAddObject( xReturn )
+#endif
+
+#ifndef traceENTER_vWaitAnyRemoveObject
+    #define traceENTER_vWaitAnyRemoveObject( pxContext, pxObject )
+#endif
+
+#ifndef traceRETURN_vWaitAnyRemoveObject
+    #define traceRETURN_vWaitAnyRemoveObject()
+#endif
+
+#ifndef traceENTER_xQueueAddToWaitAny
+    #define traceENTER_xQueueAddToWaitAny( xQueue, pxObject )
+#endif
+
+#ifndef traceRETURN_xQueueAddToWaitAny
+    #define traceRETURN_xQueueAddToWaitAny( xReturn )
+#endif
+
+#ifndef traceENTER_vQueueRemoveFromWaitAny
+    #define traceENTER_vQueueRemoveFromWaitAny( xQueue, pxObject )
+#endif
+
+#ifndef traceRETURN_vQueueRemoveFromWaitAny
+    #define traceRETURN_vQueueRemoveFromWaitAny()
+#endif
+
+#ifndef traceENTER_xEventGroupAddToWaitAny
+    #define traceENTER_xEventGroupAddToWaitAny( xEventGroup, pxObject )
+#endif
+
+#ifndef traceRETURN_xEventGroupAddToWaitAny
+    #define traceRETURN_xEventGroupAddToWaitAny( xReturn )
+#endif
+
+#ifndef traceENTER_vEventGroupRemoveFromWaitAny
+    #define traceENTER_vEventGroupRemoveFromWaitAny( xEventGroup, pxObject )
+#endif
+
+#ifndef traceRETURN_vEventGroupRemoveFromWaitAny
+    #define traceRETURN_vEventGroupRemoveFromWaitAny()
+#endif
+
+#ifndef traceENTER_xStreamBufferAddToWaitAny
+    #define traceENTER_xStreamBufferAddToWaitAny( xStreamBuffer, pxObject )
+#endif
+
+#ifndef traceRETURN_xStreamBufferAddToWaitAny
+    #define traceRETURN_xStreamBufferAddToWaitAny( xReturn )
+#endif
+
+#ifndef traceENTER_vStreamBufferRemoveFromWaitAny
+    #define traceENTER_vStreamBufferRemoveFromWaitAny( xStreamBuffer, pxObject )
+#endif
+
+#ifndef traceRETURN_vStreamBufferRemoveFromWaitAny
+    #define traceRETURN_vStreamBufferRemoveFromWaitAny()
+#endif
+
+#ifndef traceENTER_xTaskAddNotificationToWaitAny
+    #define traceENTER_xTaskAddNotificationToWaitAny( uxIndexToWaitOn )
+#endif
+
+#ifndef traceRETURN_xTaskAddNotificationToWaitAny
+    #define traceRETURN_xTaskAddNotificationToWaitAny( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskRemoveNotificationFromWaitAny
+    #define traceENTER_xTaskRemoveNotificationFromWaitAny( uxIndexToWaitOn )
+#endif
+
+#ifndef traceRETURN_xTaskRemoveNotificationFromWaitAny
+    #define traceRETURN_xTaskRemoveNotificationFromWaitAny( xReturn )
+#endif
+
+#ifndef traceENTER_xBroadcastCreateStatic
+    #define traceENTER_xBroadcastCreateStatic( uxLength, uxItemSize, pucStorageBuffer, pxChannelBuffer )
+#endif
+
+#ifndef traceRETURN_xBroadcastCreateStatic
+    #define traceRETURN_xBroadcastCreateStatic( xChannel )
+#endif
+
+#ifndef traceENTER_xBroadcastCreate
+    #define traceENTER_xBroadcastCreate( uxLength, uxItemSize )
+#endif
+
+#ifndef traceRETURN_xBroadcastCreate
+    #define traceRETURN_xBroadcastCreate( xChannel )
+#endif
+
+#ifndef traceENTER_vBroadcastSubscribe
+    #define traceENTER_vBroadcastSubscribe( xChannel, pxSubscriber )
+#endif
+
+#ifndef traceRETURN_vBroadcastSubscribe
+    #define traceRETURN_vBroadcastSubscribe()
+#endif
+
+#ifndef traceENTER_vBroadcastPublish
+    #define traceENTER_vBroadcastPublish( xChannel, pvItem )
+#endif
+
+#ifndef traceRETURN_vBroadcastPublish
+    #define traceRETURN_vBroadcastPublish()
+#endif
+
+#ifndef traceENTER_vBroadcastPublishFromISR
+    #define traceENTER_vBroadcastPublishFromISR( xChannel, pvItem, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_vBroadcastPublishFromISR
+    #define traceRETURN_vBroadcastPublishFromISR()
+#endif
+
+#ifndef traceENTER_xBroadcastReceive
+    #define traceENTER_xBroadcastReceive( pxSubscriber, pvBuffer, puxItemsLost, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_xBroadcastReceive
+    #define traceRETURN_xBroadcastReceive( xReturn )
+#endif
+
+#ifndef traceENTER_xBroadcastReceiveFromISR
+    #define traceENTER_xBroadcastReceiveFromISR( pxSubscriber, pvBuffer, puxItemsLost )
+#endif
+
+#ifndef traceRETURN_xBroadcastReceiveFromISR
+    #define traceRETURN_xBroadcastReceiveFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_uxBroadcastItemsWaiting
+    #define traceENTER_uxBroadcastItemsWaiting( pxSubscriber )
+#endif
+
+#ifndef traceRETURN_uxBroadcastItemsWaiting
+    #define traceRETURN_uxBroadcastItemsWaiting( uxReturn )
+#endif
+
+#ifndef traceENTER_vBroadcastDelete
+    #define traceENTER_vBroadcastDelete( xChannel )
+#endif
+
+#ifndef traceRETURN_vBroadcastDelete
+    #define traceRETURN_vBroadcastDelete()
+#endif
+
+#ifndef traceENTER_xExecutorCreateStatic
+    #define traceENTER_xExecutorCreateStatic( pxExecutorBuffer )
+#endif
+
+#ifndef traceRETURN_xExecutorCreateStatic
+    #define traceRETURN_xExecutorCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_xExecutorCreate
+    #define traceENTER_xExecutorCreate()
+#endif
+
+#ifndef traceRETURN_xExecutorCreate
+    #define traceRETURN_xExecutorCreate( xReturn )
+#endif
+
+#ifndef traceENTER_vExecutorRun
+    #define traceENTER_vExecutorRun( xExecutor )
+#endif
+
+#ifndef traceENTER_vExecutorAddHandler
+    #define traceENTER_vExecutorAddHandler( xExecutor, pxHandler, pxHandlerFunction, pvParameters, uxPriority )
+#endif
+
+#ifndef traceRETURN_vExecutorAddHandler
+    #define traceRETURN_vExecutorAddHandler()
+#endif
+
+#ifndef traceENTER_vExecutorAwaitQueue
+    #define traceENTER_vExecutorAwaitQueue( pxHandler, pxAwaitSlot, xQueue, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vExecutorAwaitQueue
+    #define traceRETURN_vExecutorAwaitQueue()
+#endif
+
+#ifndef traceENTER_vExecutorAwaitEventGroup
+    #define traceENTER_vExecutorAwaitEventGroup( pxHandler, pxAwaitSlot, xEventGroup, uxBitsToWaitFor, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vExecutorAwaitEventGroup
+    #define traceRETURN_vExecutorAwaitEventGroup()
+#endif
+
+#ifndef traceENTER_vExecutorAwaitStreamBuffer
+    #define traceENTER_vExecutorAwaitStreamBuffer( pxHandler, pxAwaitSlot, xStreamBuffer, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vExecutorAwaitStreamBuffer
+    #define traceRETURN_vExecutorAwaitStreamBuffer()
+#endif
+
+#ifndef traceENTER_vExecutorAwaitNotification
+    #define traceENTER_vExecutorAwaitNotification( pxHandler, xTicksToWait )
+#endif
+
+#ifndef traceRETURN_vExecutorAwaitNotification
+    #define traceRETURN_vExecutorAwaitNotification()
+#endif
+
+#ifndef traceENTER_vExecutorDelay
+    #define traceENTER_vExecutorDelay( pxHandler, xTicksToDelay )
+#endif
+
+#ifndef traceRETURN_vExecutorDelay
+    #define traceRETURN_vExecutorDelay()
+#endif
+
+#ifndef traceENTER_vExecutorYield
+    #define traceENTER_vExecutorYield( pxHandler )
+#endif
+
+#ifndef traceRETURN_vExecutorYield
+    #define traceRETURN_vExecutorYield()
+#endif
+
+#ifndef traceENTER_xExecutorTimedOut
+    #define traceENTER_xExecutorTimedOut( pxHandler )
+#endif
+
+#ifndef traceRETURN_xExecutorTimedOut
+    #define traceRETURN_xExecutorTimedOut( xReturn )
+#endif
+
+#ifndef traceENTER_xExecutorNotify
+    #define traceENTER_xExecutorNotify( pxHandler, ulBitsToSet )
+#endif
+
+#ifndef traceRETURN_xExecutorNotify
+    #define traceRETURN_xExecutorNotify( xReturn )
+#endif
+
+#ifndef traceENTER_xExecutorNotifyFromISR
+    #define traceENTER_xExecutorNotifyFromISR( pxHandler, ulBitsToSet, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_xExecutorNotifyFromISR
+    #define traceRETURN_xExecutorNotifyFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_ulExecutorTakeNotification
+    #define traceENTER_ulExecutorTakeNotification( pxHandler )
+#endif
+
+#ifndef traceRETURN_ulExecutorTakeNotification
+    #define traceRETURN_ulExecutorTakeNotification( ulReturn )
+#endif
+
+#ifndef traceENTER_xTaskGroupCreateStatic
+    #define traceENTER_xTaskGroupCreateStatic( pcName, uxStackDepth, puxStackBuffer, pxTaskBuffer, pxGroupBuffer )
+#endif
+
+#ifndef traceRETURN_xTaskGroupCreateStatic
+    #define traceRETURN_xTaskGroupCreateStatic( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGroupCreate
+    #define traceENTER_xTaskGroupCreate( pcName, uxStackDepth )
+#endif
+
+#ifndef traceRETURN_xTaskGroupCreate
+    #define traceRETURN_xTaskGroupCreate( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGroupGetTaskHandle
+    #define traceENTER_xTaskGroupGetTaskHandle( xGroup )
+#endif
+
+#ifndef traceRETURN_xTaskGroupGetTaskHandle
+    #define traceRETURN_xTaskGroupGetTaskHandle( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskGroupAddMember
+    #define traceENTER_vTaskGroupAddMember( xGroup, pxMember, pxMemberFunction, pvParameters, uxPriority )
+#endif
+
+#ifndef traceRETURN_vTaskGroupAddMember
+    #define traceRETURN_vTaskGroupAddMember()
+#endif
+
+#ifndef traceENTER_vTaskGroupPost
+    #define traceENTER_vTaskGroupPost( pxMember, ulEvents )
+#endif
+
+#ifndef traceRETURN_vTaskGroupPost
+    #define traceRETURN_vTaskGroupPost()
+#endif
+
+#ifndef traceENTER_vTaskGroupPostFromISR
+    #define traceENTER_vTaskGroupPostFromISR( pxMember, ulEvents, pxHigherPriorityTaskWoken )
+#endif
+
+#ifndef traceRETURN_vTaskGroupPostFromISR
+    #define traceRETURN_vTaskGroupPostFromISR()
+#endif
+
+#ifndef traceENTER_xTaskGroupSetPriority
+    #define traceENTER_xTaskGroupSetPriority( xTask, uxNewPriority )
+#endif
+
+#ifndef traceRETURN_xTaskGroupSetPriority
+    #define traceRETURN_xTaskGroupSetPriority( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskGroupRaisePriorityFromISR
+    #define traceENTER_xTaskGroupRaisePriorityFromISR( xTask, uxNewPriority )
+#endif
+
+#ifndef traceRETURN_xTaskGroupRaisePriorityFromISR
+    #define traceRETURN_xTaskGroupRaisePriorityFromISR( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskEDFAdmit
+    #define traceENTER_xTaskEDFAdmit( xTask, xExecutionTime, xRelativeDeadline, xPeriod )
+#endif
+
+#ifndef traceRETURN_xTaskEDFAdmit
+    #define traceRETURN_xTaskEDFAdmit( xReturn )
+#endif
+
+#ifndef traceENTER_xTaskEDFWaitForNextPeriod
+    #define traceENTER_xTaskEDFWaitForNextPeriod()
+#endif
+
+#ifndef traceRETURN_xTaskEDFWaitForNextPeriod
+    #define traceRETURN_xTaskEDFWaitForNextPeriod( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskSetBudget
+    #define traceENTER_vTaskSetBudget( xTask, xBudget, xPeriod, uxLowPriority )
+#endif
+
+#ifndef traceRETURN_vTaskSetBudget
+    #define traceRETURN_vTaskSetBudget()
+#endif
+
+#ifndef traceENTER_vTaskGetBudgetStatus
+    #define traceENTER_vTaskGetBudgetStatus( xTask, pxBudgetStatus )
+#endif
+
+#ifndef traceRETURN_vTaskGetBudgetStatus
+    #define traceRETURN_vTaskGetBudgetStatus()
+#endif
+
+#ifndef traceENTER_vTaskPeriodicStart
+    #define traceENTER_vTaskPeriodicStart( xPeriod, xDeadline )
+#endif
+
+#ifndef traceRETURN_vTaskPeriodicStart
+    #define traceRETURN_vTaskPeriodicStart()
+#endif
+
+#ifndef traceENTER_xTaskPeriodicWait
+    #define traceENTER_xTaskPeriodicWait()
+#endif
+
+#ifndef traceRETURN_xTaskPeriodicWait
+    #define traceRETURN_xTaskPeriodicWait( xReturn )
+#endif
+
+#ifndef traceENTER_vTaskGetPeriodicStatus
+    #define traceENTER_vTaskGetPeriodicStatus( xTask, pxPeriodicStatus )
+#endif
+
+#ifndef traceRETURN_vTaskGetPeriodicStatus
+    #define traceRETURN_vTaskGetPeriodicStatus()
+#endif
+
+#ifndef configGENERATE_RUN_TIME_STATS
+    #define configGENERATE_RUN_TIME_STATS    0
+#endif
+
+#if ( configGENERATE_RUN_TIME_STATS == 1 )
+
+    #ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+        #error If configGENERATE_RUN_TIME_STATS is defined then portCONFIGURE_TIMER_FOR_RUN_TIME_STATS must also be defined.  portCONFIGURE_TIMER_FOR_RUN_TIME_STATS should call a port layer function to setup a peripheral timer/counter that can then be used as the run time counter time base.
+    #endif /* portCONFIGURE_TIMER_FOR_RUN_TIME_STATS */
+
+    #ifndef portGET_RUN_TIME_COUNTER_VALUE
+        #ifndef portALT_GET_RUN_TIME_COUNTER_VALUE
+            #error If configGENERATE_RUN_TIME_STATS is defined then either portGET_RUN_TIME_COUNTER_VALUE or portALT_GET_RUN_TIME_COUNTER_VALUE must also be defined.  See the examples provided and the FreeRTOS web site for more information.
+        #endif /* portALT_GET_RUN_TIME_COUNTER_VALUE */
+    #endif /* portGET_RUN_TIME_COUNTER_VALUE */
+
+#endif /* configGENERATE_RUN_TIME_STATS */
+
+#ifndef portCONFIGURE_TIMER_FOR_RUN_TIME_STATS
+    #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+#endif
+
+#ifndef portPRIVILEGE_BIT
+    #define portPRIVILEGE_BIT    ( ( UBaseType_t ) 0x00 )
+#endif
+
+#ifndef portYIELD_WITHIN_API
+    #define portYIELD_WITHIN_API    portYIELD
+#endif
+
+#ifndef portSUPPRESS_TICKS_AND_SLEEP
+    #define portSUPPRESS_TICKS_AND_SLEEP( xExpectedIdleTime )
+#endif
+
+#ifndef configEXPECTED_IDLE_TIME_BEFORE_SLEEP
+    #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP    2
+#endif
+
+#if configEXPECTED_IDLE_TIME_BEFORE_SLEEP < 2
+    #error configEXPECTED_IDLE_TIME_BEFORE_SLEEP must not be less than 2
+#endif
+
+#ifndef configUSE_TICKLESS_IDLE
+    #define configUSE_TICKLESS_IDLE    0
+#endif
+
+#ifndef configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING
+    #define configPRE_SUPPRESS_TICKS_AND_SLEEP_PROCESSING( x )
+#endif
+
+#ifndef configPRE_SLEEP_PROCESSING
+    #define configPRE_SLEEP_PROCESSING( x )
+#endif
+
+#ifndef configPOST_SLEEP_PROCESSING
+    #define configPOST_SLEEP_PROCESSING( x )
+#endif
+
+#ifndef configUSE_QUEUE_SETS
+    #define configUSE_QUEUE_SETS    0
+#endif
+
+#ifndef configUSE_SPSC_QUEUES
+    #define configUSE_SPSC_QUEUES    0
+#endif
+
+#ifndef configQUEUE_SPSC_NOTIFICATION_INDEX
+    #define configQUEUE_SPSC_NOTIFICATION_INDEX    0
+#endif
+
+#ifndef configUSE_LIGHT_MUTEXES
+    #define configUSE_LIGHT_MUTEXES    0
+#endif
+
+#ifndef configPRIORITY_INHERITANCE_DEPTH
+    #define configPRIORITY_INHERITANCE_DEPTH    1
+#endif
+
+#ifndef configUSE_RW_LOCKS
+    #define configUSE_RW_LOCKS    0
+#endif
+
+#ifndef configUSE_CONDITION_VARIABLES
+    #define configUSE_CONDITION_VARIABLES    0
+#endif
+
+#ifndef configUSE_WAIT_ANY
+    #define configUSE_WAIT_ANY    0
+#endif
+
+#ifndef configUSE_BROADCAST_CHANNELS
+    #define configUSE_BROADCAST_CHANNELS    0
+#endif
+
+#ifndef configUSE_MULTI_PRODUCER_STREAM_BUFFERS
+    #define configUSE_MULTI_PRODUCER_STREAM_BUFFERS    0
+#endif
+
+#ifndef configUSE_STREAM_BUFFER_COALESCING
+    #define configUSE_STREAM_BUFFER_COALESCING    0
+#endif
+
+#ifndef configUSE_EXECUTORS
+    #define configUSE_EXECUTORS    0
+#endif
+
+#ifndef configEXECUTOR_MAX_PRIORITIES
+    #define configEXECUTOR_MAX_PRIORITIES    4
+#endif
+
+#if ( configEXECUTOR_MAX_PRIORITIES < 1 )
+    #error configEXECUTOR_MAX_PRIORITIES must be greater than or equal to 1.
+#endif
+
+#ifndef configUSE_TASK_GROUPS
+    #define configUSE_TASK_GROUPS    0
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+    #define configUSE_EDF_SCHEDULING    0
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    #ifndef configEDF_PRIORITY
+        #error configEDF_PRIORITY must be defined to the priority reserved for EDF tasks when configUSE_EDF_SCHEDULING is set to 1.
+    #endif
+
+    #if ( INCLUDE_xTaskDelayUntil != 1 )
+        #error INCLUDE_xTaskDelayUntil must be set to 1 when configUSE_EDF_SCHEDULING is set to 1.
+    #endif
+#endif
+
+#ifndef configEDF_UTILISATION_BOUND
+    #define configEDF_UTILISATION_BOUND    100
+#endif
+
+#if ( ( configEDF_UTILISATION_BOUND < 1 ) || ( configEDF_UTILISATION_BOUND > 100 ) )
+    #error configEDF_UTILISATION_BOUND must be between 1 and 100.
+#endif
+
+#ifndef configUSE_EDF_DEADLINE_MISS_HOOK
+    #define configUSE_EDF_DEADLINE_MISS_HOOK    0
+#endif
+
+#ifndef configUSE_TASK_BUDGETS
+    #define configUSE_TASK_BUDGETS    0
+#endif
+
+#ifndef configTASK_BUDGET_MAX_REPLENISHMENTS
+    #define configTASK_BUDGET_MAX_REPLENISHMENTS    4
+#endif
+
+#if ( configTASK_BUDGET_MAX_REPLENISHMENTS < 1 )
+    #error configTASK_BUDGET_MAX_REPLENISHMENTS must be greater than or equal to 1.
+#endif
+
+#ifndef configUSE_PERIODIC_TASKS
+    #define configUSE_PERIODIC_TASKS    0
+#endif
+
+#if ( ( configUSE_PERIODIC_TASKS == 1 ) && ( INCLUDE_xTaskDelayUntil != 1 ) )
+    #error INCLUDE_xTaskDelayUntil must be set to 1 when configUSE_PERIODIC_TASKS is set to 1.
+#endif
+
+#ifndef configPERIODIC_TASK_HISTOGRAM_BUCKETS
+    #define configPERIODIC_TASK_HISTOGRAM_BUCKETS    8
+#endif
+
+#if ( configPERIODIC_TASK_HISTOGRAM_BUCKETS < 2 )
+    #error configPERIODIC_TASK_HISTOGRAM_BUCKETS must be greater than or equal to 2.
+#endif
+
+#ifndef configUSE_PERIODIC_TASK_OVERRUN_HOOK
+    #define configUSE_PERIODIC_TASK_OVERRUN_HOOK    0
+#endif
+
+#ifndef portTASK_USES_FLOATING_POINT
+    #define portTASK_USES_FLOATING_POINT()
+#endif
+
+#ifndef portALLOCATE_SECURE_CONTEXT
+    #define portALLOCATE_SECURE_CONTEXT( ulSecureStackSize )
+#endif
+
+#ifndef portDONT_DISCARD
+    #define portDONT_DISCARD
+#endif
+
+#ifndef configUSE_TIME_SLICING
+    #define configUSE_TIME_SLICING    1
+#endif
+
+#ifndef configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS
+    #define configINCLUDE_APPLICATION_DEFINED_PRIVILEGED_FUNCTIONS    0
+#endif
+
+#ifndef configUSE_STATS_FORMATTING_FUNCTIONS
+    #define configUSE_STATS_FORMATTING_FUNCTIONS    0
+#endif
+
+#ifndef portASSERT_IF_INTERRUPT_PRIORITY_INVALID
+    #define portASSERT_IF_INTERRUPT_PRIORITY_INVALID()
+#endif
+
+#ifndef configUSE_TRACE_FACILITY
+    #define configUSE_TRACE_FACILITY    0
+#endif
+
+#ifndef mtCOVERAGE_TEST_MARKER
+    #define mtCOVERAGE_TEST_MARKER()
+#endif
+
+#ifndef mtCOVERAGE_TEST_DELAY
+    #define mtCOVERAGE_TEST_DELAY()
+#endif
+
+#ifndef portASSERT_IF_IN_ISR
+    #define portASSERT_IF_IN_ISR()
+#endif
+
+#ifndef configUSE_PORT_OPTIMISED_TASK_SELECTION
+    #define configUSE_PORT_OPTIMISED_TASK_SELECTION    0
+#endif
+
+#ifndef configAPPLICATION_ALLOCATED_HEAP
+    #define configAPPLICATION_ALLOCATED_HEAP    0
+#endif
+
+#ifndef configENABLE_HEAP_PROTECTOR
+    #define configENABLE_HEAP_PROTECTOR    0
+#endif
+
+#ifndef configUSE_TASK_NOTIFICATIONS
+    #define configUSE_TASK_NOTIFICATIONS    1
+#endif
+
+#ifndef configTASK_NOTIFICATION_ARRAY_ENTRIES
+    #define configTASK_NOTIFICATION_ARRAY_ENTRIES    1
+#endif
+
+#if configTASK_NOTIFICATION_ARRAY_ENTRIES < 1
+    #error configTASK_NOTIFICATION_ARRAY_ENTRIES must be at least 1
+#endif
+
+#ifndef configUSE_POSIX_ERRNO
+    #define configUSE_POSIX_ERRNO    0
+#endif
+
+#ifndef configUSE_SB_COMPLETED_CALLBACK
+
+/* By default per-instance callbacks are not enabled for stream buffer or message buffer. */
+    #define configUSE_SB_COMPLETED_CALLBACK    0
+#endif
+
+#ifndef portTICK_TYPE_IS_ATOMIC
+    #define portTICK_TYPE_IS_ATOMIC    0
+#endif
+
+#ifndef configSUPPORT_STATIC_ALLOCATION
+    /* Defaults to 0 for backward compatibility. */
+    #define configSUPPORT_STATIC_ALLOCATION    0
+#endif
+
+#ifndef configKERNEL_PROVIDED_STATIC_MEMORY
+    #define configKERNEL_PROVIDED_STATIC_MEMORY    0
+#endif
+
+#ifndef configSUPPORT_DYNAMIC_ALLOCATION
+    /* Defaults to 1 for backward compatibility. */
+    #define configSUPPORT_DYNAMIC_ALLOCATION    1
+#endif
+
+#if ( ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION != 1 ) )
+    #error configUSE_STATS_FORMATTING_FUNCTIONS cannot be used without dynamic allocation, but configSUPPORT_DYNAMIC_ALLOCATION is not set to 1.
+#endif
+
+#if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
+    #if ( ( configUSE_TRACE_FACILITY != 1 ) && ( configGENERATE_RUN_TIME_STATS != 1 ) )
+        #error configUSE_STATS_FORMATTING_FUNCTIONS is 1 but the functions it enables are not used because neither configUSE_TRACE_FACILITY or configGENERATE_RUN_TIME_STATS are 1.  Set configUSE_STATS_FORMATTING_FUNCTIONS to 0 in FreeRTOSConfig.h.
+    #endif
+#endif
+
+#ifndef configSTATS_BUFFER_MAX_LENGTH
+    #define configSTATS_BUFFER_MAX_LENGTH    0xFFFF
+#endif
+
+#ifndef configSTACK_DEPTH_TYPE
+
+/* Defaults to StackType_t for backward compatibility, but can be overridden
+ * in FreeRTOSConfig.h if StackType_t is too restrictive. */
+    #define configSTACK_DEPTH_TYPE    StackType_t
+#endif
+
+#ifndef configRUN_TIME_COUNTER_TYPE
+
+/* Defaults to uint32_t for backward compatibility, but can be overridden in
+ * FreeRTOSConfig.h if uint32_t is too restrictive. */
+
+    #define configRUN_TIME_COUNTER_TYPE    uint32_t
+#endif
+
+#ifndef configMESSAGE_BUFFER_LENGTH_TYPE
+
+/* Defaults to size_t for backward compatibility, but can be overridden
+ * in FreeRTOSConfig.h if lengths will always be less than the number of bytes
+ * in a size_t. */
+    #define configMESSAGE_BUFFER_LENGTH_TYPE    size_t
+#endif
+
+/* Sanity check the configuration. */
+#if ( ( configSUPPORT_STATIC_ALLOCATION == 0 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 0 ) )
+    #error configSUPPORT_STATIC_ALLOCATION and configSUPPORT_DYNAMIC_ALLOCATION cannot both be 0, but can both be 1.
+#endif
+
+#if ( ( configUSE_RECURSIVE_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use recursive mutexes
+#endif
+
+#if ( ( configUSE_LIGHT_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use light mutexes
+#endif
+
+#if ( configPRIORITY_INHERITANCE_DEPTH < 1 )
+    #error configPRIORITY_INHERITANCE_DEPTH must be at least 1
+#endif
+
+#if ( ( configUSE_RW_LOCKS == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use reader-writer locks
+#endif
+
+#if ( ( configUSE_CONDITION_VARIABLES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+    #error configUSE_MUTEXES must be set to 1 to use condition variables
+#endif
+
+#if ( ( configRUN_MULTIPLE_PRIORITIES == 0 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
+    #error configRUN_MULTIPLE_PRIORITIES must be set to 1 to use task preemption disable
+#endif
+
+#if ( ( configUSE_PREEMPTION == 0 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
+    #error configUSE_PREEMPTION must be set to 1 to use task preemption disable
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_TASK_PREEMPTION_DISABLE != 0 ) )
+    #error configUSE_TASK_PREEMPTION_DISABLE is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_CORE_AFFINITY != 0 ) )
+    #error configUSE_CORE_AFFINITY is not supported in single core FreeRTOS
 #endif
 
 #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_PORT_OPTIMISED_TASK_SELECTION != 0 ) )
     #error configUSE_PORT_OPTIMISED_TASK_SELECTION is not supported in SMP FreeRTOS
 #endif
 
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_GROUPS != 0 ) )
+    #error configUSE_TASK_GROUPS is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_EDF_SCHEDULING != 0 ) )
+    #error configUSE_EDF_SCHEDULING is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_TASK_BUDGETS != 0 ) )
+    #error configUSE_TASK_BUDGETS is not supported in SMP FreeRTOS
+#endif
+
+#if ( ( configNUMBER_OF_CORES == 1 ) && ( configUSE_PER_CORE_READY_LISTS != 0 ) )
+    #error configUSE_PER_CORE_READY_LISTS is not supported in single core FreeRTOS
+#endif
+
+#if ( ( configUSE_PER_CORE_READY_LISTS != 0 ) && ( configUSE_CORE_AFFINITY != 1 ) )
+    #error configUSE_CORE_AFFINITY must be set to 1 to use per core ready lists
+#endif
+
+#if ( ( configUSE_PER_CORE_READY_LISTS != 0 ) && ( configRUN_MULTIPLE_PRIORITIES != 1 ) )
+    #error configRUN_MULTIPLE_PRIORITIES must be set to 1 to use per core ready lists
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
     #define configINITIAL_TICK_COUNT    0
 #endif
@@ -3192,6 +4224,9 @@ typedef struct xSTATIC_TCB
     #endif
     #if ( configUSE_MUTEXES == 1 )
         UBaseType_t uxDummy12[ 2 ];
+        #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+            void * pxDummy13;
+        #endif
     #endif
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
         void * pxDummy14;
@@ -3219,6 +4254,29 @@ typedef struct xSTATIC_TCB
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iDummy22;
     #endif
+    #if ( configUSE_TASK_GROUPS == 1 )
+        UBaseType_t uxDummy27;
+    #endif
+    #if ( ( configUSE_EDF_SCHEDULING == 1 ) || ( configUSE_PERIODIC_TASKS == 1 ) )
+        TickType_t xDummy37[ 3 ];
+    #endif
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xDummy28;
+        uint32_t ulDummy29;
+    #endif
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        StaticListItem_t xDummy30;
+        TickType_t xDummy31[ 5 + ( 2 * configTASK_BUDGET_MAX_REPLENISHMENTS ) ];
+        UBaseType_t uxDummy32[ 5 ];
+        BaseType_t xDummy33;
+    #endif
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        TickType_t xDummy34[ 2 ];
+        uint32_t ulDummy35[ 3 + configPERIODIC_TASK_HISTOGRAM_BUCKETS ];
+    #endif
+    #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+        BaseType_t xDummy36;
+    #endif
 } StaticTask_t;
 
 /*
@@ -3247,23 +4305,178 @@ typedef struct xSTATIC_QUEUE
 
     StaticList_t xDummy3[ 2 ];
     UBaseType_t uxDummy4[ 3 ];
-    uint8_t ucDummy5[ 2 ];
+    uint8_t ucDummy5[ 4 ];
 
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucDummy6;
     #endif
 
     #if ( configUSE_QUEUE_SETS == 1 )
-        void * pvDummy7;
+        void * pvDummy7[ 3 ];
     #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxDummy8;
         uint8_t ucDummy9;
     #endif
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+        UBaseType_t uxDummy10[ 2 ];
+        void * pvDummy11[ 2 ];
+        uint8_t ucDummy12;
+    #endif
+
+    #if ( configUSE_WAIT_ANY == 1 )
+        void * pvDummy13;
+    #endif
 } StaticQueue_t;
 typedef StaticQueue_t StaticSemaphore_t;
 
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the light mutex structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a light mutex then the size of the light mutex object needs to be
+ * known.  The StaticLightMutex_t structure below is provided for this purpose.
+ * Its sizes and alignment requirements are guaranteed to match those of the
+ * genuine structure, no matter which architecture is being used, and no matter
+ * how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_LIGHT_MUTEX
+{
+    void * pvDummy1;
+    StaticList_t xDummy2;
+    UBaseType_t uxDummy3;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy4;
+    #endif
+} StaticLightMutex_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the reader-writer lock structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a reader-writer lock then the size of the lock object needs to be
+ * known.  The StaticRWLock_t structure below is provided for this purpose.  Its
+ * sizes and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_RW_LOCK
+{
+    UBaseType_t uxDummy1;
+    void * pvDummy2;
+    StaticList_t xDummy3[ 2 ];
+    UBaseType_t uxDummy4;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy5;
+    #endif
+} StaticRWLock_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the condition variable structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a condition variable then the size of the condition variable object
+ * needs to be known.  The StaticCondVar_t structure below is provided for this
+ * purpose.  Its sizes and alignment requirements are guaranteed to match those
+ * of the genuine structure, no matter which architecture is being used, and no
+ * matter how the values in FreeRTOSConfig.h are set.  Its contents are
+ * somewhat obfuscated in the hope users will recognise that it would be unwise
+ * to make direct use of the structure members.
+ */
+typedef struct xSTATIC_COND_VAR
+{
+    StaticList_t xDummy1;
+    void * pvDummy2;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy3;
+    #endif
+} StaticCondVar_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the broadcast channel structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a broadcast channel then the size of the channel object needs to be
+ * known.  The StaticBroadcast_t structure below is provided for this purpose.
+ * Its sizes and alignment requirements are guaranteed to match those of the
+ * genuine structure, no matter which architecture is being used, and no matter
+ * how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_BROADCAST
+{
+    void * pvDummy1;
+    UBaseType_t uxDummy2[ 4 ];
+    StaticList_t xDummy3;
+
+    #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+        uint8_t ucDummy4;
+    #endif
+} StaticBroadcast_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the executor structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create an executor then the size of the executor object needs to be known.
+ * The StaticExecutor_t structure below is provided for this purpose.  Its sizes
+ * and alignment requirements are guaranteed to match those of the genuine
+ * structure, no matter which architecture is being used, and no matter how the
+ * values in FreeRTOSConfig.h are set.  Its contents are somewhat obfuscated in
+ * the hope users will recognise that it would be unwise to make direct use of
+ * the structure members.
+ */
+typedef struct xSTATIC_EXECUTOR
+{
+    StaticList_t xDummy1;
+    void * pvDummy2;
+    TaskFunction_t pvDummy3;
+    void * pvDummy4[ ( 2 * configEXECUTOR_MAX_PRIORITIES ) + 3 ];
+    TickType_t xDummy5;
+    UBaseType_t uxDummy6;
+} StaticExecutor_t;
+
+/*
+ * In line with software engineering best practice, especially when supplying a
+ * library that is likely to change in future versions, FreeRTOS implements a
+ * strict data hiding policy.  This means the task group structure used
+ * internally by FreeRTOS is not accessible to application code.  However, if
+ * the application writer wants to statically allocate the memory required to
+ * create a task group then the size of the task group object needs to be
+ * known.  The StaticTaskGroup_t structure below is provided for this purpose.
+ * Its sizes and alignment requirements are guaranteed to match those of the
+ * genuine structure, no matter which architecture is being used, and no matter
+ * how the values in FreeRTOSConfig.h are set.  Its contents are somewhat
+ * obfuscated in the hope users will recognise that it would be unwise to make
+ * direct use of the structure members.
+ */
+typedef struct xSTATIC_TASK_GROUP
+{
+    StaticList_t xDummy1[ configMAX_PRIORITIES + 1 ];
+    void * pvDummy2;
+    UBaseType_t uxDummy3[ 2 ];
+} StaticTaskGroup_t;
+
 /*
  * In line with software engineering best practice, especially when supplying a
  * library that is likely to change in future versions, FreeRTOS implements a
@@ -3287,6 +4500,10 @@ typedef struct xSTATIC_EVENT_GROUP
         UBaseType_t uxDummy3;
     #endif
 
+    #if ( configUSE_WAIT_ANY == 1 )
+        void * pvDummy5;
+    #endif
+
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucDummy4;
     #endif
@@ -3345,6 +4562,17 @@ typedef struct xSTATIC_STREAM_BUFFER
         void * pvDummy5[ 2 ];
     #endif
     UBaseType_t uxDummy6;
+    #if ( configUSE_WAIT_ANY == 1 )
+        void * pvDummy7;
+    #endif
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        size_t uxDummy8;
+    #endif
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        size_t uxDummy9;
+        TickType_t xDummy10;
+        BaseType_t xDummy11;
+    #endif
 } StaticStreamBuffer_t;
 
 /* Message buffers are built on stream buffers. */
@@ -0,0 +1,202 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef ALLOC_TRACE_H
+#define ALLOC_TRACE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include alloc_trace.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * The allocation tracer records every block that is currently allocated from
+ * the FreeRTOS heap, together with the return address of the pvPortMalloc()
+ * call that allocated it, the task that was running at the time, the size of
+ * the block and the tick count at which it was allocated.  It is included in
+ * the build by setting configUSE_ALLOC_TRACE to 1 in FreeRTOSConfig.h, and
+ * works with all the heap implementations (heap_1.c to heap_5.c).
+ *
+ * Records are held in a fixed size table of configALLOC_TRACE_MAX_RECORDS
+ * entries that is indexed by the allocated address, so recording an allocation
+ * or a free is O(1) on average.  If the table is full then new allocations are
+ * not recorded, and are counted by uxAllocTraceGetDroppedCount() instead.
+ *
+ * The tracer is driven by the traceMALLOC() and traceFREE() macros.  If the
+ * application provides its own definition of those macros then it must call
+ * vAllocTraceRecordMalloc() and vAllocTraceRecordFree() from them itself.
+ */
+
+/**
+ * alloc_trace.h
+ *
+ * Type used to return information about a single live allocation from
+ * uxAllocTraceGetRecords().
+ *
+ * \defgroup AllocTraceRecord_t AllocTraceRecord_t
+ * \ingroup AllocTrace
+ */
+typedef struct xALLOC_TRACE_RECORD
+{
+    void * pvAddress;      /* The address returned by pvPortMalloc(). */
+    void * pvCaller;       /* The return address of the pvPortMalloc() call, or NULL if configALLOC_TRACE_GET_CALLER() is not available. */
+    TaskHandle_t xTask;    /* The task that was running when the allocation was made, or NULL if the scheduler had not been started. */
+    size_t xSize;          /* The size of the block as reported to traceMALLOC(). */
+    TickType_t xTimeStamp; /* The tick count at the time of the allocation. */
+} AllocTraceRecord_t;
+
+/**
+ * alloc_trace.h
+ *
+ * Type used to return the live allocations grouped by call site and task from
+ * uxAllocTraceGetSummary().
+ *
+ * \defgroup AllocTraceSummary_t AllocTraceSummary_t
+ * \ingroup AllocTrace
+ */
+typedef struct xALLOC_TRACE_SUMMARY
+{
+    void * pvCaller;             /* The call site shared by all the allocations in this group. */
+    TaskHandle_t xTask;          /* The task shared by all the allocations in this group. */
+    UBaseType_t uxAllocations;   /* The number of live allocations in this group. */
+    size_t xTotalSize;           /* The sum of the sizes of the live allocations in this group. */
+    TickType_t xOldestTimeStamp; /* The time stamp of the oldest live allocation in this group. */
+} AllocTraceSummary_t;
+
+/**
+ * alloc_trace.h
+ * @code{c}
+ * UBaseType_t uxAllocTraceGetRecords( AllocTraceRecord_t * pxRecords, UBaseType_t uxMaxRecords );
+ * @endcode
+ *
+ * Takes a snapshot of the live allocations.
+ *
+ * @param pxRecords An array into which the records are written.
+ *
+ * @param uxMaxRecords The number of records that fit in pxRecords.  If there
+ * are more live allocations than this then only the first uxMaxRecords are
+ * written.
+ *
+ * @return The number of records written to pxRecords.
+ *
+ * \defgroup uxAllocTraceGetRecords uxAllocTraceGetRecords
+ * \ingroup AllocTrace
+ */
+UBaseType_t uxAllocTraceGetRecords( AllocTraceRecord_t * pxRecords,
+                                    UBaseType_t uxMaxRecords ) PRIVILEGED_FUNCTION;
+
+/**
+ * alloc_trace.h
+ * @code{c}
+ * UBaseType_t uxAllocTraceGetSummary( AllocTraceSummary_t * pxSummary, UBaseType_t uxMaxEntries );
+ * @endcode
+ *
+ * Groups the live allocations by call site and task, which is normally the
+ * quickest way to find out which code is holding the heap, or leaking from it.
+ * Grouping is O(n^2) in the number of live allocations, so this function is
+ * intended for debugging rather than for regular use.
+ *
+ * @param pxSummary An array into which one entry is written per group.
+ *
+ * @param uxMaxEntries The number of entries that fit in pxSummary.  Groups that
+ * do not fit are not reported.
+ *
+ * @return The number of entries written to pxSummary.
+ *
+ * \defgroup uxAllocTraceGetSummary uxAllocTraceGetSummary
+ * \ingroup AllocTrace
+ */
+UBaseType_t uxAllocTraceGetSummary( AllocTraceSummary_t * pxSummary,
+                                    UBaseType_t uxMaxEntries ) PRIVILEGED_FUNCTION;
+
+/**
+ * alloc_trace.h
+ * @code{c}
+ * UBaseType_t uxAllocTraceGetDroppedCount( void );
+ * @endcode
+ *
+ * @return The number of allocations that were not recorded because the record
+ * table was full.  If this is not zero then configALLOC_TRACE_MAX_RECORDS is too
+ * small and the reports are incomplete.
+ *
+ * \defgroup uxAllocTraceGetDroppedCount uxAllocTraceGetDroppedCount
+ * \ingroup AllocTrace
+ */
+UBaseType_t uxAllocTraceGetDroppedCount( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * alloc_trace.h
+ * @code{c}
+ * void vAllocTraceReport( char * pcWriteBuffer, size_t uxBufferLength );
+ * @endcode
+ *
+ * configUSE_STATS_FORMATTING_FUNCTIONS must be defined as 1 for this function
+ * to be available.  See the configuration section for more information.
+ *
+ * Writes the output of uxAllocTraceGetSummary() into pcWriteBuffer as a human
+ * readable table, one line per call site and task.  Each line holds the call
+ * site, the task handle and name, the number of allocations, the number of
+ * bytes and the time stamp of the oldest allocation, separated by tabs.  The
+ * task name is "-" for allocations made before the scheduler was started, and
+ * "?" if the task no longer exists or configUSE_TRACE_FACILITY is not 1.
+ *
+ * The first line holds the run time address of the record table so the call
+ * site addresses can be resolved on the host even when the executable is loaded
+ * at a random address.
+ * Source/portable/ThirdParty/GCC/Posix/utils/alloc_trace_decode.py does that
+ * for the Posix port.
+ *
+ * Like vTaskListTasks(), this function allocates a temporary buffer from the
+ * FreeRTOS heap and depends on snprintf(), so it is provided for convenience
+ * only.
+ *
+ * @param pcWriteBuffer A buffer into which the report is written in ASCII form.
+ *
+ * @param uxBufferLength Length of the pcWriteBuffer.
+ *
+ * \defgroup vAllocTraceReport vAllocTraceReport
+ * \ingroup AllocTrace
+ */
+void vAllocTraceReport( char * pcWriteBuffer,
+                        size_t uxBufferLength ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* ALLOC_TRACE_H */
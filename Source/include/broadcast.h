@@ -0,0 +1,352 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include broadcast.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A broadcast channel delivers every item written to it to every subscriber,
+ * without copying the item once per subscriber.  Items are held in a single
+ * ring buffer of fixed size items, and each subscriber keeps its own read
+ * position in a BroadcastSubscriber_t variable that it owns.  The channel does
+ * not know how many subscribers there are, so subscribing and unsubscribing
+ * cost nothing, and publishing takes the same time whatever the number of
+ * subscribers.
+ *
+ * Publishing never blocks and never fails.  When the ring buffer is full the
+ * oldest item is overwritten, so a subscriber that does not keep up loses
+ * items rather than holding up the publisher or the other subscribers.  The
+ * number of items a subscriber lost is reported by the next successful
+ * xBroadcastReceive() so the subscriber can resynchronise.
+ *
+ * Publishing unblocks every task that is waiting to receive from the channel.
+ *
+ * configUSE_BROADCAST_CHANNELS must be set to 1 in FreeRTOSConfig.h for the
+ * broadcast channel API to be available.
+ *
+ * Broadcast channels are referenced by handles of type BroadcastHandle_t.
+ *
+ * \defgroup BroadcastHandle_t BroadcastHandle_t
+ * \ingroup Broadcast
+ */
+struct BroadcastDefinition;
+typedef struct BroadcastDefinition   * BroadcastHandle_t;
+
+/**
+ * broadcast.h
+ *
+ * Holds the read position of one subscriber to a broadcast channel.  The
+ * variable belongs to the subscriber, must remain in scope for as long as the
+ * subscriber uses it, and must only be used by one task at a time.  It is
+ * initialised by vBroadcastSubscribe() and must not be modified directly.
+ *
+ * \defgroup BroadcastSubscriber_t BroadcastSubscriber_t
+ * \ingroup Broadcast
+ */
+typedef struct xBROADCAST_SUBSCRIBER
+{
+    BroadcastHandle_t xChannel; /* The channel the subscriber reads from. */
+    UBaseType_t uxNextItem;     /* The sequence number of the next item to read. */
+} BroadcastSubscriber_t;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength, UBaseType_t uxItemSize );
+ * @endcode
+ *
+ * Creates a new broadcast channel, and returns a handle by which the channel
+ * can be referenced.  The memory used by the channel, including its ring
+ * buffer, is allocated from the FreeRTOS heap.  Use xBroadcastCreateStatic()
+ * to provide the memory instead.
+ *
+ * @param uxLength The number of items the channel holds.  A subscriber that
+ * falls more than uxLength items behind the publisher loses the oldest items.
+ *
+ * @param uxItemSize The size, in bytes, of each item.  Items are copied into
+ * and out of the channel.
+ *
+ * @return If the channel was created then a handle to the channel is returned.
+ * If there was insufficient FreeRTOS heap available to create the channel then
+ * NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  BroadcastHandle_t xSamples;
+ *
+ *  void vSensorTask( void * pvParameters )
+ *  {
+ *      Sample_t xSample;
+ *
+ *      for( ;; )
+ *      {
+ *          vReadSensor( &xSample );
+ *
+ *          // Every subscriber will see xSample.
+ *          vBroadcastPublish( xSamples, &xSample );
+ *      }
+ *  }
+ *
+ *  void vLoggerTask( void * pvParameters )
+ *  {
+ *      BroadcastSubscriber_t xSubscriber;
+ *      Sample_t xSample;
+ *      UBaseType_t uxLost;
+ *
+ *      vBroadcastSubscribe( xSamples, &xSubscriber );
+ *
+ *      for( ;; )
+ *      {
+ *          if( xBroadcastReceive( &xSubscriber, &xSample, &uxLost, portMAX_DELAY ) == pdPASS )
+ *          {
+ *              if( uxLost != 0 )
+ *              {
+ *                  // The logger fell behind and uxLost samples were
+ *                  // overwritten before it could read them.
+ *              }
+ *
+ *              vLogSample( &xSample );
+ *          }
+ *      }
+ *  }
+ * @endcode
+ * \defgroup xBroadcastCreate xBroadcastCreate
+ * \ingroup Broadcast
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    BroadcastHandle_t xBroadcastCreate( UBaseType_t uxLength,
+                                        UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BroadcastHandle_t xBroadcastCreateStatic( UBaseType_t uxLength, UBaseType_t uxItemSize, uint8_t * pucStorageBuffer, StaticBroadcast_t * pxChannelBuffer );
+ * @endcode
+ *
+ * Creates a new broadcast channel using memory provided by the application
+ * writer, and returns a handle by which the channel can be referenced.
+ *
+ * @param uxLength The number of items the channel holds.
+ *
+ * @param uxItemSize The size, in bytes, of each item.
+ *
+ * @param pucStorageBuffer Must point to a uint8_t array that is at least
+ * uxLength * uxItemSize bytes long.  The items are held in this array.
+ *
+ * @param pxChannelBuffer Must point to a variable of type StaticBroadcast_t,
+ * which will be used to hold the channel's data structure.
+ *
+ * @return If the channel was created then a handle to the channel is returned.
+ * If pucStorageBuffer or pxChannelBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xBroadcastCreateStatic xBroadcastCreateStatic
+ * \ingroup Broadcast
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    BroadcastHandle_t xBroadcastCreateStatic( UBaseType_t uxLength,
+                                              UBaseType_t uxItemSize,
+                                              uint8_t * pucStorageBuffer,
+                                              StaticBroadcast_t * pxChannelBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastSubscribe( BroadcastHandle_t xChannel, BroadcastSubscriber_t * pxSubscriber );
+ * @endcode
+ *
+ * Initialises pxSubscriber to read from xChannel.  The subscriber receives the
+ * items published after this call, not the items already in the channel.
+ * Calling vBroadcastSubscribe() again on the same subscriber discards any
+ * items it has not read yet.
+ *
+ * There is no need to unsubscribe, as the channel holds no reference to the
+ * subscriber.
+ *
+ * @param xChannel The channel to subscribe to.
+ *
+ * @param pxSubscriber The variable that will hold the subscriber's read
+ * position.
+ *
+ * \defgroup vBroadcastSubscribe vBroadcastSubscribe
+ * \ingroup Broadcast
+ */
+void vBroadcastSubscribe( BroadcastHandle_t xChannel,
+                          BroadcastSubscriber_t * pxSubscriber ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastPublish( BroadcastHandle_t xChannel, const void * pvItem );
+ * @endcode
+ *
+ * Copies an item into the channel, overwriting the oldest item if the channel
+ * is full, and unblocks all the tasks that are waiting to receive from the
+ * channel.  Never blocks.
+ *
+ * @param xChannel The channel to publish to.
+ *
+ * @param pvItem A pointer to the item to publish.  The number of bytes copied
+ * is the item size the channel was created with.
+ *
+ * \defgroup vBroadcastPublish vBroadcastPublish
+ * \ingroup Broadcast
+ */
+void vBroadcastPublish( BroadcastHandle_t xChannel,
+                        const void * pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastPublishFromISR( BroadcastHandle_t xChannel, const void * pvItem, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of vBroadcastPublish() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xChannel The channel to publish to.
+ *
+ * @param pvItem A pointer to the item to publish.
+ *
+ * @param pxHigherPriorityTaskWoken vBroadcastPublishFromISR() sets
+ * *pxHigherPriorityTaskWoken to pdTRUE if publishing unblocked a task that has
+ * a priority above the priority of the currently running task.  If it is set
+ * to pdTRUE then a context switch should be requested before the interrupt is
+ * exited.  pxHigherPriorityTaskWoken can be NULL.
+ *
+ * \defgroup vBroadcastPublishFromISR vBroadcastPublishFromISR
+ * \ingroup Broadcast
+ */
+void vBroadcastPublishFromISR( BroadcastHandle_t xChannel,
+                               const void * pvItem,
+                               BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BaseType_t xBroadcastReceive( BroadcastSubscriber_t * pxSubscriber, void * pvBuffer, UBaseType_t * puxItemsLost, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Copies the next item the subscriber has not yet read out of the channel,
+ * waiting in the Blocked state for an item to be published if there is none.
+ * Reading an item does not remove it from the channel, so the other
+ * subscribers still receive it.
+ *
+ * @param pxSubscriber The subscriber that is receiving, as initialised by
+ * vBroadcastSubscribe().
+ *
+ * @param pvBuffer The buffer into which the item is copied.  It must be at
+ * least as large as the item size the channel was created with.
+ *
+ * @param puxItemsLost If the subscriber fell so far behind that items it had
+ * not read were overwritten then the number of overwritten items is written to
+ * *puxItemsLost, and the oldest item still in the channel is received.
+ * Otherwise 0 is written.  puxItemsLost can be NULL.
+ *
+ * @param xTicksToWait The maximum time to wait for an item if the subscriber
+ * has read all the items in the channel.
+ *
+ * @return pdPASS if an item was received, otherwise errQUEUE_EMPTY.
+ *
+ * \defgroup xBroadcastReceive xBroadcastReceive
+ * \ingroup Broadcast
+ */
+BaseType_t xBroadcastReceive( BroadcastSubscriber_t * pxSubscriber,
+                              void * pvBuffer,
+                              UBaseType_t * puxItemsLost,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * BaseType_t xBroadcastReceiveFromISR( BroadcastSubscriber_t * pxSubscriber, void * pvBuffer, UBaseType_t * puxItemsLost );
+ * @endcode
+ *
+ * A version of xBroadcastReceive() that can be called from an interrupt
+ * service routine.  It never blocks.
+ *
+ * \defgroup xBroadcastReceiveFromISR xBroadcastReceiveFromISR
+ * \ingroup Broadcast
+ */
+BaseType_t xBroadcastReceiveFromISR( BroadcastSubscriber_t * pxSubscriber,
+                                     void * pvBuffer,
+                                     UBaseType_t * puxItemsLost ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * UBaseType_t uxBroadcastItemsWaiting( const BroadcastSubscriber_t * pxSubscriber );
+ * @endcode
+ *
+ * Can be called from a task or from an interrupt service routine.
+ *
+ * @return The number of items the subscriber can receive without blocking.
+ * This is never more than the length of the channel.
+ *
+ * \defgroup uxBroadcastItemsWaiting uxBroadcastItemsWaiting
+ * \ingroup Broadcast
+ */
+UBaseType_t uxBroadcastItemsWaiting( const BroadcastSubscriber_t * pxSubscriber ) PRIVILEGED_FUNCTION;
+
+/**
+ * broadcast.h
+ * @code{c}
+ * void vBroadcastDelete( BroadcastHandle_t xChannel );
+ * @endcode
+ *
+ * Deletes a broadcast channel.  No task may be waiting to receive from the
+ * channel, and its subscribers must not be used again.
+ *
+ * @param xChannel The channel to delete.
+ *
+ * \defgroup vBroadcastDelete vBroadcastDelete
+ * \ingroup Broadcast
+ */
+void vBroadcastDelete( BroadcastHandle_t xChannel ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* BROADCAST_H */
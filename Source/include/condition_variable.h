@@ -0,0 +1,250 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef CONDITION_VARIABLE_H
+#define CONDITION_VARIABLE_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include condition_variable.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+#include "semphr.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A condition variable lets a task that holds a mutex wait for some condition
+ * of the data protected by that mutex to become true, and lets other tasks
+ * wake it once they have made the condition true.  xCondVarWait() gives back
+ * the mutex and blocks the calling task in a single step, so a signal sent
+ * after the mutex is given back cannot be missed.  The mutex is taken again
+ * before xCondVarWait() returns.
+ *
+ * The mutex must be a FreeRTOS mutex created with xSemaphoreCreateMutex() or
+ * xSemaphoreCreateMutexStatic().  All the tasks waiting on a condition variable
+ * at the same time must use the same mutex.
+ *
+ * Waiting tasks are held in priority order, so xCondVarSignal() wakes the
+ * highest priority waiting task.  xCondVarBroadcast() wakes only the highest
+ * priority waiting task if the mutex is held, and moves the other waiting tasks
+ * directly onto the list of tasks waiting for the mutex, so they are woken one
+ * at a time as the mutex is given back instead of all waking only to block on
+ * the mutex again.
+ *
+ * configUSE_MUTEXES and configUSE_CONDITION_VARIABLES must both be set to 1 in
+ * FreeRTOSConfig.h for the condition variable API to be available.
+ *
+ * Condition variables are referenced by handles of type CondVarHandle_t.
+ *
+ * \defgroup CondVarHandle_t CondVarHandle_t
+ * \ingroup CondVar
+ */
+struct CondVarDefinition;
+typedef struct CondVarDefinition   * CondVarHandle_t;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * CondVarHandle_t xCondVarCreate( void );
+ * @endcode
+ *
+ * Creates a new condition variable, and returns a handle by which the
+ * condition variable can be referenced.  The memory used by the condition
+ * variable is allocated from the FreeRTOS heap.  Use xCondVarCreateStatic() to
+ * provide the memory instead.
+ *
+ * @return If the condition variable was created then a handle to the condition
+ * variable is returned.  If there was insufficient FreeRTOS heap available to
+ * create the condition variable then NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  SemaphoreHandle_t xBufferMutex;
+ *  CondVarHandle_t xBufferNotEmpty;
+ *  UBaseType_t uxItemsInBuffer;
+ *
+ *  void vConsumer( void )
+ *  {
+ *      xSemaphoreTake( xBufferMutex, portMAX_DELAY );
+ *
+ *      // The condition must be checked again each time the task is woken, as
+ *      // another task may have emptied the buffer first.
+ *      while( uxItemsInBuffer == 0 )
+ *      {
+ *          xCondVarWait( xBufferNotEmpty, xBufferMutex, portMAX_DELAY );
+ *      }
+ *
+ *      // Remove an item from the buffer.
+ *
+ *      xSemaphoreGive( xBufferMutex );
+ *  }
+ *
+ *  void vProducer( void )
+ *  {
+ *      xSemaphoreTake( xBufferMutex, portMAX_DELAY );
+ *
+ *      // Add an item to the buffer.
+ *
+ *      xCondVarSignal( xBufferNotEmpty );
+ *      xSemaphoreGive( xBufferMutex );
+ *  }
+ * @endcode
+ * \defgroup xCondVarCreate xCondVarCreate
+ * \ingroup CondVar
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    CondVarHandle_t xCondVarCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t * pxCondVarBuffer );
+ * @endcode
+ *
+ * Creates a new condition variable using memory provided by the application
+ * writer, and returns a handle by which the condition variable can be
+ * referenced.
+ *
+ * @param pxCondVarBuffer Must point to a variable of type StaticCondVar_t,
+ * which will be used to hold the condition variable's data structure.
+ *
+ * @return If the condition variable was created then a handle to the condition
+ * variable is returned.  If pxCondVarBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xCondVarCreateStatic xCondVarCreateStatic
+ * \ingroup CondVar
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    CondVarHandle_t xCondVarCreateStatic( StaticCondVar_t * pxCondVarBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * BaseType_t xCondVarWait( CondVarHandle_t xCondVar, SemaphoreHandle_t xMutex, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Gives back xMutex and waits in the Blocked state for the condition variable
+ * to be signalled, then takes xMutex again.  The calling task must hold xMutex,
+ * and must not hold it recursively.  Must only be called from a task.
+ *
+ * xMutex is always held again when xCondVarWait() returns, even if
+ * xTicksToWait expired, so the function can take longer than xTicksToWait to
+ * return if another task holds the mutex at that time.  As with any condition
+ * variable the calling task must check the condition again after
+ * xCondVarWait() returns.
+ *
+ * @param xCondVar The handle of the condition variable.
+ *
+ * @param xMutex The handle of the mutex that protects the condition.
+ *
+ * @param xTicksToWait The maximum time, in ticks, the calling task should wait
+ * in the Blocked state for the condition variable to be signalled.
+ *
+ * @return pdPASS if the task was woken before xTicksToWait expired, otherwise
+ * pdFAIL.
+ *
+ * \defgroup xCondVarWait xCondVarWait
+ * \ingroup CondVar
+ */
+BaseType_t xCondVarWait( CondVarHandle_t xCondVar,
+                         SemaphoreHandle_t xMutex,
+                         TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * BaseType_t xCondVarSignal( CondVarHandle_t xCondVar );
+ * @endcode
+ *
+ * Wakes the highest priority task waiting on the condition variable, if any.
+ * The calling task does not need to hold the mutex, but must hold it if the
+ * woken task is to be guaranteed to see the change to the condition.  Must only
+ * be called from a task.
+ *
+ * @param xCondVar The handle of the condition variable.
+ *
+ * @return pdTRUE if a task was woken, otherwise pdFALSE.
+ *
+ * \defgroup xCondVarSignal xCondVarSignal
+ * \ingroup CondVar
+ */
+BaseType_t xCondVarSignal( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * BaseType_t xCondVarBroadcast( CondVarHandle_t xCondVar );
+ * @endcode
+ *
+ * Wakes all the tasks waiting on the condition variable.  If the mutex is held
+ * when xCondVarBroadcast() is called then only the highest priority waiting
+ * task is unblocked, and the other waiting tasks are moved onto the list of
+ * tasks waiting for the mutex.  Must only be called from a task.
+ *
+ * @param xCondVar The handle of the condition variable.
+ *
+ * @return pdTRUE if any task was waiting on the condition variable, otherwise
+ * pdFALSE.
+ *
+ * \defgroup xCondVarBroadcast xCondVarBroadcast
+ * \ingroup CondVar
+ */
+BaseType_t xCondVarBroadcast( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/**
+ * condition_variable.h
+ * @code{c}
+ * void vCondVarDelete( CondVarHandle_t xCondVar );
+ * @endcode
+ *
+ * Deletes a condition variable, freeing its memory if it was created with
+ * xCondVarCreate().  No task may be waiting on the condition variable when it
+ * is deleted.
+ *
+ * @param xCondVar The handle of the condition variable being deleted.
+ *
+ * \defgroup vCondVarDelete vCondVarDelete
+ * \ingroup CondVar
+ */
+void vCondVarDelete( CondVarHandle_t xCondVar ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* CONDITION_VARIABLE_H */
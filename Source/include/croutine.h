@@ -41,6 +41,11 @@
 #endif
 /* *INDENT-ON* */
 
+/* Co-routines are retained for compatibility.  New designs should use the
+ * executors in executor.h instead, which provide the same stackless execution
+ * model from an ordinary task, and allow handlers to wait for event groups,
+ * stream buffers and notifications as well as queues. */
+
 /* Used to hide the implementation of the co-routine control block.  The
  * control block structure however has to be included in the header due to
  * the macro implementation of the co-routine functionality. */
@@ -0,0 +1,541 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef EXECUTOR_H
+#define EXECUTOR_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include executor.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+#include "wait_any.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * An executor runs any number of lightweight handlers from within one
+ * ordinary task, the host task, so the handlers share the host task's stack
+ * rather than each needing a stack of its own.  It supersedes the co-routines
+ * in croutine.h:
+ * - handlers can wait for queues, semaphores, event groups, stream buffers,
+ *   message buffers, notifications sent to the handler, and time;
+ * - the host is a normal task, so the executor needs no hook in the idle task
+ *   and its handlers are scheduled against the other tasks by the host task's
+ *   priority;
+ * - handlers that are ready to run are run highest priority first, in first
+ *   in first out order within a priority.
+ *
+ * Handlers are stackless.  A handler is a function that is called each time
+ * the handler runs, and that must return to the executor instead of blocking.
+ * Before returning it calls one of the vExecutorAwait...() functions to say
+ * what it is waiting for, and is called again once that event has happened or
+ * the wait has timed out.  A handler that returns without awaiting anything
+ * has finished, and is not called again.  Local variables do not keep their
+ * values from one call to the next, so state that must survive a wait is kept
+ * in the structure pointed to by the handler's parameter.  The executorBEGIN(),
+ * executorAWAIT() and executorEND() macros let a handler be written as a
+ * straight sequence of steps rather than as an explicit state machine.
+ *
+ * Each handler is held in an ExecutorHandler_t variable provided by the
+ * application, which makes it practical to run hundreds of handlers in the
+ * RAM that a few tasks would need.  On a 32-bit target with a 32-bit
+ * TickType_t an ExecutorHandler_t takes 44 bytes, so 500 handlers need about
+ * 22KB, plus whatever state each keeps in the structure pointed to by its
+ * parameter.  The handler cannot be made much smaller, as each one needs its
+ * own function, parameter, timeout, notification value and links, and sharing
+ * any of them between handlers would make waiting, timing out or notifying
+ * take time proportional to the number of handlers.
+ *
+ * configUSE_EXECUTORS and configUSE_WAIT_ANY must both be set to 1 in
+ * FreeRTOSConfig.h for the executor API to be available.
+ *
+ * Executors are referenced by handles of type ExecutorHandle_t.
+ *
+ * \defgroup ExecutorHandle_t ExecutorHandle_t
+ * \ingroup Executor
+ */
+struct ExecutorDefinition;
+typedef struct ExecutorDefinition   * ExecutorHandle_t;
+
+struct xEXECUTOR_HANDLER;
+
+/**
+ * executor.h
+ *
+ * Defines the prototype to which handler functions must conform.  pxHandler
+ * is the handler being run and pvParameters is the value passed to
+ * vExecutorAddHandler().
+ *
+ * \defgroup ExecutorHandlerFunction_t ExecutorHandlerFunction_t
+ * \ingroup Executor
+ */
+typedef void (* ExecutorHandlerFunction_t)( struct xEXECUTOR_HANDLER * pxHandler,
+                                            void * pvParameters );
+
+/**
+ * executor.h
+ *
+ * Holds what a handler is waiting for while it waits for a queue, semaphore,
+ * event group or stream buffer.  Only handlers that wait for such objects
+ * need one, and each of them needs only one, which it would normally keep
+ * with the rest of its state in the structure pointed to by its parameter.
+ * The variable belongs to the application, and must remain in scope until
+ * the handler next runs after the wait.  Its members must not be accessed
+ * directly.
+ *
+ * \defgroup ExecutorAwaitSlot_t ExecutorAwaitSlot_t
+ * \ingroup Executor
+ */
+typedef struct xEXECUTOR_AWAIT_SLOT
+{
+    WaitAnyObject_t xObject;                /* Linked into the object being waited for.  Must be the first member. */
+    struct xEXECUTOR_HANDLER * pxHandler;   /* The handler that is waiting. */
+} ExecutorAwaitSlot_t;
+
+/**
+ * executor.h
+ *
+ * Holds the state of one handler.  The variable belongs to the application,
+ * must remain in scope for as long as the handler is in an executor, and is
+ * initialised by vExecutorAddHandler().  Its members must not be accessed
+ * directly, other than by the executorBEGIN(), executorAWAIT() and
+ * executorEND() macros.
+ *
+ * \defgroup ExecutorHandler_t ExecutorHandler_t
+ * \ingroup Executor
+ */
+typedef struct xEXECUTOR_HANDLER
+{
+    struct xEXECUTOR_HANDLER * pxNext;              /* Links the handler into one of the executor's ready chains, or into one of its delayed chains, but never both. */
+    struct xEXECUTOR_HANDLER * pxPrevious;          /* Links the handler backwards in a delayed chain, so it can be removed without searching.  Not used in the ready chains. */
+    struct xEXECUTOR_HANDLER * pxNextPending;       /* Links the handlers whose events have happened but which the executor has not yet made ready. */
+    ExecutorAwaitSlot_t * pxAwaitSlot;              /* Linked into the object the handler is waiting for, if any. */
+    ExecutorHandle_t xExecutor;                     /* The executor the handler was added to. */
+    ExecutorHandlerFunction_t pxHandlerFunction;    /* The function that is called each time the handler runs. */
+    void * pvParameters;                            /* Passed to pxHandlerFunction. */
+    TickType_t xTimeToWake;                         /* The tick count at which the handler times out, while it is in a delayed chain. */
+    volatile uint32_t ulNotifiedValue;              /* The bits set by xExecutorNotify() and not yet taken. */
+    UBaseType_t uxPriority;                         /* The priority of the handler relative to the other handlers in the executor. */
+    uint16_t usResumePoint;                         /* Used by the executorBEGIN() and executorAWAIT() macros. */
+    volatile uint8_t ucState;                       /* One of the executorSTATE_ values in executor.c. */
+    uint8_t ucFlags;                                /* What the handler is waiting for, and whether the wait timed out. */
+} ExecutorHandler_t;
+
+/**
+ * executor.h
+ *
+ * Macros that let a handler be written as a sequence of steps that wait for
+ * events in between, without the handler needing its own stack.
+ * executorAWAIT() records where the handler is, calls one of the
+ * vExecutorAwait...() functions and returns to the executor.  When the handler
+ * next runs, executorBEGIN() jumps back to just after that executorAWAIT().
+ * executorEND() marks the end of the handler, after which it has finished.
+ *
+ * As with co-routines, executorAWAIT() can only be used in the handler
+ * function itself, not in functions it calls, and not from within a switch
+ * statement.  Local variables do not keep their values across an
+ * executorAWAIT().
+ *
+ * Example usage:
+ * @code{c}
+ *  typedef struct
+ *  {
+ *      QueueHandle_t xRequests;
+ *      ExecutorAwaitSlot_t xAwaitSlot;
+ *      uint32_t ulRequest;
+ *  } Connection_t;
+ *
+ *  void vConnectionHandler( ExecutorHandler_t * pxHandler, void * pvParameters )
+ *  {
+ *      Connection_t * pxConnection = ( Connection_t * ) pvParameters;
+ *
+ *      executorBEGIN( pxHandler );
+ *
+ *      for( ;; )
+ *      {
+ *          // Wait for up to 100ms for a request to arrive.
+ *          executorAWAIT( pxHandler, vExecutorAwaitQueue( pxHandler, &( pxConnection->xAwaitSlot ), pxConnection->xRequests, pdMS_TO_TICKS( 100 ) ) );
+ *
+ *          if( xQueueReceive( pxConnection->xRequests, &( pxConnection->ulRequest ), 0 ) == pdPASS )
+ *          {
+ *              vProcessRequest( pxConnection );
+ *          }
+ *          else
+ *          {
+ *              // Timed out.  Wait 10ms before checking the link.
+ *              executorAWAIT( pxHandler, vExecutorDelay( pxHandler, pdMS_TO_TICKS( 10 ) ) );
+ *              vCheckLink( pxConnection );
+ *          }
+ *      }
+ *
+ *      executorEND( pxHandler );
+ *  }
+ * @endcode
+ * \defgroup executorBEGIN executorBEGIN
+ * \ingroup Executor
+ */
+#define executorBEGIN( pxHandler )    switch( ( pxHandler )->usResumePoint ) { case 0U:
+#define executorAWAIT( pxHandler, xAwait )                          \
+    do {                                                            \
+        ( pxHandler )->usResumePoint = ( uint16_t ) ( __LINE__ );   \
+        xAwait;                                                     \
+        return;                                                     \
+        case ( __LINE__ ):                                          \
+        ;                                                           \
+    } while( 0 )
+#define executorEND( pxHandler )      } ( pxHandler )->usResumePoint = 0U
+
+/**
+ * executor.h
+ * @code{c}
+ * ExecutorHandle_t xExecutorCreate( void );
+ * @endcode
+ *
+ * Creates a new executor, and returns a handle by which it can be referenced.
+ * The memory used by the executor is allocated from the FreeRTOS heap.  Use
+ * xExecutorCreateStatic() to provide the memory instead.  The executor does
+ * not run any handlers until a task calls vExecutorRun().
+ *
+ * @return If the executor was created then a handle to the executor is
+ * returned.  If there was insufficient FreeRTOS heap available to create the
+ * executor then NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  #define NUM_CONNECTIONS    200
+ *
+ *  static ExecutorHandler_t xHandlers[ NUM_CONNECTIONS ];
+ *  static Connection_t xConnections[ NUM_CONNECTIONS ];
+ *
+ *  void vExecutorTask( void * pvParameters )
+ *  {
+ *      ExecutorHandle_t xExecutor;
+ *      UBaseType_t x;
+ *
+ *      xExecutor = xExecutorCreate();
+ *      configASSERT( xExecutor );
+ *
+ *      for( x = 0; x < NUM_CONNECTIONS; x++ )
+ *      {
+ *          vExecutorAddHandler( xExecutor, &( xHandlers[ x ] ), vConnectionHandler, &( xConnections[ x ] ), 0 );
+ *      }
+ *
+ *      // Run the handlers.  Does not return.
+ *      vExecutorRun( xExecutor );
+ *  }
+ * @endcode
+ * \defgroup xExecutorCreate xExecutorCreate
+ * \ingroup Executor
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    ExecutorHandle_t xExecutorCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * executor.h
+ * @code{c}
+ * ExecutorHandle_t xExecutorCreateStatic( StaticExecutor_t * pxExecutorBuffer );
+ * @endcode
+ *
+ * Creates a new executor using memory provided by the application writer, and
+ * returns a handle by which it can be referenced.
+ *
+ * @param pxExecutorBuffer Must point to a variable of type StaticExecutor_t,
+ * which will be used to hold the executor's data structure.
+ *
+ * @return If the executor was created then a handle to the executor is
+ * returned.  If pxExecutorBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xExecutorCreateStatic xExecutorCreateStatic
+ * \ingroup Executor
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    ExecutorHandle_t xExecutorCreateStatic( StaticExecutor_t * pxExecutorBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorRun( ExecutorHandle_t xExecutor );
+ * @endcode
+ *
+ * Runs the executor's handlers in the calling task, which becomes the
+ * executor's host task.  The host task runs whichever ready handler has the
+ * highest priority, and is in the Blocked state, using no CPU time, while none
+ * of the handlers is ready.  Never returns.  Must only be called by one task
+ * for each executor.
+ *
+ * @param xExecutor The executor to run.
+ *
+ * \defgroup vExecutorRun vExecutorRun
+ * \ingroup Executor
+ */
+void vExecutorRun( ExecutorHandle_t xExecutor ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAddHandler( ExecutorHandle_t xExecutor, ExecutorHandler_t * pxHandler, ExecutorHandlerFunction_t pxHandlerFunction, void * pvParameters, UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Adds a handler to an executor.  The handler runs for the first time as soon
+ * as the executor has no higher priority handler to run.  Can be called from
+ * any task, including from a handler.  A handler that has finished can be
+ * added again, in which case it starts again from the beginning.
+ *
+ * @param xExecutor The executor to add the handler to.
+ *
+ * @param pxHandler The variable that will hold the handler's state.  Must not
+ * already be in an executor.
+ *
+ * @param pxHandlerFunction The function that is called each time the handler
+ * runs.
+ *
+ * @param pvParameters Passed to pxHandlerFunction each time it is called.
+ *
+ * @param uxPriority The priority of the handler relative to the other handlers
+ * in the same executor, from 0 to ( configEXECUTOR_MAX_PRIORITIES - 1 ).
+ *
+ * \defgroup vExecutorAddHandler vExecutorAddHandler
+ * \ingroup Executor
+ */
+void vExecutorAddHandler( ExecutorHandle_t xExecutor,
+                          ExecutorHandler_t * pxHandler,
+                          ExecutorHandlerFunction_t pxHandlerFunction,
+                          void * pvParameters,
+                          UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAwaitQueue( ExecutorHandler_t * pxHandler, ExecutorAwaitSlot_t * pxAwaitSlot, QueueHandle_t xQueue, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Makes the handler wait until xQueue holds an item, or until xTicksToWait
+ * ticks have passed.  Also used for semaphores and mutexes, which the handler
+ * waits to be able to take.  As with pxWaitAny(), the handler is not given the
+ * item - it must read it, or take the semaphore, itself with a block time of
+ * zero when it next runs.  Single producer single consumer queues cannot be
+ * waited for.
+ *
+ * The vExecutorAwait...() functions, vExecutorDelay() and vExecutorYield() can
+ * only be called by a handler, about itself, while it is running, and only
+ * once each time it runs.  The handler must return to the executor after
+ * calling one of them.
+ *
+ * @param pxHandler The handler that is running.
+ *
+ * @param pxAwaitSlot Holds what the handler is waiting for until the handler
+ * next runs.  See ExecutorAwaitSlot_t.
+ *
+ * @param xQueue The queue or semaphore to wait for.
+ *
+ * @param xTicksToWait The maximum time to wait, in ticks.  portMAX_DELAY waits
+ * indefinitely.  If 0 then the handler runs again straight away.  Use
+ * xExecutorTimedOut() to find out whether the wait timed out.
+ *
+ * \defgroup vExecutorAwaitQueue vExecutorAwaitQueue
+ * \ingroup Executor
+ */
+void vExecutorAwaitQueue( ExecutorHandler_t * pxHandler,
+                          ExecutorAwaitSlot_t * pxAwaitSlot,
+                          QueueHandle_t xQueue,
+                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAwaitEventGroup( ExecutorHandler_t * pxHandler, ExecutorAwaitSlot_t * pxAwaitSlot, EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Makes the handler wait until any of uxBitsToWaitFor are set in xEventGroup,
+ * or until xTicksToWait ticks have passed.  The bits are not cleared.
+ * configUSE_EVENT_GROUPS must be set to 1.
+ *
+ * \defgroup vExecutorAwaitEventGroup vExecutorAwaitEventGroup
+ * \ingroup Executor
+ */
+#if ( configUSE_EVENT_GROUPS == 1 )
+    void vExecutorAwaitEventGroup( ExecutorHandler_t * pxHandler,
+                                   ExecutorAwaitSlot_t * pxAwaitSlot,
+                                   EventGroupHandle_t xEventGroup,
+                                   EventBits_t uxBitsToWaitFor,
+                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAwaitStreamBuffer( ExecutorHandler_t * pxHandler, ExecutorAwaitSlot_t * pxAwaitSlot, StreamBufferHandle_t xStreamBuffer, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Makes the handler wait until xStreamBuffer holds at least its trigger level
+ * of bytes, or a message if it is a message buffer, or until xTicksToWait
+ * ticks have passed.  configUSE_STREAM_BUFFERS must be set to 1.
+ *
+ * \defgroup vExecutorAwaitStreamBuffer vExecutorAwaitStreamBuffer
+ * \ingroup Executor
+ */
+#if ( configUSE_STREAM_BUFFERS == 1 )
+    void vExecutorAwaitStreamBuffer( ExecutorHandler_t * pxHandler,
+                                     ExecutorAwaitSlot_t * pxAwaitSlot,
+                                     StreamBufferHandle_t xStreamBuffer,
+                                     TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorAwaitNotification( ExecutorHandler_t * pxHandler, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Makes the handler wait until xExecutorNotify() sets any bits in its
+ * notification value, or until xTicksToWait ticks have passed.  Returns
+ * straight away if bits were set before the call.  Use
+ * ulExecutorTakeNotification() to read and clear the bits.
+ *
+ * \defgroup vExecutorAwaitNotification vExecutorAwaitNotification
+ * \ingroup Executor
+ */
+void vExecutorAwaitNotification( ExecutorHandler_t * pxHandler,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorDelay( ExecutorHandler_t * pxHandler, TickType_t xTicksToDelay );
+ * @endcode
+ *
+ * Makes the handler wait for xTicksToDelay ticks, measured from when it
+ * started running.  xExecutorTimedOut() returns pdTRUE when the handler next
+ * runs.
+ *
+ * \defgroup vExecutorDelay vExecutorDelay
+ * \ingroup Executor
+ */
+void vExecutorDelay( ExecutorHandler_t * pxHandler,
+                     TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * void vExecutorYield( ExecutorHandler_t * pxHandler );
+ * @endcode
+ *
+ * Makes the handler run again after any other ready handlers of the same
+ * priority.
+ *
+ * \defgroup vExecutorYield vExecutorYield
+ * \ingroup Executor
+ */
+void vExecutorYield( ExecutorHandler_t * pxHandler ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * BaseType_t xExecutorTimedOut( const ExecutorHandler_t * pxHandler );
+ * @endcode
+ *
+ * @return pdTRUE if the handler is running because the time it was waiting
+ * for passed, and pdFALSE if it is running because the event it was waiting
+ * for happened or because it was just added or yielded.
+ *
+ * \defgroup xExecutorTimedOut xExecutorTimedOut
+ * \ingroup Executor
+ */
+BaseType_t xExecutorTimedOut( const ExecutorHandler_t * pxHandler ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * BaseType_t xExecutorNotify( ExecutorHandler_t * pxHandler, uint32_t ulBitsToSet );
+ * @endcode
+ *
+ * Sets bits in a handler's notification value, and makes the handler ready to
+ * run if it is waiting in vExecutorAwaitNotification().  Can be called from
+ * any task, including from another handler.
+ *
+ * @param pxHandler The handler to notify.
+ *
+ * @param ulBitsToSet The bits to set.  Must not be 0.
+ *
+ * @return pdPASS if the handler was waiting for a notification, otherwise
+ * pdFAIL.  The bits are set either way.
+ *
+ * \defgroup xExecutorNotify xExecutorNotify
+ * \ingroup Executor
+ */
+BaseType_t xExecutorNotify( ExecutorHandler_t * pxHandler,
+                            uint32_t ulBitsToSet ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * BaseType_t xExecutorNotifyFromISR( ExecutorHandler_t * pxHandler, uint32_t ulBitsToSet, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xExecutorNotify() that can be called from an interrupt service
+ * routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if unblocking the
+ * executor's host task means a context switch should be requested before the
+ * interrupt exits.
+ *
+ * \defgroup xExecutorNotifyFromISR xExecutorNotifyFromISR
+ * \ingroup Executor
+ */
+BaseType_t xExecutorNotifyFromISR( ExecutorHandler_t * pxHandler,
+                                   uint32_t ulBitsToSet,
+                                   BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * executor.h
+ * @code{c}
+ * uint32_t ulExecutorTakeNotification( ExecutorHandler_t * pxHandler );
+ * @endcode
+ *
+ * Reads and clears a handler's notification value.
+ *
+ * @return The bits that were set in the handler's notification value.
+ *
+ * \defgroup ulExecutorTakeNotification ulExecutorTakeNotification
+ * \ingroup Executor
+ */
+uint32_t ulExecutorTakeNotification( ExecutorHandler_t * pxHandler ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* EXECUTOR_H */
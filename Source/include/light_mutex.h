@@ -0,0 +1,293 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef LIGHT_MUTEX_H
+#define LIGHT_MUTEX_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include light_mutex.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A light mutex is a mutual exclusion lock that is not built on top of a
+ * queue.  Taking a light mutex that is free, and giving a light mutex that no
+ * other task is waiting for, is a single compare and swap on the holder of the
+ * mutex, so neither enters the scheduler.  The kernel is only used when a task
+ * has to block because the mutex is held, in which case the holder inherits
+ * the priority of the highest priority task waiting for it exactly as it would
+ * for a mutex created with xSemaphoreCreateMutex().
+ *
+ * A light mutex can instead be created with a priority ceiling, using
+ * xLightMutexCreateWithCeiling().  A task that takes such a mutex is raised to
+ * the ceiling priority as it takes it, so no task that uses the mutex can
+ * preempt the holder and the time a task is blocked by the mutex is bounded by
+ * the longest time any one task holds it.  No priority is inherited from
+ * waiting tasks.
+ *
+ * Light mutexes cannot be taken recursively, cannot be used from an interrupt,
+ * and cannot be added to a queue set.  configUSE_MUTEXES and
+ * configUSE_LIGHT_MUTEXES must both be set to 1 in FreeRTOSConfig.h for the
+ * light mutex API to be available.
+ *
+ * Light mutexes are referenced by handles of type LightMutexHandle_t.
+ *
+ * \defgroup LightMutexHandle_t LightMutexHandle_t
+ * \ingroup LightMutex
+ */
+struct LightMutexDefinition;
+typedef struct LightMutexDefinition   * LightMutexHandle_t;
+
+/* The ceiling priority passed to xLightMutexGenericCreate() and
+ * xLightMutexGenericCreateStatic() to create a mutex that uses priority
+ * inheritance. */
+#define lightmutexNO_PRIORITY_CEILING    ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) )
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * LightMutexHandle_t xLightMutexCreate( void );
+ * @endcode
+ *
+ * Creates a new light mutex, and returns a handle by which the mutex can be
+ * referenced.  The memory used by the mutex is allocated from the FreeRTOS
+ * heap.  Use xLightMutexCreateStatic() to provide the memory instead.
+ *
+ * @return If the mutex was created then a handle to the mutex is returned.  If
+ * there was insufficient FreeRTOS heap available to create the mutex then NULL
+ * is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  LightMutexHandle_t xMutex;
+ *
+ *  void vATask( void * pvParameters )
+ *  {
+ *      xMutex = xLightMutexCreate();
+ *
+ *      if( xMutex != NULL )
+ *      {
+ *          if( xLightMutexTake( xMutex, pdMS_TO_TICKS( 10 ) ) == pdPASS )
+ *          {
+ *              // Access the shared resource.
+ *
+ *              xLightMutexGive( xMutex );
+ *          }
+ *      }
+ *  }
+ * @endcode
+ * \defgroup xLightMutexCreate xLightMutexCreate
+ * \ingroup LightMutex
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xLightMutexCreate()    xLightMutexGenericCreate( lightmutexNO_PRIORITY_CEILING )
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * LightMutexHandle_t xLightMutexCreateStatic( StaticLightMutex_t * pxMutexBuffer );
+ * @endcode
+ *
+ * Creates a new light mutex using memory provided by the application writer,
+ * and returns a handle by which the mutex can be referenced.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticLightMutex_t,
+ * which will be used to hold the mutex's data structure.
+ *
+ * @return If the mutex was created then a handle to the mutex is returned.  If
+ * pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xLightMutexCreateStatic xLightMutexCreateStatic
+ * \ingroup LightMutex
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #define xLightMutexCreateStatic( pxMutexBuffer )    xLightMutexGenericCreateStatic( lightmutexNO_PRIORITY_CEILING, ( pxMutexBuffer ) )
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * LightMutexHandle_t xLightMutexCreateWithCeiling( UBaseType_t uxCeilingPriority );
+ * @endcode
+ *
+ * Creates a new light mutex that uses the immediate priority ceiling protocol
+ * instead of priority inheritance, and returns a handle by which the mutex can
+ * be referenced.  The memory used by the mutex is allocated from the FreeRTOS
+ * heap.  Use xLightMutexCreateWithCeilingStatic() to provide the memory
+ * instead.
+ *
+ * A task that takes the mutex runs at uxCeilingPriority, if its priority is not
+ * already higher, until it no longer holds any mutexes.  As with priority
+ * inheritance, a task that holds more than one mutex keeps the raised priority
+ * until it has given all of them back.
+ *
+ * @param uxCeilingPriority The priority the holder of the mutex is raised to.
+ * Must be at least the priority of every task that takes the mutex, and less
+ * than configMAX_PRIORITIES.
+ *
+ * @return If the mutex was created then a handle to the mutex is returned.  If
+ * there was insufficient FreeRTOS heap available to create the mutex then NULL
+ * is returned.
+ *
+ * \defgroup xLightMutexCreateWithCeiling xLightMutexCreateWithCeiling
+ * \ingroup LightMutex
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xLightMutexCreateWithCeiling( uxCeilingPriority )    xLightMutexGenericCreate( ( uxCeilingPriority ) )
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * LightMutexHandle_t xLightMutexCreateWithCeilingStatic( UBaseType_t uxCeilingPriority, StaticLightMutex_t * pxMutexBuffer );
+ * @endcode
+ *
+ * Creates a new light mutex with a priority ceiling using memory provided by
+ * the application writer.  See xLightMutexCreateWithCeiling().
+ *
+ * @param uxCeilingPriority The priority the holder of the mutex is raised to.
+ *
+ * @param pxMutexBuffer Must point to a variable of type StaticLightMutex_t,
+ * which will be used to hold the mutex's data structure.
+ *
+ * @return If the mutex was created then a handle to the mutex is returned.  If
+ * pxMutexBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xLightMutexCreateWithCeilingStatic xLightMutexCreateWithCeilingStatic
+ * \ingroup LightMutex
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #define xLightMutexCreateWithCeilingStatic( uxCeilingPriority, pxMutexBuffer )    xLightMutexGenericCreateStatic( ( uxCeilingPriority ), ( pxMutexBuffer ) )
+#endif
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexTake( LightMutexHandle_t xMutex, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes a light mutex.  Must only be called from a task, and must not be called
+ * by the task that already holds the mutex.
+ *
+ * @param xMutex The handle of the mutex being taken.
+ *
+ * @param xTicksToWait The maximum time, in ticks, the calling task should wait
+ * in the Blocked state for the mutex to become available.  While the task is
+ * blocked the holder of the mutex inherits its priority if it is higher than
+ * the holder's own priority.
+ *
+ * @return pdPASS if the mutex was taken, or pdFAIL if xTicksToWait expired
+ * before the mutex became available.
+ *
+ * \defgroup xLightMutexTake xLightMutexTake
+ * \ingroup LightMutex
+ */
+BaseType_t xLightMutexTake( LightMutexHandle_t xMutex,
+                            TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * BaseType_t xLightMutexGive( LightMutexHandle_t xMutex );
+ * @endcode
+ *
+ * Gives a light mutex that was previously taken by the calling task.  If a
+ * higher priority task is waiting for the mutex, or the calling task inherited
+ * a priority while holding it, then the calling task yields.
+ *
+ * @param xMutex The handle of the mutex being given.
+ *
+ * @return pdPASS if the mutex was given, or pdFAIL if the calling task was not
+ * the holder of the mutex.
+ *
+ * \defgroup xLightMutexGive xLightMutexGive
+ * \ingroup LightMutex
+ */
+BaseType_t xLightMutexGive( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex );
+ * @endcode
+ *
+ * @param xMutex The handle of the mutex being queried.
+ *
+ * @return The handle of the task that holds the mutex, or NULL if the mutex is
+ * not held.
+ *
+ * \defgroup xLightMutexGetHolder xLightMutexGetHolder
+ * \ingroup LightMutex
+ */
+TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/**
+ * light_mutex.h
+ * @code{c}
+ * void vLightMutexDelete( LightMutexHandle_t xMutex );
+ * @endcode
+ *
+ * Deletes a light mutex, freeing its memory if it was created with
+ * xLightMutexCreate().  The mutex must not be held, and no task may be waiting
+ * for it, when it is deleted.
+ *
+ * @param xMutex The handle of the mutex being deleted.
+ *
+ * \defgroup vLightMutexDelete vLightMutexDelete
+ * \ingroup LightMutex
+ */
+void vLightMutexDelete( LightMutexHandle_t xMutex ) PRIVILEGED_FUNCTION;
+
+/* Functions beyond this part are not part of the public API and are intended
+ * for use by the kernel only. */
+
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    LightMutexHandle_t xLightMutexGenericCreate( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    LightMutexHandle_t xLightMutexGenericCreateStatic( UBaseType_t uxCeilingPriority,
+                                                       StaticLightMutex_t * pxMutexBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* LIGHT_MUTEX_H */
@@ -250,6 +250,38 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
     xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), 0, sbTYPE_MESSAGE_BUFFER, ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
 #endif
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * MessageBufferHandle_t xMessageBufferCreateMultiProducer( size_t xBufferSizeBytes );
+ * MessageBufferHandle_t xMessageBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+ *                                                                uint8_t *pucMessageBufferStorageArea,
+ *                                                                StaticMessageBuffer_t *pxStaticMessageBuffer );
+ * @endcode
+ *
+ * Creates a message buffer that can be written by any number of tasks and
+ * interrupts at the same time.  Each message is reserved, copied without a
+ * lock and then published, so the reader only ever receives complete
+ * messages, although messages from different writers are received in the
+ * order their space was reserved rather than the order their writes finished.
+ * See xStreamBufferCreateMultiProducer() for the other differences from a
+ * normal message buffer, the main one being that writers never block.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in
+ * FreeRTOSConfig.h for these macros to be available.
+ *
+ * \defgroup xMessageBufferCreateMultiProducer xMessageBufferCreateMultiProducer
+ * \ingroup MessageBufferManagement
+ */
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    #define xMessageBufferCreateMultiProducer( xBufferSizeBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( size_t ) 0, sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER, NULL, NULL )
+
+    #define xMessageBufferCreateMultiProducerStatic( xBufferSizeBytes, pucMessageBufferStorageArea, pxStaticMessageBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), 0, sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER, ( pucMessageBufferStorageArea ), ( pxStaticMessageBuffer ), NULL, NULL )
+#endif
+
 /**
  * message_buffer.h
  *
@@ -495,6 +527,58 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferSendFromISR( xMessageBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken ) \
     xStreamBufferSendFromISR( ( xMessageBuffer ), ( pvTxData ), ( xDataLengthBytes ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendV( MessageBufferHandle_t xMessageBuffer,
+ *                             const StreamBufferTxVector_t *pxVectors,
+ *                             size_t xVectorCount,
+ *                             TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Gather version of xMessageBufferSend().  The xVectorCount fragments described
+ * by pxVectors are concatenated into a single message that is written with a
+ * single length header, so the reader always receives the fragments as one
+ * message.  As with xMessageBufferSend(), either the whole message is written
+ * or nothing is.
+ *
+ * @param xMessageBuffer The handle of the message buffer to which a message is
+ * being sent.
+ *
+ * @param pxVectors An array of xVectorCount fragment descriptors.
+ *
+ * @param xVectorCount The number of entries in pxVectors.
+ *
+ * @param xTicksToWait As per xMessageBufferSend().
+ *
+ * @return The length of the message written, which is the total length of the
+ * fragments, or 0 if the call timed out before there was enough space.
+ *
+ * \defgroup xMessageBufferSendV xMessageBufferSendV
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendV( xMessageBuffer, pxVectors, xVectorCount, xTicksToWait ) \
+    xStreamBufferSendV( ( xMessageBuffer ), ( pxVectors ), ( xVectorCount ), ( xTicksToWait ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferSendVFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                    const StreamBufferTxVector_t *pxVectors,
+ *                                    size_t xVectorCount,
+ *                                    BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferSendV().
+ *
+ * \defgroup xMessageBufferSendVFromISR xMessageBufferSendVFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSendVFromISR( xMessageBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken ) \
+    xStreamBufferSendVFromISR( ( xMessageBuffer ), ( pxVectors ), ( xVectorCount ), ( pxHigherPriorityTaskWoken ) )
+
 /**
  * message_buffer.h
  *
@@ -692,6 +776,180 @@ typedef StreamBufferHandle_t MessageBufferHandle_t;
 #define xMessageBufferReceiveFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken ) \
     xStreamBufferReceiveFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxHigherPriorityTaskWoken ) )
 
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveV( MessageBufferHandle_t xMessageBuffer,
+ *                                const StreamBufferRxVector_t *pxVectors,
+ *                                size_t xVectorCount,
+ *                                TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Scatter version of xMessageBufferReceive().  The next message is written to
+ * the xVectorCount buffers described by pxVectors, filling each one in turn.
+ * If the total length of the buffers is too small to hold the message then the
+ * message is left in the message buffer and 0 is returned.
+ *
+ * @param xMessageBuffer The handle of the message buffer from which a message
+ * is being received.
+ *
+ * @param pxVectors An array of xVectorCount fragment descriptors.
+ *
+ * @param xVectorCount The number of entries in pxVectors.
+ *
+ * @param xTicksToWait As per xMessageBufferReceive().
+ *
+ * @return The length, in bytes, of the message read from the message buffer,
+ * if any.
+ *
+ * \defgroup xMessageBufferReceiveV xMessageBufferReceiveV
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveV( xMessageBuffer, pxVectors, xVectorCount, xTicksToWait ) \
+    xStreamBufferReceiveV( ( xMessageBuffer ), ( pxVectors ), ( xVectorCount ), ( xTicksToWait ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveVFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                       const StreamBufferRxVector_t *pxVectors,
+ *                                       size_t xVectorCount,
+ *                                       BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferReceiveV().
+ *
+ * \defgroup xMessageBufferReceiveVFromISR xMessageBufferReceiveVFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveVFromISR( xMessageBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveVFromISR( ( xMessageBuffer ), ( pxVectors ), ( xVectorCount ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveBatch( MessageBufferHandle_t xMessageBuffer,
+ *                                    void *pvRxData,
+ *                                    size_t xBufferLengthBytes,
+ *                                    size_t *pxMessageLengths,
+ *                                    size_t xMaxMessages,
+ *                                    TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives up to xMaxMessages messages from a message buffer in one call.
+ * Messages are copied into pvRxData back to back, in the order in which they
+ * were sent, and the length of each one is written to the corresponding entry
+ * of pxMessageLengths.  Messages are only ever received whole - reception
+ * stops at the first message that does not fit in the remaining space in
+ * pvRxData, and that message is left in the message buffer.
+ *
+ * Draining a burst of small messages this way costs a single call and, if a
+ * task is blocked waiting for space, a single notification to that task,
+ * rather than one of each per message.
+ *
+ * The calling task blocks, for at most xTicksToWait, only if the message
+ * buffer is empty.  Once at least one message is available the function
+ * returns with whatever messages are in the buffer at that time.
+ *
+ * The same single writer/single reader restrictions as xMessageBufferReceive()
+ * apply.
+ *
+ * @param xMessageBuffer The handle of the message buffer from which messages
+ * are being received.
+ *
+ * @param pvRxData A pointer to the buffer into which the received messages
+ * are copied.
+ *
+ * @param xBufferLengthBytes The length of the buffer pointed to by pvRxData.
+ *
+ * @param pxMessageLengths An array of at least xMaxMessages entries into which
+ * the lengths of the received messages are written.
+ *
+ * @param xMaxMessages The maximum number of messages to receive.
+ *
+ * @param xTicksToWait As per xMessageBufferReceive().
+ *
+ * @return The number of messages received, which is 0 if the call timed out
+ * or if the first message in the buffer is longer than xBufferLengthBytes.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( MessageBufferHandle_t xMessageBuffer )
+ * {
+ * uint8_t ucRxData[ 256 ];
+ * size_t xLengths[ 16 ], xMessages, x, xOffset = 0;
+ *
+ *  // Receive every message that is waiting, blocking for up to 100ms if
+ *  // there are none.
+ *  xMessages = xMessageBufferReceiveBatch( xMessageBuffer,
+ *                                          ( void * ) ucRxData,
+ *                                          sizeof( ucRxData ),
+ *                                          xLengths,
+ *                                          sizeof( xLengths ) / sizeof( xLengths[ 0 ] ),
+ *                                          pdMS_TO_TICKS( 100 ) );
+ *
+ *  for( x = 0; x < xMessages; x++ )
+ *  {
+ *      // Message x is held in ucRxData[ xOffset ] to
+ *      // ucRxData[ xOffset + xLengths[ x ] - 1 ].
+ *      xOffset += xLengths[ x ];
+ *  }
+ * }
+ * @endcode
+ * \defgroup xMessageBufferReceiveBatch xMessageBufferReceiveBatch
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveBatch( xMessageBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, xTicksToWait ) \
+    xStreamBufferReceiveBatch( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxMessageLengths ), ( xMaxMessages ), ( xTicksToWait ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * size_t xMessageBufferReceiveBatchFromISR( MessageBufferHandle_t xMessageBuffer,
+ *                                           void *pvRxData,
+ *                                           size_t xBufferLengthBytes,
+ *                                           size_t *pxMessageLengths,
+ *                                           size_t xMaxMessages,
+ *                                           BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xMessageBufferReceiveBatch().  The
+ * pxHigherPriorityTaskWoken parameter is as per xMessageBufferReceiveFromISR().
+ *
+ * \defgroup xMessageBufferReceiveBatchFromISR xMessageBufferReceiveBatchFromISR
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferReceiveBatchFromISR( xMessageBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, pxHigherPriorityTaskWoken ) \
+    xStreamBufferReceiveBatchFromISR( ( xMessageBuffer ), ( pvRxData ), ( xBufferLengthBytes ), ( pxMessageLengths ), ( xMaxMessages ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * message_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xMessageBufferSetNotificationCoalescing( MessageBufferHandle_t xMessageBuffer,
+ *                                                     size_t xCoalesceBytes,
+ *                                                     TickType_t xCoalesceTicks );
+ * @endcode
+ *
+ * Holds off waking the task reading from the message buffer until either
+ * xCoalesceBytes bytes, including the bytes used to store each message's
+ * length, are waiting or xCoalesceTicks ticks have passed.  Most useful
+ * together with xMessageBufferReceiveBatch().  See
+ * xStreamBufferSetNotificationCoalescing() for details.
+ *
+ * configUSE_STREAM_BUFFER_COALESCING must be set to 1 in FreeRTOSConfig.h for
+ * xMessageBufferSetNotificationCoalescing() to be available.
+ *
+ * \defgroup xMessageBufferSetNotificationCoalescing xMessageBufferSetNotificationCoalescing
+ * \ingroup MessageBufferManagement
+ */
+#define xMessageBufferSetNotificationCoalescing( xMessageBuffer, xCoalesceBytes, xCoalesceTicks ) \
+    xStreamBufferSetNotificationCoalescing( ( xMessageBuffer ), ( xCoalesceBytes ), ( xCoalesceTicks ) )
+
 /**
  * message_buffer.h
  *
@@ -164,6 +164,15 @@ typedef struct xHeapStats
     size_t xNumberOfSuccessfulFrees;        /* The number of calls to vPortFree() that has successfully freed a block of memory. */
 } HeapStats_t;
 
+/* Used to pass a histogram of the free block sizes out of
+ * vPortGetHeapHistogram().  Bucket n counts the free blocks that are at least
+ * ( 16 << n ) bytes but less than ( 32 << n ) bytes.  The first bucket also
+ * counts any smaller blocks and the last bucket also counts any larger blocks. */
+typedef struct xHeapHistogram
+{
+    size_t xFreeBlocksInBucket[ configHEAP_HISTOGRAM_BUCKETS ];
+} HeapHistogram_t;
+
 /*
  * Used to define multiple heap regions for use by heap_5.c.  This function
  * must be called before any calls to pvPortMalloc() - not creating a task,
@@ -183,6 +192,13 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEG
  */
 void vPortGetHeapStats( HeapStats_t * pxHeapStats );
 
+/*
+ * Returns a HeapHistogram_t structure filled with the number of free blocks in
+ * each size bucket.  Only available in heap_4.c and heap_5.c when
+ * configHEAP_INCREMENTAL_STATS is set to 1.
+ */
+void vPortGetHeapHistogram( HeapHistogram_t * pxHeapHistogram );
+
 /*
  * Map to the memory management routines required for the port.
  */
@@ -195,6 +211,18 @@ size_t xPortGetFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 size_t xPortGetMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 void xPortResetHeapMinimumEverFreeHeapSize( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * Record the allocation and freeing of heap blocks in the allocation tracer.
+ * Called from the traceMALLOC() and traceFREE() macros with the scheduler
+ * suspended when configUSE_ALLOC_TRACE is set to 1 - see alloc_trace.h.
+ */
+#if ( configUSE_ALLOC_TRACE == 1 )
+    void vAllocTraceRecordMalloc( void * pvAddress,
+                                  size_t xSize,
+                                  void * pvCaller ) PRIVILEGED_FUNCTION;
+    void vAllocTraceRecordFree( void * pvAddress ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configSTACK_ALLOCATION_FROM_SEPARATE_HEAP == 1 )
     void * pvPortMallocStack( size_t xSize ) PRIVILEGED_FUNCTION;
     void vPortFreeStack( void * pv ) PRIVILEGED_FUNCTION;
@@ -76,6 +76,8 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE      ( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX       ( ( uint8_t ) 4U )
 #define queueQUEUE_TYPE_SET                   ( ( uint8_t ) 5U )
+#define queueQUEUE_TYPE_SPSC                  ( ( uint8_t ) 6U )
+#define queueQUEUE_TYPE_FIFO_WAITERS          ( ( uint8_t ) 7U )
 
 /**
  * queue. h
@@ -235,6 +237,112 @@ typedef struct QueueDefinition   * QueueSetMemberHandle_t;
     #define xQueueCreateStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_BASE ) )
 #endif /* configSUPPORT_STATIC_ALLOCATION */
 
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateSPSC(
+ *                                UBaseType_t uxQueueLength,
+ *                                UBaseType_t uxItemSize
+ *                            );
+ * @endcode
+ *
+ * @code{c}
+ * QueueHandle_t xQueueCreateSPSCStatic(
+ *                                      UBaseType_t uxQueueLength,
+ *                                      UBaseType_t uxItemSize,
+ *                                      uint8_t *pucQueueStorage,
+ *                                      StaticQueue_t *pxQueueBuffer
+ *                                  );
+ * @endcode
+ *
+ * configUSE_SPSC_QUEUES must be set to 1 in FreeRTOSConfig.h for these macros
+ * to be available.
+ *
+ * Creates a single producer single consumer queue.  Such a queue is used
+ * through the normal queue API, exactly as a queue created with xQueueCreate()
+ * or xQueueCreateStatic(), but only one task or interrupt may ever send to it
+ * and only one task or interrupt may ever receive from it.
+ *
+ * In return items are copied into and out of the queue without entering a
+ * critical section - the sender only updates the write index and the receiver
+ * only updates the read index.  The kernel is only involved when the receiver
+ * has to block because the queue is empty, or the sender has to block because
+ * the queue is full, in which case the blocked task waits on its task
+ * notification at index configQUEUE_SPSC_NOTIFICATION_INDEX.
+ *
+ * Items can only be sent to the back of the queue, so xQueueSendToFront() and
+ * xQueueOverwrite() cannot be used, and the queue cannot be added to a queue
+ * set.
+ *
+ * The parameters and return value are the same as those of xQueueCreate() and
+ * xQueueCreateStatic() respectively.  uxItemSize must not be zero.
+ *
+ * \defgroup xQueueCreateSPSC xQueueCreateSPSC
+ * \ingroup QueueManagement
+ */
+#if ( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+    #define xQueueCreateSPSC( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_SPSC ) )
+#endif
+
+#if ( ( configUSE_SPSC_QUEUES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+    #define xQueueCreateSPSCStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_SPSC ) )
+#endif
+
+/**
+ * queue. h
+ * @code{c}
+ * QueueHandle_t xQueueCreateFIFOWaiters(
+ *                                       UBaseType_t uxQueueLength,
+ *                                       UBaseType_t uxItemSize
+ *                                   );
+ * @endcode
+ *
+ * @code{c}
+ * QueueHandle_t xQueueCreateFIFOWaitersStatic(
+ *                                             UBaseType_t uxQueueLength,
+ *                                             UBaseType_t uxItemSize,
+ *                                             uint8_t *pucQueueStorage,
+ *                                             StaticQueue_t *pxQueueBuffer
+ *                                         );
+ * @endcode
+ *
+ * Creates a queue that wakes the tasks blocked on it in the order in which
+ * they blocked, instead of in priority order.  Such a queue is used through
+ * the normal queue API, exactly as a queue created with xQueueCreate() or
+ * xQueueCreateStatic().
+ *
+ * The tasks blocked on a queue are held in a list.  A queue created with
+ * xQueueCreate() keeps that list in priority order, so a task that blocks is
+ * inserted in time proportional to the number of tasks already blocked.  A
+ * queue created with xQueueCreateFIFOWaiters() adds a task that blocks to the
+ * end of the list in constant time.  This is intended for pools of worker
+ * tasks that all have the same priority and all wait on the same queue, where
+ * ordering by priority gains nothing.
+ *
+ * Fairness guarantee: the tasks waiting to receive from the queue are woken
+ * in the order in which they started to wait, and so are the tasks waiting
+ * to send to it, whatever their priorities, so no waiting task is woken twice
+ * before another waiting task is woken once.  A woken task still has to
+ * compete for the item with any task that is already running, exactly as
+ * with any other queue.  If a running task takes the item first then the
+ * woken task blocks again at the end of the list.  A high priority task can
+ * wait behind lower priority tasks, so do not use this type of queue where
+ * waiting tasks of different priorities need to be woken in priority order.
+ *
+ * The parameters and return value are the same as those of xQueueCreate() and
+ * xQueueCreateStatic() respectively.
+ *
+ * \defgroup xQueueCreateFIFOWaiters xQueueCreateFIFOWaiters
+ * \ingroup QueueManagement
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    #define xQueueCreateFIFOWaiters( uxQueueLength, uxItemSize )    xQueueGenericCreate( ( uxQueueLength ), ( uxItemSize ), ( queueQUEUE_TYPE_FIFO_WAITERS ) )
+#endif
+
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    #define xQueueCreateFIFOWaitersStatic( uxQueueLength, uxItemSize, pucQueueStorage, pxQueueBuffer )    xQueueGenericCreateStatic( ( uxQueueLength ), ( uxItemSize ), ( pucQueueStorage ), ( pxQueueBuffer ), ( queueQUEUE_TYPE_FIFO_WAITERS ) )
+#endif
+
 /**
  * queue. h
  * @code{c}
@@ -1664,29 +1772,15 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * Note 2:  Blocking on a queue set that contains a mutex will not cause the
  * mutex holder to inherit the priority of the blocked task.
  *
- * Note 3:  An additional 4 bytes of RAM is required for each space in a every
- * queue added to a queue set.  Therefore counting semaphores that have a high
- * maximum count value should not be added to a queue set.
- *
- * Note 4:  A receive (in the case of a queue) or take (in the case of a
- * semaphore) operation must not be performed on a member of a queue set unless
- * a call to xQueueSelectFromSet() has first returned a handle to that set member.
- *
- * @param uxEventQueueLength Queue sets store events that occur on
- * the queues and semaphores contained in the set.  uxEventQueueLength specifies
- * the maximum number of events that can be queued at once.  To be absolutely
- * certain that events are not lost uxEventQueueLength should be set to the
- * total sum of the length of the queues added to the set, where binary
- * semaphores and mutexes have a length of 1, and counting semaphores have a
- * length set by their maximum count value.  Examples:
- *  + If a queue set is to hold a queue of length 5, another queue of length 12,
- *    and a binary semaphore, then uxEventQueueLength should be set to
- *    (5 + 12 + 1), or 18.
- *  + If a queue set is to hold three binary semaphores then uxEventQueueLength
- *    should be set to (1 + 1 + 1 ), or 3.
- *  + If a queue set is to hold a counting semaphore that has a maximum count of
- *    5, and a counting semaphore that has a maximum count of 3, then
- *    uxEventQueueLength should be set to (5 + 3), or 8.
+ * Note 3:  A queue set does not store an event for each item posted to its
+ * members.  Instead each member that contains data is linked into a list held
+ * by the set, once, however many items it contains.  The set therefore cannot
+ * overflow, and any number of queues and semaphores of any length can be added
+ * to it.
+ *
+ * @param uxEventQueueLength Not used, as the queue set does not store events.
+ * Must be greater than zero.  Retained for compatibility with earlier versions
+ * of FreeRTOS, in which it was the sum of the lengths of the members of the set.
  *
  * @return If the queue set is created successfully then a handle to the created
  * queue set is returned.  Otherwise NULL is returned.
@@ -1716,32 +1810,18 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * Note 2:  Blocking on a queue set that contains a mutex will not cause the
  * mutex holder to inherit the priority of the blocked task.
  *
- * Note 3:  An additional 4 bytes of RAM is required for each space in a every
- * queue added to a queue set.  Therefore counting semaphores that have a high
- * maximum count value should not be added to a queue set.
- *
- * Note 4:  A receive (in the case of a queue) or take (in the case of a
- * semaphore) operation must not be performed on a member of a queue set unless
- * a call to xQueueSelectFromSet() has first returned a handle to that set member.
- *
- * @param uxEventQueueLength Queue sets store events that occur on
- * the queues and semaphores contained in the set.  uxEventQueueLength specifies
- * the maximum number of events that can be queued at once.  To be absolutely
- * certain that events are not lost uxEventQueueLength should be set to the
- * total sum of the length of the queues added to the set, where binary
- * semaphores and mutexes have a length of 1, and counting semaphores have a
- * length set by their maximum count value.  Examples:
- *  + If a queue set is to hold a queue of length 5, another queue of length 12,
- *    and a binary semaphore, then uxEventQueueLength should be set to
- *    (5 + 12 + 1), or 18.
- *  + If a queue set is to hold three binary semaphores then uxEventQueueLength
- *    should be set to (1 + 1 + 1 ), or 3.
- *  + If a queue set is to hold a counting semaphore that has a maximum count of
- *    5, and a counting semaphore that has a maximum count of 3, then
- *    uxEventQueueLength should be set to (5 + 3), or 8.
- *
- * @param pucQueueStorage pucQueueStorage must point to a uint8_t array that is
- * at least large enough to hold uxEventQueueLength events.
+ * Note 3:  A queue set does not store an event for each item posted to its
+ * members.  Instead each member that contains data is linked into a list held
+ * by the set, once, however many items it contains.  The set therefore cannot
+ * overflow, and any number of queues and semaphores of any length can be added
+ * to it.
+ *
+ * @param uxEventQueueLength Not used, as the queue set does not store events.
+ * Must be greater than zero.  Retained for compatibility with earlier versions
+ * of FreeRTOS, in which it was the sum of the lengths of the members of the set.
+ *
+ * @param pucQueueStorage Not used, as the queue set does not store events, so
+ * can be NULL.  Retained for compatibility with earlier versions of FreeRTOS.
  *
  * @param pxQueueBuffer Must point to a variable of type StaticQueue_t, which
  * will be used to hold the queue's data structure.
@@ -1762,9 +1842,8 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * See FreeRTOS/Source/Demo/Common/Minimal/QueueSet.c for an example using this
  * function.
  *
- * Note 1:  A receive (in the case of a queue) or take (in the case of a
- * semaphore) operation must not be performed on a member of a queue set unless
- * a call to xQueueSelectFromSet() has first returned a handle to that set member.
+ * A queue or semaphore that already contains data when it is added to the set
+ * is immediately available to xQueueSelectFromSet().
  *
  * @param xQueueOrSemaphore The handle of the queue or semaphore being added to
  * the queue set (cast to an QueueSetMemberHandle_t type).
@@ -1783,8 +1862,7 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
- * Removes a queue or semaphore from a queue set.  A queue or semaphore can only
- * be removed from a set if the queue or semaphore is empty.
+ * Removes a queue or semaphore from a queue set.
  *
  * See FreeRTOS/Source/Demo/Common/Minimal/QueueSet.c for an example using this
  * function.
@@ -1796,8 +1874,8 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * is included.
  *
  * @return If the queue or semaphore was successfully removed from the queue set
- * then pdPASS is returned.  If the queue was not in the queue set, or the
- * queue (or semaphore) was not empty, then pdFAIL is returned.
+ * then pdPASS is returned.  If the queue was not in the queue set then pdFAIL
+ * is returned.
  */
 #if ( configUSE_QUEUE_SETS == 1 )
     BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore,
@@ -1821,9 +1899,9 @@ BaseType_t xQueueGiveMutexRecursive( QueueHandle_t xMutex ) PRIVILEGED_FUNCTION;
  * Note 2:  Blocking on a queue set that contains a mutex will not cause the
  * mutex holder to inherit the priority of the blocked task.
  *
- * Note 3:  A receive (in the case of a queue) or take (in the case of a
- * semaphore) operation must not be performed on a member of a queue set unless
- * a call to xQueueSelectFromSet() has first returned a handle to that set member.
+ * Note 3:  xQueueSelectFromSet() does not read from or take the member it
+ * returns, and keeps returning a member for as long as it contains data.
+ * Members that contain data are returned in turn.
  *
  * @param xQueueSet The queue set on which the task will (potentially) block.
  *
@@ -1857,6 +1935,11 @@ void vQueueWaitForMessageRestricted( QueueHandle_t xQueue,
 BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
                                BaseType_t xNewQueue ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+    BaseType_t xQueueRequeueWaitingTasks( QueueHandle_t xMutex,
+                                          List_t * const pxEventList ) PRIVILEGED_FUNCTION;
+#endif
+
 #if ( configUSE_TRACE_FACILITY == 1 )
     void vQueueSetQueueNumber( QueueHandle_t xQueue,
                                UBaseType_t uxQueueNumber ) PRIVILEGED_FUNCTION;
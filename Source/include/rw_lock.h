@@ -0,0 +1,328 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef RW_LOCK_H
+#define RW_LOCK_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include rw_lock.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A reader-writer lock can be held either by any number of readers at the same
+ * time, or by a single writer.  It is intended for data that is read far more
+ * often than it is written, where a mutex would needlessly serialise the
+ * readers.
+ *
+ * Writers are preferred: once a task is waiting to write, tasks that try to
+ * read wait until it has written, so a steady stream of readers cannot starve
+ * a writer.  A task waiting to write causes the writer holding the lock, if
+ * any, to inherit its priority exactly as the holder of a mutex would.  Readers
+ * holding the lock do not inherit any priority.
+ *
+ * Read access can be taken and given back from an interrupt, without blocking,
+ * using xRWLockAcquireReadFromISR() and xRWLockReleaseReadFromISR().  Write
+ * access can only be taken by a task.
+ *
+ * configUSE_MUTEXES and configUSE_RW_LOCKS must both be set to 1 in
+ * FreeRTOSConfig.h for the reader-writer lock API to be available.
+ *
+ * Reader-writer locks are referenced by handles of type RWLockHandle_t.
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+struct RWLockDefinition;
+typedef struct RWLockDefinition   * RWLockHandle_t;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * RWLockHandle_t xRWLockCreate( void );
+ * @endcode
+ *
+ * Creates a new reader-writer lock, and returns a handle by which the lock can
+ * be referenced.  The memory used by the lock is allocated from the FreeRTOS
+ * heap.  Use xRWLockCreateStatic() to provide the memory instead.
+ *
+ * @return If the lock was created then a handle to the lock is returned.  If
+ * there was insufficient FreeRTOS heap available to create the lock then NULL
+ * is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  RWLockHandle_t xRoutesLock;
+ *
+ *  void vLookUpRoute( void )
+ *  {
+ *      if( xRWLockAcquireRead( xRoutesLock, pdMS_TO_TICKS( 10 ) ) == pdPASS )
+ *      {
+ *          // Read the routing table.  Other tasks can read it at the same
+ *          // time.
+ *
+ *          xRWLockReleaseRead( xRoutesLock );
+ *      }
+ *  }
+ *
+ *  void vUpdateRoute( void )
+ *  {
+ *      if( xRWLockAcquireWrite( xRoutesLock, portMAX_DELAY ) == pdPASS )
+ *      {
+ *          // Update the routing table.  No other task is reading it.
+ *
+ *          xRWLockReleaseWrite( xRoutesLock );
+ *      }
+ *  }
+ * @endcode
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t * pxLockBuffer );
+ * @endcode
+ *
+ * Creates a new reader-writer lock using memory provided by the application
+ * writer, and returns a handle by which the lock can be referenced.
+ *
+ * @param pxLockBuffer Must point to a variable of type StaticRWLock_t, which
+ * will be used to hold the lock's data structure.
+ *
+ * @return If the lock was created then a handle to the lock is returned.  If
+ * pxLockBuffer was NULL then NULL is returned.
+ *
+ * \defgroup xRWLockCreateStatic xRWLockCreateStatic
+ * \ingroup RWLock
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t * pxLockBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockAcquireRead( RWLockHandle_t xLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes read access to a reader-writer lock.  Read access is granted while no
+ * task holds, or is waiting for, write access.  Must only be called from a
+ * task.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @param xTicksToWait The maximum time, in ticks, the calling task should wait
+ * in the Blocked state for read access.
+ *
+ * @return pdPASS if read access was taken, or pdFAIL if xTicksToWait expired
+ * first.
+ *
+ * \defgroup xRWLockAcquireRead xRWLockAcquireRead
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockAcquireRead( RWLockHandle_t xLock,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockAcquireReadFromISR( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * A version of xRWLockAcquireRead() that can be called from an interrupt
+ * service routine.  It does not block.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @return pdPASS if read access was taken, or pdFAIL if a task holds, or is
+ * waiting for, write access.
+ *
+ * \defgroup xRWLockAcquireReadFromISR xRWLockAcquireReadFromISR
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockAcquireReadFromISR( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockReleaseRead( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * Gives back read access previously taken with xRWLockAcquireRead().  When the
+ * last reader gives back read access, the highest priority task waiting for
+ * write access, if any, is unblocked.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @return pdPASS if read access was given back, or pdFAIL if the lock was not
+ * held for reading.
+ *
+ * \defgroup xRWLockReleaseRead xRWLockReleaseRead
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReleaseRead( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockReleaseReadFromISR( RWLockHandle_t xLock, BaseType_t * pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of xRWLockReleaseRead() that can be called from an interrupt
+ * service routine.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @param pxHigherPriorityTaskWoken Set to pdTRUE if giving back read access
+ * unblocked a task that has a priority above the priority of the currently
+ * running task, in which case a context switch should be requested before the
+ * interrupt is exited.
+ *
+ * @return pdPASS if read access was given back, or pdFAIL if the lock was not
+ * held for reading.
+ *
+ * \defgroup xRWLockReleaseReadFromISR xRWLockReleaseReadFromISR
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReleaseReadFromISR( RWLockHandle_t xLock,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockAcquireWrite( RWLockHandle_t xLock, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Takes write access to a reader-writer lock.  Write access is granted when no
+ * task holds either read or write access.  Must only be called from a task, and
+ * must not be called by a task that already holds the lock.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @param xTicksToWait The maximum time, in ticks, the calling task should wait
+ * in the Blocked state for write access.  While the task is blocked, a writer
+ * holding the lock inherits its priority if it is higher than the writer's own
+ * priority.
+ *
+ * @return pdPASS if write access was taken, or pdFAIL if xTicksToWait expired
+ * first.
+ *
+ * \defgroup xRWLockAcquireWrite xRWLockAcquireWrite
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockAcquireWrite( RWLockHandle_t xLock,
+                                TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * BaseType_t xRWLockReleaseWrite( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * Gives back write access previously taken by the calling task.  The highest
+ * priority task waiting for write access is unblocked if there is one,
+ * otherwise all the tasks waiting for read access are unblocked.
+ *
+ * @param xLock The handle of the lock.
+ *
+ * @return pdPASS if write access was given back, or pdFAIL if the calling task
+ * did not hold write access.
+ *
+ * \defgroup xRWLockReleaseWrite xRWLockReleaseWrite
+ * \ingroup RWLock
+ */
+BaseType_t xRWLockReleaseWrite( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * TaskHandle_t xRWLockGetWriter( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * @param xLock The handle of the lock being queried.
+ *
+ * @return The handle of the task that holds write access, or NULL if no task
+ * holds write access.
+ *
+ * \defgroup xRWLockGetWriter xRWLockGetWriter
+ * \ingroup RWLock
+ */
+TaskHandle_t xRWLockGetWriter( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * @param xLock The handle of the lock being queried.
+ *
+ * @return The number of tasks and interrupts that hold read access.
+ *
+ * \defgroup uxRWLockGetReaderCount uxRWLockGetReaderCount
+ * \ingroup RWLock
+ */
+UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rw_lock.h
+ * @code{c}
+ * void vRWLockDelete( RWLockHandle_t xLock );
+ * @endcode
+ *
+ * Deletes a reader-writer lock, freeing its memory if it was created with
+ * xRWLockCreate().  The lock must not be held, and no task may be waiting for
+ * it, when it is deleted.
+ *
+ * @param xLock The handle of the lock being deleted.
+ *
+ * \defgroup vRWLockDelete vRWLockDelete
+ * \ingroup RWLock
+ */
+void vRWLockDelete( RWLockHandle_t xLock ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* RW_LOCK_H */
@@ -65,9 +65,11 @@
 /**
  * Type of stream buffer. For internal use only.
  */
-#define sbTYPE_STREAM_BUFFER             ( ( BaseType_t ) 0 )
-#define sbTYPE_MESSAGE_BUFFER            ( ( BaseType_t ) 1 )
-#define sbTYPE_STREAM_BATCHING_BUFFER    ( ( BaseType_t ) 2 )
+#define sbTYPE_STREAM_BUFFER                    ( ( BaseType_t ) 0 )
+#define sbTYPE_MESSAGE_BUFFER                   ( ( BaseType_t ) 1 )
+#define sbTYPE_STREAM_BATCHING_BUFFER           ( ( BaseType_t ) 2 )
+#define sbTYPE_MULTI_PRODUCER_STREAM_BUFFER     ( ( BaseType_t ) 3 )
+#define sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER    ( ( BaseType_t ) 4 )
 
 /**
  * Type by which stream buffers are referenced.  For example, a call to
@@ -85,6 +87,22 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
                                                  BaseType_t xIsInsideISR,
                                                  BaseType_t * const pxHigherPriorityTaskWoken );
 
+/**
+ * Types used to describe one fragment of the data passed to
+ * xStreamBufferSendV() and xStreamBufferReceiveV() respectively.
+ */
+typedef struct xSTREAM_BUFFER_TX_VECTOR
+{
+    const void * pvData; /* The start of the fragment.  Can only be NULL if xLength is 0. */
+    size_t xLength;      /* The number of bytes in the fragment. */
+} StreamBufferTxVector_t;
+
+typedef struct xSTREAM_BUFFER_RX_VECTOR
+{
+    void * pvData;  /* The start of the fragment.  Can only be NULL if xLength is 0. */
+    size_t xLength; /* The number of bytes in the fragment. */
+} StreamBufferRxVector_t;
+
 /**
  * stream_buffer.h
  *
@@ -459,6 +477,62 @@ typedef void (* StreamBufferCallbackFunction_t)( StreamBufferHandle_t xStreamBuf
     xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_STREAM_BATCHING_BUFFER, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), ( pxSendCompletedCallback ), ( pxReceiveCompletedCallback ) )
 #endif
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * StreamBufferHandle_t xStreamBufferCreateMultiProducer( size_t xBufferSizeBytes, size_t xTriggerLevelBytes );
+ * StreamBufferHandle_t xStreamBufferCreateMultiProducerStatic( size_t xBufferSizeBytes,
+ *                                                              size_t xTriggerLevelBytes,
+ *                                                              uint8_t *pucStreamBufferStorageArea,
+ *                                                              StaticStreamBuffer_t *pxStaticStreamBuffer );
+ * @endcode
+ *
+ * Creates a stream buffer that, unlike other stream buffers, can be written
+ * by any number of tasks and interrupts at the same time, for example to
+ * collect log output from several interrupts without a critical section
+ * around each write.  The parameters are as per xStreamBufferCreate() and
+ * xStreamBufferCreateStatic().
+ *
+ * Each call to xStreamBufferSend(), xStreamBufferSendV() or their FromISR
+ * versions reserves space with a compare and swap, copies its data into that
+ * space without holding a lock, then publishes it.  Writers can finish in any
+ * order, so the data is published when the last writer still copying
+ * finishes.  The reader only ever sees data that has been written in full,
+ * and the bytes from one call are always contiguous.
+ *
+ * The differences from a single producer stream buffer are:
+ *
+ * - Writers never block.  xTicksToWait is ignored, and the send functions
+ *   write as much as fits immediately.
+ *
+ * - There must still be only one reader.
+ *
+ * - xStreamBufferAcquireWrite() and xStreamBufferCommitWrite() cannot be
+ *   used, and xStreamBufferSpacesAvailable() does not include the space
+ *   claimed by writers that have not finished.
+ *
+ * The compare and swap is lock free on ports that define
+ * portCOMPARE_AND_SWAP_SIZE(), which includes the GCC Cortex-M3, Cortex-M4F
+ * and Posix ports.  Other ports use a critical section that is held only for
+ * the compare and swap, not for the copy.
+ *
+ * configUSE_MULTI_PRODUCER_STREAM_BUFFERS must be set to 1 in
+ * FreeRTOSConfig.h for these macros to be available.  The buffer length must
+ * fit in the size_t bits left after sbCLAIM_COUNT_BITS, so be less than 16MB
+ * on 32-bit targets.
+ *
+ * \defgroup xStreamBufferCreateMultiProducer xStreamBufferCreateMultiProducer
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    #define xStreamBufferCreateMultiProducer( xBufferSizeBytes, xTriggerLevelBytes ) \
+    xStreamBufferGenericCreate( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_MULTI_PRODUCER_STREAM_BUFFER, NULL, NULL )
+
+    #define xStreamBufferCreateMultiProducerStatic( xBufferSizeBytes, xTriggerLevelBytes, pucStreamBufferStorageArea, pxStaticStreamBuffer ) \
+    xStreamBufferGenericCreateStatic( ( xBufferSizeBytes ), ( xTriggerLevelBytes ), sbTYPE_MULTI_PRODUCER_STREAM_BUFFER, ( pucStreamBufferStorageArea ), ( pxStaticStreamBuffer ), NULL, NULL )
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -698,6 +772,90 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
                                  size_t xDataLengthBytes,
                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+ *                            const StreamBufferTxVector_t *pxVectors,
+ *                            size_t xVectorCount,
+ *                            TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Gather version of xStreamBufferSend().  Sends the xVectorCount fragments
+ * described by pxVectors, in order, as if they were one contiguous block of
+ * data, so a header and a payload held in separate buffers can be sent without
+ * first being copied into a staging buffer.  Zero length fragments are skipped.
+ *
+ * When used on a message buffer (see xMessageBufferSendV()) the fragments are
+ * written as a single message with a single length header, and, as with
+ * xMessageBufferSend(), either the whole message is written or nothing is.
+ *
+ * The same single writer/single reader restrictions as xStreamBufferSend()
+ * apply.
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferSendV() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to which the data is
+ * being sent.
+ *
+ * @param pxVectors An array of xVectorCount fragment descriptors.
+ *
+ * @param xVectorCount The number of entries in pxVectors.
+ *
+ * @param xTicksToWait As per xStreamBufferSend().
+ *
+ * @return The number of bytes written to the stream buffer, which will be less
+ * than the total length of the fragments if the call timed out before there was
+ * enough space for all of them.
+ *
+ * Example use:
+ * @code{c}
+ * void vAFunction( StreamBufferHandle_t xStreamBuffer, const uint8_t *pucPayload, size_t xPayloadLength )
+ * {
+ * uint8_t ucHeader[ 4 ];
+ * StreamBufferTxVector_t xVectors[ 2 ];
+ *
+ *  // Fill in ucHeader here.
+ *
+ *  xVectors[ 0 ].pvData = ucHeader;
+ *  xVectors[ 0 ].xLength = sizeof( ucHeader );
+ *  xVectors[ 1 ].pvData = pucPayload;
+ *  xVectors[ 1 ].xLength = xPayloadLength;
+ *
+ *  xStreamBufferSendV( xStreamBuffer, xVectors, 2, portMAX_DELAY );
+ * }
+ * @endcode
+ * \defgroup xStreamBufferSendV xStreamBufferSendV
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                           const StreamBufferTxVector_t * pxVectors,
+                           size_t xVectorCount,
+                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                   const StreamBufferTxVector_t *pxVectors,
+ *                                   size_t xVectorCount,
+ *                                   BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferSendV().  The parameters and return
+ * value are as per xStreamBufferSendV() and xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferSendVFromISR xStreamBufferSendVFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                  const StreamBufferTxVector_t * pxVectors,
+                                  size_t xVectorCount,
+                                  BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -879,6 +1037,360 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
                                     size_t xBufferLengthBytes,
                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+ *                               const StreamBufferRxVector_t *pxVectors,
+ *                               size_t xVectorCount,
+ *                               TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Scatter version of xStreamBufferReceive().  The received bytes are written
+ * to the xVectorCount buffers described by pxVectors, filling each one in turn
+ * before moving on to the next.  Zero length fragments are skipped.
+ *
+ * When used on a message buffer (see xMessageBufferReceiveV()) one message is
+ * read, and the total length of the fragments must be large enough to hold it.
+ * If it is not then the message is left in the message buffer and 0 is
+ * returned, as per xMessageBufferReceive().
+ *
+ * The same single writer/single reader restrictions as xStreamBufferReceive()
+ * apply.
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferReceiveV() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer from which bytes are to
+ * be received.
+ *
+ * @param pxVectors An array of xVectorCount fragment descriptors.
+ *
+ * @param xVectorCount The number of entries in pxVectors.
+ *
+ * @param xTicksToWait As per xStreamBufferReceive().
+ *
+ * @return The number of bytes read from the stream buffer.
+ *
+ * \defgroup xStreamBufferReceiveV xStreamBufferReceiveV
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+                              const StreamBufferRxVector_t * pxVectors,
+                              size_t xVectorCount,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                      const StreamBufferRxVector_t *pxVectors,
+ *                                      size_t xVectorCount,
+ *                                      BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferReceiveV().  The parameters and return
+ * value are as per xStreamBufferReceiveV() and xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReceiveVFromISR xStreamBufferReceiveVFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                     const StreamBufferRxVector_t * pxVectors,
+                                     size_t xVectorCount,
+                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+ *                                   void *pvRxData,
+ *                                   size_t xBufferLengthBytes,
+ *                                   size_t *pxMessageLengths,
+ *                                   size_t xMaxMessages,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Receives as many whole messages from a message buffer as fit in pvRxData in
+ * a single call.  Can only be used on message buffers - use the
+ * xMessageBufferReceiveBatch() macro rather than calling this function
+ * directly.
+ *
+ * \defgroup xStreamBufferReceiveBatch xStreamBufferReceiveBatch
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+                                  void * pvRxData,
+                                  size_t xBufferLengthBytes,
+                                  size_t * pxMessageLengths,
+                                  size_t xMaxMessages,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferReceiveBatchFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                          void *pvRxData,
+ *                                          size_t xBufferLengthBytes,
+ *                                          size_t *pxMessageLengths,
+ *                                          size_t xMaxMessages,
+ *                                          BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferReceiveBatch().  Use the
+ * xMessageBufferReceiveBatchFromISR() macro rather than calling this function
+ * directly.
+ *
+ * \defgroup xStreamBufferReceiveBatchFromISR xStreamBufferReceiveBatchFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferReceiveBatchFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         void * pvRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * pxMessageLengths,
+                                         size_t xMaxMessages,
+                                         BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferAcquireWrite( StreamBufferHandle_t xStreamBuffer,
+ *                                   void **ppvData,
+ *                                   TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains direct access to the free space in a stream buffer, so a DMA engine
+ * or a driver can write data into the stream buffer's own storage area rather
+ * than into an intermediate buffer that is then copied by xStreamBufferSend().
+ * Once the data has been written, xStreamBufferCommitWrite() makes it visible
+ * to the reader.
+ *
+ * The region returned is always contiguous.  The free space in the buffer can
+ * wrap around the end of the storage area, in which case the region returned
+ * ends at the end of the storage area, and the rest of the free space is
+ * returned by the next call made after the first region has been committed.
+ *
+ * This function can only be used with stream buffers and stream batching
+ * buffers, not with message buffers.  It is the writer side of the buffer, so
+ * the same single writer restrictions as xStreamBufferSend() apply, and a
+ * region must be committed before xStreamBufferSend() is next called.
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferAcquireWrite() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to write to.
+ *
+ * @param ppvData Set to the start of the region.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for the stream buffer to have some free
+ * space.  A task does not use any CPU time while it is in the Blocked state.
+ *
+ * @return The length of the region in bytes, which is 0 if the call timed out
+ * before any space became free.
+ *
+ * Example use:
+ * @code{c}
+ * void vStartReception( StreamBufferHandle_t xStreamBuffer )
+ * {
+ * void *pvRegion;
+ * size_t xRegionLength;
+ *
+ *  // Wait for space, then let the DMA engine fill it directly.  The DMA
+ *  // complete interrupt calls xStreamBufferCommitWriteFromISR().
+ *  xRegionLength = xStreamBufferAcquireWrite( xStreamBuffer, &pvRegion, portMAX_DELAY );
+ *
+ *  if( xRegionLength > 0 )
+ *  {
+ *      vStartDMA( pvRegion, xRegionLength );
+ *  }
+ * }
+ * @endcode
+ * \defgroup xStreamBufferAcquireWrite xStreamBufferAcquireWrite
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquireWrite( StreamBufferHandle_t xStreamBuffer,
+                                  void ** ppvData,
+                                  TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferAcquireWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                          void **ppvData );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferAcquireWrite().  Returns 0 instead of
+ * blocking if the stream buffer is full.
+ *
+ * \defgroup xStreamBufferAcquireWriteFromISR xStreamBufferAcquireWriteFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquireWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         void ** ppvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+ *                                      size_t xDataLengthBytes );
+ * @endcode
+ *
+ * Adds the first xDataLengthBytes bytes of the region obtained from
+ * xStreamBufferAcquireWrite() to the data in the stream buffer.  As with
+ * xStreamBufferSend(), a task blocked waiting for data is unblocked if the
+ * number of bytes in the buffer reaches the trigger level.
+ *
+ * @param xStreamBuffer The handle of the stream buffer written to.
+ *
+ * @param xDataLengthBytes The number of bytes written into the region, which
+ * can be less than the length of the region, and can be 0.
+ *
+ * @return pdPASS if the bytes were added, or pdFAIL if xDataLengthBytes is
+ * larger than the region, in which case the stream buffer is not changed.
+ *
+ * \defgroup xStreamBufferCommitWrite xStreamBufferCommitWrite
+ * \ingroup StreamBufferManagement
+ */
+BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xDataLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                             size_t xDataLengthBytes,
+ *                                             BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferCommitWrite(), for example for use in
+ * a DMA complete interrupt.  pxHigherPriorityTaskWoken is used as per
+ * xStreamBufferSendFromISR().
+ *
+ * \defgroup xStreamBufferCommitWriteFromISR xStreamBufferCommitWriteFromISR
+ * \ingroup StreamBufferManagement
+ */
+BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xDataLengthBytes,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferAcquireRead( StreamBufferHandle_t xStreamBuffer,
+ *                                  void **ppvData,
+ *                                  TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Obtains direct access to the data in a stream buffer, so a DMA engine or a
+ * driver can read it from the stream buffer's own storage area rather than
+ * from an intermediate buffer filled by xStreamBufferReceive().  Once the data
+ * has been consumed, xStreamBufferReleaseRead() frees the space it occupied.
+ *
+ * As with xStreamBufferAcquireWrite(), the region returned is contiguous, so
+ * if the data wraps around the end of the storage area then the rest of it is
+ * returned by the next call made after the first region has been released.
+ * As with xStreamBufferReceive(), the calling task only blocks until the
+ * stream buffer contains data, and a stream batching buffer only returns data
+ * once it holds more than its trigger level.
+ *
+ * This function can only be used with stream buffers and stream batching
+ * buffers, not with message buffers.  It is the reader side of the buffer, so
+ * the same single reader restrictions as xStreamBufferReceive() apply, and a
+ * region must be released before xStreamBufferReceive() is next called.
+ *
+ * configUSE_STREAM_BUFFERS must be set to 1 in for FreeRTOSConfig.h for
+ * xStreamBufferAcquireRead() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer to read from.
+ *
+ * @param ppvData Set to the start of the region.
+ *
+ * @param xTicksToWait The maximum amount of time the calling task should
+ * remain in the Blocked state to wait for data to become available.
+ *
+ * @return The length of the region in bytes, which is 0 if the call timed out
+ * before any data became available.
+ *
+ * \defgroup xStreamBufferAcquireRead xStreamBufferAcquireRead
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquireRead( StreamBufferHandle_t xStreamBuffer,
+                                 void ** ppvData,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * size_t xStreamBufferAcquireReadFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                         void **ppvData );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferAcquireRead().  Returns 0 instead of
+ * blocking if the stream buffer is empty.
+ *
+ * \defgroup xStreamBufferAcquireReadFromISR xStreamBufferAcquireReadFromISR
+ * \ingroup StreamBufferManagement
+ */
+size_t xStreamBufferAcquireReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        void ** ppvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferReleaseRead( StreamBufferHandle_t xStreamBuffer,
+ *                                      size_t xBufferLengthBytes );
+ * @endcode
+ *
+ * Removes the first xBufferLengthBytes bytes of the region obtained from
+ * xStreamBufferAcquireRead() from the stream buffer.  As with
+ * xStreamBufferReceive(), a task blocked waiting for space is unblocked.
+ *
+ * @param xStreamBuffer The handle of the stream buffer read from.
+ *
+ * @param xBufferLengthBytes The number of bytes consumed from the region,
+ * which can be less than the length of the region, and can be 0.
+ *
+ * @return pdPASS if the bytes were removed, or pdFAIL if xBufferLengthBytes is
+ * larger than the region, in which case the stream buffer is not changed.
+ *
+ * \defgroup xStreamBufferReleaseRead xStreamBufferReleaseRead
+ * \ingroup StreamBufferManagement
+ */
+BaseType_t xStreamBufferReleaseRead( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBufferLengthBytes ) PRIVILEGED_FUNCTION;
+
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferReleaseReadFromISR( StreamBufferHandle_t xStreamBuffer,
+ *                                             size_t xBufferLengthBytes,
+ *                                             BaseType_t *pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * Interrupt safe version of xStreamBufferReleaseRead(), for example for use in
+ * a DMA complete interrupt.  pxHigherPriorityTaskWoken is used as per
+ * xStreamBufferReceiveFromISR().
+ *
+ * \defgroup xStreamBufferReleaseReadFromISR xStreamBufferReleaseReadFromISR
+ * \ingroup StreamBufferManagement
+ */
+BaseType_t xStreamBufferReleaseReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBufferLengthBytes,
+                                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
 /**
  * stream_buffer.h
  *
@@ -1101,6 +1613,57 @@ size_t xStreamBufferBytesAvailable( StreamBufferHandle_t xStreamBuffer ) PRIVILE
 BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
                                          size_t xTriggerLevel ) PRIVILEGED_FUNCTION;
 
+/**
+ * stream_buffer.h
+ *
+ * @code{c}
+ * BaseType_t xStreamBufferSetNotificationCoalescing( StreamBufferHandle_t xStreamBuffer,
+ *                                                    size_t xCoalesceBytes,
+ *                                                    TickType_t xCoalesceTicks );
+ * @endcode
+ *
+ * Reduces the number of times a task reading from the stream buffer is woken
+ * when data is written to the buffer a few bytes at a time.
+ *
+ * Normally a reader that is blocked on an empty stream buffer is woken as soon
+ * as the trigger level is reached, and so can be woken once per write.  Once
+ * coalescing is enabled, a reader that has just been woken in that way does
+ * not return immediately.  Instead it blocks again until either the buffer
+ * holds at least xCoalesceBytes bytes, or xCoalesceTicks ticks have passed,
+ * whichever comes first, and then receives everything that has arrived.  A
+ * burst of small writes therefore costs the reader two wake ups rather than
+ * one per write, at the cost of up to xCoalesceTicks of extra latency.  The
+ * extra wait never extends beyond the read's own block time, and a read that
+ * finds data already in the buffer returns immediately as normal.
+ *
+ * Coalescing applies to every function that blocks to read from the buffer,
+ * and to message buffers as well as stream buffers.  When used with a message
+ * buffer xCoalesceBytes includes the bytes used to store each message's
+ * length.
+ *
+ * configUSE_STREAM_BUFFER_COALESCING must be set to 1 in FreeRTOSConfig.h for
+ * xStreamBufferSetNotificationCoalescing() to be available.
+ *
+ * @param xStreamBuffer The handle of the stream buffer being updated.
+ *
+ * @param xCoalesceBytes The number of bytes that end the wait early.  Set to 0
+ * to end the wait on time only.
+ *
+ * @param xCoalesceTicks The maximum time, in ticks, for which the reader holds
+ * off.  Set to 0 to disable coalescing, which is the default.
+ *
+ * @return If xCoalesceBytes is less than the stream buffer's length then the
+ * policy is updated and pdPASS is returned.  Otherwise pdFAIL is returned.
+ *
+ * \defgroup xStreamBufferSetNotificationCoalescing xStreamBufferSetNotificationCoalescing
+ * \ingroup StreamBufferManagement
+ */
+#if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+    BaseType_t xStreamBufferSetNotificationCoalescing( StreamBufferHandle_t xStreamBuffer,
+                                                       size_t xCoalesceBytes,
+                                                       TickType_t xCoalesceTicks ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * stream_buffer.h
  *
@@ -184,6 +184,37 @@ typedef struct xTASK_STATUS
     #endif
 } TaskStatus_t;
 
+/* Used with the vTaskGetBudgetStatus() function to return the budget of a
+ * task and its consumption. */
+typedef struct xTASK_BUDGET_STATUS
+{
+    TickType_t xBudget;                           /* The processor time the task can use at its priority in each period, or 0 if the task has no budget. */
+    TickType_t xPeriod;                           /* The time after which consumed budget is replenished. */
+    TickType_t xRemaining;                        /* The budget not yet consumed. */
+    TickType_t xConsumed;                         /* The number of ticks charged to the task since its budget was set, including those it ran for while demoted. */
+    UBaseType_t uxExhaustions;                    /* The number of times the task exhausted its budget since its budget was set. */
+    BaseType_t xExhausted;                        /* pdTRUE if the task is demoted because its budget is exhausted, otherwise pdFALSE. */
+    configRUN_TIME_COUNTER_TYPE ulRunTimeCounter; /* The total run time allocated to the task so far, as defined by the run time stats clock.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
+} TaskBudgetStatus_t;
+
+#if ( configUSE_PERIODIC_TASKS == 1 )
+
+/* Used with the vTaskGetPeriodicStatus() function to return the timing of the
+ * cycles of a periodic task. */
+    typedef struct xTASK_PERIODIC_STATUS
+    {
+        TickType_t xPeriod;                                            /* The time between releases, or 0 if the task is not periodic. */
+        TickType_t xDeadline;                                          /* The deadline of each cycle relative to its release. */
+        TickType_t xMaxResponseTime;                                   /* The longest time from the release of a cycle to its completion. */
+        TickType_t xMaxLateness;                                       /* The longest time by which a cycle missed its deadline. */
+        uint32_t ulCycles;                                             /* The number of cycles completed. */
+        uint32_t ulDeadlineMisses;                                     /* The number of cycles that completed after their deadline. */
+        uint32_t ulOverruns;                                           /* The number of cycles that completed after the release of the next cycle. */
+        uint32_t ulHistogram[ configPERIODIC_TASK_HISTOGRAM_BUCKETS ]; /* The cycles counted by response time.  The last bucket counts the cycles that missed their deadline.  The others divide the time from release to deadline evenly, each being the deadline divided by their number, rounded up, wide. */
+    } TaskPeriodicStatus_t;
+
+#endif
+
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
 typedef enum
 {
@@ -975,6 +1006,291 @@ BaseType_t xTaskDelayUntil( TickType_t * const pxPreviousWakeTime,
     BaseType_t xTaskAbortDelay( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
 #endif
 
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskEDFAdmit( TaskHandle_t xTask, TickType_t xExecutionTime, TickType_t xRelativeDeadline, TickType_t xPeriod );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Makes a task an earliest deadline first (EDF) task.  The task performs a job
+ * once every xPeriod ticks, each job taking at most xExecutionTime ticks of
+ * processor time and needing to complete within xRelativeDeadline ticks of
+ * being released.  The first job is released when the task is admitted, and
+ * the task calls xTaskEDFWaitForNextPeriod() each time it completes a job.
+ *
+ * EDF tasks run at configEDF_PRIORITY, and when more than one is ready the one
+ * whose job has the earliest deadline runs.  Tasks of other priorities are
+ * scheduled as usual, so tasks of higher priority preempt EDF tasks, and
+ * configEDF_PRIORITY must not be used by tasks that are not EDF tasks.
+ *
+ * A task is only admitted if the processor time reserved by all the EDF tasks,
+ * the sum of xExecutionTime divided by the lesser of xRelativeDeadline and
+ * xPeriod, remains within configEDF_UTILISATION_BOUND percent.  Then every
+ * job meets its deadline provided no job exceeds its execution time and tasks
+ * of higher priority leave that share of the processor.  Admitting a task
+ * again replaces its reservation, and deleting it returns the reservation.
+ *
+ * @param xTask The handle of the task being admitted.  Passing a NULL handle
+ * admits the calling task.
+ *
+ * @param xExecutionTime The worst case processor time of a job, in ticks.
+ *
+ * @param xRelativeDeadline The time from the release of each job to its
+ * deadline, in ticks.
+ *
+ * @param xPeriod The time between the releases of consecutive jobs, in ticks.
+ * xRelativeDeadline and xPeriod must not exceed a quarter of the range of
+ * TickType_t.
+ *
+ * @return pdPASS if the task was admitted, otherwise pdFAIL, in which case the
+ * task is left unchanged.
+ *
+ * Example usage:
+ * @code{c}
+ * void vControlTask( void * pvParameters )
+ * {
+ *   // Run the control loop every 10 ticks, within 8 ticks of the start of
+ *   // each period.  Each cycle needs at most 2 ticks of processor time.
+ *   if( xTaskEDFAdmit( NULL, 2, 8, 10 ) == pdPASS )
+ *   {
+ *       for( ;; )
+ *       {
+ *           // Perform the control action here.
+ *
+ *           xTaskEDFWaitForNextPeriod();
+ *       }
+ *   }
+ * }
+ * @endcode
+ * \defgroup xTaskEDFAdmit xTaskEDFAdmit
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    BaseType_t xTaskEDFAdmit( TaskHandle_t xTask,
+                              TickType_t xExecutionTime,
+                              TickType_t xRelativeDeadline,
+                              TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskEDFWaitForNextPeriod( void );
+ * @endcode
+ *
+ * configUSE_EDF_SCHEDULING must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Called by an EDF task when it completes a job, to block until the release of
+ * its next job one period after the release of the completed job.  If that time
+ * has already passed then the next job starts without the task blocking.
+ *
+ * If the job completed after its deadline then traceTASK_EDF_DEADLINE_MISSED()
+ * is called and, if configUSE_EDF_DEADLINE_MISS_HOOK is set to 1,
+ * vApplicationEDFDeadlineMissHook() is called before the task blocks.
+ *
+ * If configUSE_PERIODIC_TASKS is also set to 1 then the response time of the
+ * job is recorded as by xTaskPeriodicWait(), and can be obtained using
+ * vTaskGetPeriodicStatus().
+ *
+ * @return pdPASS if the completed job met its deadline, otherwise pdFAIL.
+ *
+ * \defgroup xTaskEDFWaitForNextPeriod xTaskEDFWaitForNextPeriod
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_EDF_SCHEDULING == 1 )
+    BaseType_t xTaskEDFWaitForNextPeriod( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskSetBudget( TaskHandle_t xTask, TickType_t xBudget, TickType_t xPeriod, UBaseType_t uxLowPriority );
+ * @endcode
+ *
+ * configUSE_TASK_BUDGETS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Limits the processor time a task can use at its priority, so a task that
+ * misbehaves cannot starve the tasks of lower priority.  The task can run for
+ * xBudget ticks at its priority, after which it is demoted to uxLowPriority
+ * until budget is replenished.  As for a sporadic server, the budget consumed
+ * by each run of the task is replenished xPeriod ticks after the run started,
+ * so over any xPeriod ticks the task uses at most xBudget ticks at its
+ * priority.  A task demoted to tskIDLE_PRIORITY is throttled to the time that
+ * no other task needs.
+ *
+ * Each tick is charged to the task that was running when the tick interrupt
+ * occurred, from within xTaskIncrementTick().  At most
+ * configTASK_BUDGET_MAX_REPLENISHMENTS replenishments are held per task; runs
+ * beyond that are replenished later than they would otherwise be, never
+ * earlier.
+ *
+ * The priority of the task when the budget is set is the priority it has while
+ * its budget lasts.  Setting the budget again replaces it, and restores the
+ * task to that priority if it is demoted.
+ *
+ * @param xTask The handle of the task.  Passing a NULL handle sets the budget
+ * of the calling task.
+ *
+ * @param xBudget The ticks the task can use at its priority in each period.
+ * Passing 0 removes the budget.
+ *
+ * @param xPeriod The ticks after which consumed budget is replenished.  Must
+ * not be less than xBudget.
+ *
+ * @param uxLowPriority The priority of the task while its budget is exhausted.
+ * Must be lower than the priority of the task.
+ *
+ * Example usage:
+ * @code{c}
+ * void vAFunction( TaskHandle_t xLoggingTask )
+ * {
+ *   // Let the logging task use up to 20 ticks in any 100 at its priority,
+ *   // and only run when nothing else needs to beyond that.
+ *   vTaskSetBudget( xLoggingTask, 20, 100, tskIDLE_PRIORITY );
+ * }
+ * @endcode
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         TickType_t xBudget,
+                         TickType_t xPeriod,
+                         UBaseType_t uxLowPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetBudgetStatus( TaskHandle_t xTask, TaskBudgetStatus_t *pxBudgetStatus );
+ * @endcode
+ *
+ * configUSE_TASK_BUDGETS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Obtains the budget of a task set by vTaskSetBudget(), how much of it
+ * remains, and how much processor time the task has consumed.
+ *
+ * @param xTask The handle of the task being queried.  Passing a NULL handle
+ * queries the calling task.
+ *
+ * @param pxBudgetStatus The structure into which the status is written.
+ *
+ * \defgroup vTaskGetBudgetStatus vTaskGetBudgetStatus
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    void vTaskGetBudgetStatus( TaskHandle_t xTask,
+                               TaskBudgetStatus_t * pxBudgetStatus ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskPeriodicStart( TickType_t xPeriod, TickType_t xDeadline );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Makes the calling task periodic, so the kernel tracks the timing of each of
+ * its cycles.  The first cycle is released when vTaskPeriodicStart() is
+ * called, and the task calls xTaskPeriodicWait() each time it completes a
+ * cycle, in place of xTaskDelayUntil().  Calling vTaskPeriodicStart() again
+ * restarts the releases and clears the recorded timing.  It must not be called
+ * by an EDF task, as xTaskEDFAdmit() sets the period and deadline of an EDF
+ * task.
+ *
+ * @param xPeriod The time between the releases of consecutive cycles, in
+ * ticks.
+ *
+ * @param xDeadline The time from the release of each cycle by which it must
+ * complete, in ticks.  Passing 0 sets the deadline to the period.
+ *
+ * Example usage:
+ * @code{c}
+ * void vControlTask( void * pvParameters )
+ * {
+ *   // Run every 10 ticks, completing within 5 ticks of each release.
+ *   vTaskPeriodicStart( 10, 5 );
+ *
+ *   for( ;; )
+ *   {
+ *       // Perform the control action here.
+ *
+ *       xTaskPeriodicWait();
+ *   }
+ * }
+ * @endcode
+ * \defgroup vTaskPeriodicStart vTaskPeriodicStart
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    void vTaskPeriodicStart( TickType_t xPeriod,
+                             TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * BaseType_t xTaskPeriodicWait( void );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Called by a periodic task when it completes a cycle.  Records the response
+ * time of the cycle, then blocks until the release of the next cycle one period
+ * after the release of the completed cycle.  If that time has already passed,
+ * because the cycle overran, the next cycle starts without the task blocking
+ * and is measured from the time it should have been released.
+ *
+ * If the cycle completed after its deadline then
+ * traceTASK_PERIODIC_DEADLINE_MISSED() is called and, if
+ * configUSE_PERIODIC_TASK_OVERRUN_HOOK is set to 1,
+ * vApplicationPeriodicTaskOverrunHook() is called before the task blocks.
+ *
+ * @return pdPASS if the completed cycle met its deadline, otherwise pdFAIL.
+ *
+ * \defgroup xTaskPeriodicWait xTaskPeriodicWait
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    BaseType_t xTaskPeriodicWait( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task. h
+ * @code{c}
+ * void vTaskGetPeriodicStatus( TaskHandle_t xTask, TaskPeriodicStatus_t *pxPeriodicStatus );
+ * @endcode
+ *
+ * configUSE_PERIODIC_TASKS must be set to 1 in FreeRTOSConfig.h for this
+ * function to be available.
+ *
+ * Obtains the timing recorded for the cycles of a periodic task since it
+ * called vTaskPeriodicStart(), or since it was admitted by xTaskEDFAdmit() if
+ * it is an EDF task: the number of cycles, deadline misses and overruns, the
+ * worst response time and lateness, and a histogram of response times.
+ *
+ * @param xTask The handle of the task being queried.  Passing a NULL handle
+ * queries the calling task.
+ *
+ * @param pxPeriodicStatus The structure into which the status is written.
+ *
+ * \defgroup vTaskGetPeriodicStatus vTaskGetPeriodicStatus
+ * \ingroup TaskCtrl
+ */
+#if ( configUSE_PERIODIC_TASKS == 1 )
+    void vTaskGetPeriodicStatus( TaskHandle_t xTask,
+                                 TaskPeriodicStatus_t * pxPeriodicStatus ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * task. h
  * @code{c}
@@ -1953,6 +2269,52 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery ) PRIVILEGED_FUNCTION;
 
 #endif
 
+#if ( configUSE_EDF_DEADLINE_MISS_HOOK == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationEDFDeadlineMissHook( TaskHandle_t xTask, TickType_t xLateness );
+ * @endcode
+ *
+ * The application EDF deadline miss hook is called from
+ * xTaskEDFWaitForNextPeriod() when an EDF task completes a job after its
+ * deadline.  It is called from the task itself, so it must not block.
+ *
+ * @param xTask The task that missed its deadline.
+ * @param xLateness The number of ticks by which the deadline was missed.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationEDFDeadlineMissHook( TaskHandle_t xTask,
+                                          TickType_t xLateness );
+
+#endif
+
+#if ( configUSE_PERIODIC_TASK_OVERRUN_HOOK == 1 )
+
+/**
+ * task.h
+ * @code{c}
+ * void vApplicationPeriodicTaskOverrunHook( TaskHandle_t xTask, TickType_t xLateness );
+ * @endcode
+ *
+ * The application periodic task overrun hook is called from
+ * xTaskPeriodicWait() when a periodic task completes a cycle after its
+ * deadline.  It is called from the task itself, so it must not block.
+ *
+ * @param xTask The task that missed its deadline.
+ * @param xLateness The number of ticks by which the deadline was missed.
+ */
+    /* MISRA Ref 8.6.1 [External linkage] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-86 */
+    /* coverity[misra_c_2012_rule_8_6_violation] */
+    void vApplicationPeriodicTaskOverrunHook( TaskHandle_t xTask,
+                                              TickType_t xLateness );
+
+#endif
+
 #if ( configUSE_IDLE_HOOK == 1 )
 
 /**
@@ -3527,6 +3889,11 @@ BaseType_t xTaskIncrementTick( void ) PRIVILEGED_FUNCTION;
  * owning task's priority) to insert the list item into the event list in task
  * priority order.
  *
+ * The 'FIFO' version leaves the event list item value unchanged, and inserts
+ * the list item at the end of the list so tasks are woken in the order in
+ * which they started to wait, whatever their priority.  The insertion takes
+ * constant time however many tasks are waiting.
+ *
  * @param pxEventList The list containing tasks that are blocked waiting
  * for the event to occur.
  *
@@ -3543,6 +3910,8 @@ void vTaskPlaceOnEventList( List_t * const pxEventList,
 void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
                                      const TickType_t xItemValue,
                                      const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+void vTaskPlaceOnFIFOEventList( List_t * const pxEventList,
+                                const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
@@ -3704,12 +4073,107 @@ void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder,
  */
 TaskHandle_t pvTaskIncrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
 
+/*
+ * For internal use only.  Decrement the mutex held count of the calling task
+ * when it gives a light mutex that no other task was waiting for.  If that
+ * leaves the task holding no mutexes while it has an inherited priority then
+ * its base priority is restored, and pdTRUE is returned if the caller must
+ * yield as a result.
+ */
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+    BaseType_t xTaskDecrementMutexHeldCount( void ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Raise the priority of the calling task to
+ * uxCeilingPriority, if it is not already at or above that priority, when it
+ * takes a light mutex created with a priority ceiling.  The raised priority is
+ * treated as an inherited priority, so it is restored by
+ * xTaskDecrementMutexHeldCount() or xTaskPriorityDisinherit() when the task no
+ * longer holds any mutexes.
+ */
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+    void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Records that the calling task is about to block on
+ * the mutex whose holder is stored at pxMutexHolder, so xTaskPriorityInherit()
+ * and vTaskPriorityDisinheritAfterTimeout() can follow the chain from a holder
+ * that is itself blocked to the holder of the mutex it is waiting for.  Must be
+ * called with NULL once the task stops waiting for the mutex.
+ */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) )
+    void vTaskSetMutexWaitedOn( TaskHandle_t volatile * pxMutexHolder ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Marks the calling task as waiting for, and no longer
+ * waiting for, a notification at index uxIndexToWaitOn while it waits in
+ * pxWaitAny().  Both return pdTRUE if a notification is pending at that index.
+ * Must be called from a critical section.
+ */
+#if ( ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( configUSE_WAIT_ANY == 1 ) )
+    BaseType_t xTaskAddNotificationToWaitAny( UBaseType_t uxIndexToWaitOn ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskRemoveNotificationFromWaitAny( UBaseType_t uxIndexToWaitOn ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * For internal use only.  Set the priority of the task that runs a task group
+ * (see task_group.h) to the priority of the group's most urgent member.  Both
+ * must be called from a critical section, and return pdTRUE if a yield is
+ * required.  xTaskGroupSetPriority() is called from tasks and can raise or
+ * lower the priority.  xTaskGroupRaisePriorityFromISR() is called from
+ * interrupts and can only raise it.  If the task is ready and the scheduler is
+ * suspended then the raise takes effect when the scheduler is resumed.
+ */
+#if ( configUSE_TASK_GROUPS == 1 )
+    BaseType_t xTaskGroupSetPriority( TaskHandle_t xTask,
+                                      UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+    BaseType_t xTaskGroupRaisePriorityFromISR( TaskHandle_t xTask,
+                                               UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+#endif
+
 /*
  * For internal use only.  Same as vTaskSetTimeOutState(), but without a critical
  * section.
  */
 void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
 
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( ( configTASK_ARENA_SIZE + configQUEUE_ARENA_SIZE + configTIMER_ARENA_SIZE + configEVENT_GROUP_ARENA_SIZE ) > 0 ) )
+
+/*
+ * For internal use only.  An arena of fixed size kernel objects, each of which
+ * is either in use, on the free list, or at or above uxNextUnused (never used).
+ * Arenas are statically initialised by the kernel module that owns the object
+ * type, with uxNextUnused set to 0 and pvFreeList set to NULL.
+ */
+    typedef struct xKERNEL_OBJECT_ARENA
+    {
+        void * pvStorage;         /* The start of the array of objects. */
+        size_t xObjectSize;       /* The size of one object in the array. */
+        UBaseType_t uxObjects;    /* The number of objects in the array. */
+        UBaseType_t uxNextUnused; /* The index of the first object that has never been used. */
+        void * pvFreeList;        /* Objects that have been freed, linked through their first bytes. */
+    } KernelObjectArena_t;
+
+/*
+ * For internal use only.  Take an object from pxArena in constant time, or
+ * allocate it from the FreeRTOS heap if the arena is exhausted.  Returns NULL
+ * if neither has space.
+ */
+    void * pvTaskAllocateKernelObject( KernelObjectArena_t * pxArena ) PRIVILEGED_FUNCTION;
+
+/*
+ * For internal use only.  Return an object obtained from
+ * pvTaskAllocateKernelObject() to pxArena, or to the FreeRTOS heap if it did
+ * not come from the arena.
+ */
+    void vTaskFreeKernelObject( KernelObjectArena_t * pxArena,
+                                void * pvObject ) PRIVILEGED_FUNCTION;
+
+#endif /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( ( configTASK_ARENA_SIZE + configQUEUE_ARENA_SIZE + configTIMER_ARENA_SIZE + configEVENT_GROUP_ARENA_SIZE ) > 0 ) ) */
+
 /*
  * For internal use only. Same as portYIELD_WITHIN_API() in single core FreeRTOS.
  * For SMP this is not defined by the port.
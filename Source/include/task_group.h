@@ -0,0 +1,321 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef TASK_GROUP_H
+#define TASK_GROUP_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include task_group.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * A task group runs any number of run-to-completion members on the stack of a
+ * single task, the group task, so the group needs one stack sized for its
+ * most demanding member rather than one stack per member.  Members suit
+ * activities that spend most of their time waiting, and that would otherwise
+ * each need a task with a worst case stack of their own.
+ *
+ * A member is a function that is called with the events posted to it by
+ * vTaskGroupPost() or vTaskGroupPostFromISR().  It handles the events and
+ * returns, which is the only way it can wait for more events, so it must not
+ * call API functions with a non-zero block time.  Events posted to a member
+ * while it is waiting to run, or running, are combined and passed to its next
+ * call.
+ *
+ * Each member has a priority from the same range as tasks.  The group task is
+ * an ordinary task that the scheduler selects like any other, at the priority
+ * of the highest priority member that is ready or running, and members that
+ * are ready run highest priority first.  A member that is running is not
+ * preempted by other members of its group, but it is preempted by tasks, and
+ * members of other groups, of higher priority.  While a member waits for a
+ * lower priority member of its group to finish, the group task runs at the
+ * priority of the waiting member, so the wait is bounded by the run time of
+ * one member.  The group task is blocked, and uses no CPU time, while none of
+ * its members is ready.
+ *
+ * configUSE_TASK_GROUPS must be set to 1 in FreeRTOSConfig.h for the task
+ * group API to be available.  Task groups are not available in SMP builds.
+ *
+ * Groups are referenced by handles of type TaskGroupHandle_t.
+ *
+ * \defgroup TaskGroupHandle_t TaskGroupHandle_t
+ * \ingroup TaskGroups
+ */
+struct TaskGroupDefinition;
+typedef struct TaskGroupDefinition   * TaskGroupHandle_t;
+
+/**
+ * task_group.h
+ *
+ * Defines the prototype to which member functions must conform.  ulEvents
+ * holds the bits posted to the member since it last ran, and pvParameters is
+ * the value passed to vTaskGroupAddMember().
+ *
+ * \defgroup TaskGroupMemberFunction_t TaskGroupMemberFunction_t
+ * \ingroup TaskGroups
+ */
+typedef void (* TaskGroupMemberFunction_t)( uint32_t ulEvents,
+                                            void * pvParameters );
+
+/**
+ * task_group.h
+ *
+ * Holds the state of one member.  The variable belongs to the application,
+ * must remain in scope for as long as the member is in a group, and is
+ * initialised by vTaskGroupAddMember().  Its members must not be accessed
+ * directly.
+ *
+ * \defgroup TaskGroupMember_t TaskGroupMember_t
+ * \ingroup TaskGroups
+ */
+typedef struct xTASK_GROUP_MEMBER
+{
+    ListItem_t xReadyListItem;                  /* Places the member in the group's ready lists. */
+    struct TaskGroupDefinition * pxGroup;       /* The group the member belongs to. */
+    TaskGroupMemberFunction_t pxMemberFunction; /* The function that is called each time the member runs. */
+    void * pvParameters;                        /* Passed to pxMemberFunction. */
+    volatile uint32_t ulPendingEvents;          /* The events posted to the member since it last ran. */
+    UBaseType_t uxPriority;                     /* The priority of the member. */
+} TaskGroupMember_t;
+
+/**
+ * task_group.h
+ * @code{c}
+ * TaskGroupHandle_t xTaskGroupCreate( const char * const pcName, const configSTACK_DEPTH_TYPE uxStackDepth );
+ * @endcode
+ *
+ * Creates a new task group, and the group task that runs its members.  The
+ * memory used by the group and its task is allocated from the FreeRTOS heap.
+ * Use xTaskGroupCreateStatic() to provide the memory instead.
+ *
+ * @param pcName A descriptive name for the group task, as for xTaskCreate().
+ *
+ * @param uxStackDepth The size of the stack shared by all the members of the
+ * group, in words, as for xTaskCreate().  It must be large enough for the
+ * member that uses the most stack.
+ *
+ * @return If the group was created then a handle to the group is returned.  If
+ * there was insufficient FreeRTOS heap available to create the group then
+ * NULL is returned.
+ *
+ * Example usage:
+ * @code{c}
+ *  #define NUM_SENSORS     40
+ *
+ *  #define EVENT_SAMPLE    0x01
+ *  #define EVENT_CONFIG    0x02
+ *
+ *  static TaskGroupMember_t xSensorMembers[ NUM_SENSORS ];
+ *  static Sensor_t xSensors[ NUM_SENSORS ];
+ *
+ *  void vSensorMember( uint32_t ulEvents, void * pvParameters )
+ *  {
+ *      Sensor_t * pxSensor = ( Sensor_t * ) pvParameters;
+ *
+ *      if( ( ulEvents & EVENT_CONFIG ) != 0 )
+ *      {
+ *          vApplySensorConfig( pxSensor );
+ *      }
+ *
+ *      if( ( ulEvents & EVENT_SAMPLE ) != 0 )
+ *      {
+ *          vReadSensor( pxSensor );
+ *      }
+ *
+ *      // Returning waits for the next events.
+ *  }
+ *
+ *  void vCreateSensors( void )
+ *  {
+ *      TaskGroupHandle_t xGroup;
+ *      UBaseType_t x;
+ *
+ *      // One stack for all 40 sensors.
+ *      xGroup = xTaskGroupCreate( "Sensors", 512 );
+ *      configASSERT( xGroup );
+ *
+ *      for( x = 0; x < NUM_SENSORS; x++ )
+ *      {
+ *          vTaskGroupAddMember( xGroup, &( xSensorMembers[ x ] ), vSensorMember, &( xSensors[ x ] ), 2 );
+ *      }
+ *  }
+ *
+ *  // Called from the interrupt that signals a sample is available.
+ *  void vSampleISR( UBaseType_t uxSensor )
+ *  {
+ *      BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+ *
+ *      vTaskGroupPostFromISR( &( xSensorMembers[ uxSensor ] ), EVENT_SAMPLE, &xHigherPriorityTaskWoken );
+ *      portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+ *  }
+ * @endcode
+ * \defgroup xTaskGroupCreate xTaskGroupCreate
+ * \ingroup TaskGroups
+ */
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+    TaskGroupHandle_t xTaskGroupCreate( const char * const pcName,
+                                        const configSTACK_DEPTH_TYPE uxStackDepth ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task_group.h
+ * @code{c}
+ * TaskGroupHandle_t xTaskGroupCreateStatic( const char * const pcName, const configSTACK_DEPTH_TYPE uxStackDepth, StackType_t * const puxStackBuffer, StaticTask_t * const pxTaskBuffer, StaticTaskGroup_t * const pxGroupBuffer );
+ * @endcode
+ *
+ * Creates a new task group, and the group task that runs its members, using
+ * memory provided by the application writer.
+ *
+ * @param pcName A descriptive name for the group task.
+ *
+ * @param uxStackDepth The number of indexes in the puxStackBuffer array.
+ *
+ * @param puxStackBuffer Must point to a StackType_t array of at least
+ * uxStackDepth indexes, which will be used as the stack shared by the
+ * members.
+ *
+ * @param pxTaskBuffer Must point to a variable of type StaticTask_t, which
+ * will be used to hold the group task's data structure.
+ *
+ * @param pxGroupBuffer Must point to a variable of type StaticTaskGroup_t,
+ * which will be used to hold the group's data structure.
+ *
+ * @return If none of the buffers is NULL then the group is created and a
+ * handle to the group is returned.  Otherwise NULL is returned.
+ *
+ * \defgroup xTaskGroupCreateStatic xTaskGroupCreateStatic
+ * \ingroup TaskGroups
+ */
+#if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+    TaskGroupHandle_t xTaskGroupCreateStatic( const char * const pcName,
+                                              const configSTACK_DEPTH_TYPE uxStackDepth,
+                                              StackType_t * const puxStackBuffer,
+                                              StaticTask_t * const pxTaskBuffer,
+                                              StaticTaskGroup_t * const pxGroupBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * task_group.h
+ * @code{c}
+ * TaskHandle_t xTaskGroupGetTaskHandle( TaskGroupHandle_t xGroup );
+ * @endcode
+ *
+ * @return The handle of the group task, for example to check its stack high
+ * water mark.  The priority of the group task is managed by the group, so must
+ * not be changed with vTaskPrioritySet().
+ *
+ * \defgroup xTaskGroupGetTaskHandle xTaskGroupGetTaskHandle
+ * \ingroup TaskGroups
+ */
+TaskHandle_t xTaskGroupGetTaskHandle( TaskGroupHandle_t xGroup ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_group.h
+ * @code{c}
+ * void vTaskGroupAddMember( TaskGroupHandle_t xGroup, TaskGroupMember_t * pxMember, TaskGroupMemberFunction_t pxMemberFunction, void * pvParameters, UBaseType_t uxPriority );
+ * @endcode
+ *
+ * Adds a member to a group.  The member does not run until an event is posted
+ * to it.
+ *
+ * @param xGroup The group to add the member to.
+ *
+ * @param pxMember The variable that will hold the member's state.  Must not
+ * already be in a group.
+ *
+ * @param pxMemberFunction The function that is called each time the member
+ * runs.
+ *
+ * @param pvParameters Passed to pxMemberFunction each time it is called.
+ *
+ * @param uxPriority The priority of the member, from 0 to
+ * ( configMAX_PRIORITIES - 1 ).
+ *
+ * \defgroup vTaskGroupAddMember vTaskGroupAddMember
+ * \ingroup TaskGroups
+ */
+void vTaskGroupAddMember( TaskGroupHandle_t xGroup,
+                          TaskGroupMember_t * pxMember,
+                          TaskGroupMemberFunction_t pxMemberFunction,
+                          void * pvParameters,
+                          UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_group.h
+ * @code{c}
+ * void vTaskGroupPost( TaskGroupMember_t * pxMember, uint32_t ulEvents );
+ * @endcode
+ *
+ * Posts events to a member, which makes the member ready to run if it is not
+ * already.  Can be called from any task, including from a member.
+ *
+ * @param pxMember The member to post the events to.
+ *
+ * @param ulEvents The events to post, which are bitwise ORed into the events
+ * the member has not yet received.  Must not be 0.
+ *
+ * \defgroup vTaskGroupPost vTaskGroupPost
+ * \ingroup TaskGroups
+ */
+void vTaskGroupPost( TaskGroupMember_t * pxMember,
+                     uint32_t ulEvents ) PRIVILEGED_FUNCTION;
+
+/**
+ * task_group.h
+ * @code{c}
+ * void vTaskGroupPostFromISR( TaskGroupMember_t * pxMember, uint32_t ulEvents, BaseType_t * const pxHigherPriorityTaskWoken );
+ * @endcode
+ *
+ * A version of vTaskGroupPost() that can be called from an interrupt service
+ * routine.  *pxHigherPriorityTaskWoken is set to pdTRUE if the member's group
+ * task now has a priority above the priority of the interrupted task, in which
+ * case a context switch should be requested before the interrupt exits.
+ *
+ * \defgroup vTaskGroupPostFromISR vTaskGroupPostFromISR
+ * \ingroup TaskGroups
+ */
+void vTaskGroupPostFromISR( TaskGroupMember_t * pxMember,
+                            uint32_t ulEvents,
+                            BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* TASK_GROUP_H */
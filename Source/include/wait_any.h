@@ -0,0 +1,304 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+#ifndef WAIT_ANY_H
+#define WAIT_ANY_H
+
+#ifndef INC_FREERTOS_H
+    #error "include FreeRTOS.h" must appear in source files before "include wait_any.h"
+#endif
+
+/* FreeRTOS includes. */
+#include "task.h"
+#include "queue.h"
+#include "event_groups.h"
+#include "stream_buffer.h"
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    extern "C" {
+#endif
+/* *INDENT-ON* */
+
+/**
+ * pxWaitAny() blocks the calling task on any number of queues, semaphores,
+ * event groups, stream buffers, message buffers and task notifications at the
+ * same time, and returns as soon as one of them is ready.  Unlike a queue set
+ * the objects do not have to be added to anything in advance, and are not
+ * limited to queues and semaphores.  Instead the calling task passes an array
+ * of WaitAnyObject_t structures, normally on its own stack, and each
+ * structure is linked directly into the object it describes for the duration
+ * of the call.
+ *
+ * An object is ready when:
+ * - a queue or semaphore holds at least one item, so it can be read or taken;
+ * - an event group has any of the requested bits set;
+ * - a stream buffer holds at least its trigger level of bytes, or a message
+ *   buffer holds a message;
+ * - a task notification is pending at the requested index.
+ *
+ * pxWaitAny() does not read from, take or clear the ready object.  The calling
+ * task should do that itself with a block time of zero.  As with a queue set,
+ * another task may have done so first, in which case the call fails.
+ *
+ * configUSE_WAIT_ANY must be set to 1 in FreeRTOSConfig.h for the wait-any API
+ * to be available.  Single producer single consumer queues cannot be waited
+ * on.
+ *
+ * The members of WaitAnyObject_t are set by the vWaitAnySet...() functions and
+ * must not be accessed directly.
+ *
+ * \defgroup WaitAnyObject_t WaitAnyObject_t
+ * \ingroup WaitAny
+ */
+typedef struct xWAIT_ANY_OBJECT
+{
+    void * pvObject;                             /**< The handle of the queue, semaphore, event group or stream buffer, or NULL for a task notification. */
+    EventBits_t uxBitsToWaitFor;                 /**< The event group bits, any of which make an event group ready. */
+    UBaseType_t uxIndexToWaitOn;                 /**< The task notification index. */
+    struct xWAIT_ANY_OBJECT * pxNext;            /**< Links the structures of all the tasks waiting on the same object. */
+    struct WaitAnyContextDefinition * pxContext;/**< The call to pxWaitAny() the structure belongs to. */
+    uint8_t ucObjectType;                        /**< One of the waitanyOBJECT_TYPE_ values. */
+} WaitAnyObject_t;
+
+/* Values of the ucObjectType member of WaitAnyObject_t. */
+#define waitanyOBJECT_TYPE_QUEUE            ( ( uint8_t ) 0U )
+#define waitanyOBJECT_TYPE_EVENT_GROUP      ( ( uint8_t ) 1U )
+#define waitanyOBJECT_TYPE_STREAM_BUFFER    ( ( uint8_t ) 2U )
+#define waitanyOBJECT_TYPE_NOTIFICATION     ( ( uint8_t ) 3U )
+
+/**
+ * wait_any.h
+ * @code{c}
+ * void vWaitAnySetQueue( WaitAnyObject_t * pxObject, QueueHandle_t xQueue );
+ * @endcode
+ *
+ * Sets pxObject to wait for xQueue to hold an item.  Also used for semaphores
+ * and mutexes, which are ready when they can be taken.
+ *
+ * \defgroup vWaitAnySetQueue vWaitAnySetQueue
+ * \ingroup WaitAny
+ */
+void vWaitAnySetQueue( WaitAnyObject_t * pxObject,
+                       QueueHandle_t xQueue ) PRIVILEGED_FUNCTION;
+
+/**
+ * wait_any.h
+ * @code{c}
+ * void vWaitAnySetEventGroup( WaitAnyObject_t * pxObject, EventGroupHandle_t xEventGroup, EventBits_t uxBitsToWaitFor );
+ * @endcode
+ *
+ * Sets pxObject to wait for any of uxBitsToWaitFor to be set in xEventGroup.
+ * configUSE_EVENT_GROUPS must be set to 1.
+ *
+ * \defgroup vWaitAnySetEventGroup vWaitAnySetEventGroup
+ * \ingroup WaitAny
+ */
+#if ( configUSE_EVENT_GROUPS == 1 )
+    void vWaitAnySetEventGroup( WaitAnyObject_t * pxObject,
+                                EventGroupHandle_t xEventGroup,
+                                EventBits_t uxBitsToWaitFor ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * wait_any.h
+ * @code{c}
+ * void vWaitAnySetStreamBuffer( WaitAnyObject_t * pxObject, StreamBufferHandle_t xStreamBuffer );
+ * @endcode
+ *
+ * Sets pxObject to wait for xStreamBuffer to hold at least its trigger level
+ * of bytes.  Also used for message buffers, which are ready when they hold a
+ * message.  configUSE_STREAM_BUFFERS must be set to 1.
+ *
+ * \defgroup vWaitAnySetStreamBuffer vWaitAnySetStreamBuffer
+ * \ingroup WaitAny
+ */
+#if ( configUSE_STREAM_BUFFERS == 1 )
+    void vWaitAnySetStreamBuffer( WaitAnyObject_t * pxObject,
+                                  StreamBufferHandle_t xStreamBuffer ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * wait_any.h
+ * @code{c}
+ * void vWaitAnySetNotification( WaitAnyObject_t * pxObject, UBaseType_t uxIndexToWaitOn );
+ * @endcode
+ *
+ * Sets pxObject to wait for a notification to be sent to the calling task at
+ * index uxIndexToWaitOn.  configUSE_TASK_NOTIFICATIONS must be set to 1.
+ *
+ * \defgroup vWaitAnySetNotification vWaitAnySetNotification
+ * \ingroup WaitAny
+ */
+#if ( configUSE_TASK_NOTIFICATIONS == 1 )
+    void vWaitAnySetNotification( WaitAnyObject_t * pxObject,
+                                  UBaseType_t uxIndexToWaitOn ) PRIVILEGED_FUNCTION;
+#endif
+
+/**
+ * wait_any.h
+ * @code{c}
+ * WaitAnyObject_t * pxWaitAny( WaitAnyObject_t * pxObjects, UBaseType_t uxObjectCount, TickType_t xTicksToWait );
+ * @endcode
+ *
+ * Waits in the Blocked state for any of the objects described by pxObjects to
+ * be ready.  If more than one object is already ready then the first of them
+ * in pxObjects is returned, otherwise the first to become ready is returned.
+ * Must only be called from a task.
+ *
+ * @param pxObjects An array of structures set with the vWaitAnySet...()
+ * functions.  The array must remain valid until pxWaitAny() returns, and must
+ * not be used by more than one call to pxWaitAny() at a time.
+ *
+ * @param uxObjectCount The number of structures in pxObjects.
+ *
+ * @param xTicksToWait The maximum time, in ticks, the calling task should wait
+ * in the Blocked state for an object to be ready.
+ *
+ * @return The member of pxObjects that describes the ready object, or NULL if
+ * xTicksToWait expired before any object was ready.
+ *
+ * Example usage:
+ * @code{c}
+ *  void vGatewayTask( void * pvParameters )
+ *  {
+ *      WaitAnyObject_t xObjects[ 3 ];
+ *      WaitAnyObject_t * pxReady;
+ *
+ *      vWaitAnySetQueue( &( xObjects[ 0 ] ), xCommandQueue );
+ *      vWaitAnySetEventGroup( &( xObjects[ 1 ] ), xLinkEvents, LINK_UP_BIT | LINK_DOWN_BIT );
+ *      vWaitAnySetNotification( &( xObjects[ 2 ] ), 0 );
+ *
+ *      for( ;; )
+ *      {
+ *          pxReady = pxWaitAny( xObjects, 3, portMAX_DELAY );
+ *
+ *          if( pxReady == &( xObjects[ 0 ] ) )
+ *          {
+ *              if( xQueueReceive( xCommandQueue, &xCommand, 0 ) == pdPASS )
+ *              {
+ *                  // Process the command.
+ *              }
+ *          }
+ *          else if( pxReady == &( xObjects[ 1 ] ) )
+ *          {
+ *              // Read and clear the link bits.
+ *          }
+ *          else if( pxReady == &( xObjects[ 2 ] ) )
+ *          {
+ *              ulTaskNotifyTake( pdTRUE, 0 );
+ *          }
+ *      }
+ *  }
+ * @endcode
+ * \defgroup pxWaitAny pxWaitAny
+ * \ingroup WaitAny
+ */
+WaitAnyObject_t * pxWaitAny( WaitAnyObject_t * pxObjects,
+                             UBaseType_t uxObjectCount,
+                             TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/* Not public API functions. */
+
+/*
+ * The state shared by the WaitAnyObject_t structures of one call to
+ * pxWaitAny(), or of one executor (see executor.h).  Tasks waiting for any of
+ * the objects to become ready are held in xTaskWaiting.  If pxReadyFunction is
+ * NULL then the first object to become ready is recorded in pxReady, otherwise
+ * pxReadyFunction is called, from a critical section, for each object that
+ * becomes ready.
+ */
+typedef void ( * WaitAnyReadyFunction_t )( WaitAnyObject_t * pxObject );
+
+typedef struct WaitAnyContextDefinition
+{
+    List_t xTaskWaiting;                    /**< Holds the waiting task while it is blocked. */
+    WaitAnyObject_t * volatile pxReady;     /**< The first of the objects to be found ready, or NULL if none has been. */
+    WaitAnyReadyFunction_t pxReadyFunction; /**< Called for each object that becomes ready, or NULL. */
+} WaitAnyContext_t;
+
+/*
+ * Link pxObject into the object it describes on behalf of pxContext, and
+ * unlink it again.  xWaitAnyAddObject() returns pdTRUE if the object is already
+ * ready, in which case pxReadyFunction is not called.  Task notifications
+ * cannot be added this way.  Must be called from a critical section.
+ */
+BaseType_t xWaitAnyAddObject( WaitAnyContext_t * pxContext,
+                              WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+void vWaitAnyRemoveObject( WaitAnyContext_t * pxContext,
+                           WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by the kernel objects, from a critical section, when an object that
+ * the structures in pxObjects are linked into becomes ready.  uxEventBits holds
+ * the bits of an event group, and is ignored for other objects.  Returns pdTRUE
+ * if a task with a priority above that of the calling task was unblocked.
+ */
+BaseType_t xWaitAnyNotifyReady( WaitAnyObject_t * pxObjects,
+                                EventBits_t uxEventBits ) PRIVILEGED_FUNCTION;
+
+/*
+ * Link pxObject into, and unlink it from, the list of structures headed by
+ * *ppxList.  Called by the kernel objects from a critical section.
+ */
+void vWaitAnyLinkObject( WaitAnyObject_t ** ppxList,
+                         WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+void vWaitAnyUnlinkObject( WaitAnyObject_t ** ppxList,
+                           WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+
+/*
+ * Link pxObject into the object it describes, and unlink it again.  The add
+ * functions return pdTRUE if the object is already ready.  Called by
+ * pxWaitAny() from a critical section.
+ */
+BaseType_t xQueueAddToWaitAny( QueueHandle_t xQueue,
+                               WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+void vQueueRemoveFromWaitAny( QueueHandle_t xQueue,
+                              WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+
+#if ( configUSE_EVENT_GROUPS == 1 )
+    BaseType_t xEventGroupAddToWaitAny( EventGroupHandle_t xEventGroup,
+                                        WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+    void vEventGroupRemoveFromWaitAny( EventGroupHandle_t xEventGroup,
+                                       WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_STREAM_BUFFERS == 1 )
+    BaseType_t xStreamBufferAddToWaitAny( StreamBufferHandle_t xStreamBuffer,
+                                          WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+    void vStreamBufferRemoveFromWaitAny( StreamBufferHandle_t xStreamBuffer,
+                                         WaitAnyObject_t * pxObject ) PRIVILEGED_FUNCTION;
+#endif
+
+/* *INDENT-OFF* */
+#ifdef __cplusplus
+    }
+#endif
+/* *INDENT-ON* */
+
+#endif /* WAIT_ANY_H */
@@ -0,0 +1,579 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "light_mutex.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include light mutex functionality. This #if is closed at the very bottom
+ * of this file. If you want to include light mutexes then ensure
+ * configUSE_LIGHT_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+
+    #if ( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_RECURSIVE_MUTEXES != 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use light mutexes
+    #endif
+
+    #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+        #define lightmutexSET_MUTEX_WAITED_ON( pxMutex )    vTaskSetMutexWaitedOn( &( ( pxMutex )->xHolder ) )
+        #define lightmutexCLEAR_MUTEX_WAITED_ON()           vTaskSetMutexWaitedOn( NULL )
+    #else
+        #define lightmutexSET_MUTEX_WAITED_ON( pxMutex )
+        #define lightmutexCLEAR_MUTEX_WAITED_ON()
+    #endif
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define lightmutexYIELD_IF_USING_PREEMPTION()
+    #else
+        #define lightmutexYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+    typedef struct LightMutexDefinition
+    {
+        TaskHandle_t volatile xHolder;  /**< The handle of the task that holds the mutex, or NULL if the mutex is free.  Only updated by prvCompareAndSwapHolder() or from within a critical section. */
+        List_t xTasksWaitingToTake;     /**< List of tasks that are blocked waiting to take the mutex.  Stored in priority order. */
+        UBaseType_t uxCeilingPriority;  /**< The priority the holder is raised to when it takes the mutex, or lightmutexNO_PRIORITY_CEILING if the mutex uses priority inheritance. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the mutex is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } LightMutex_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Sets the holder of the mutex to xNewHolder if, and only if, the holder is
+ * currently xExpectedHolder.  Returns pdTRUE if the holder was updated.
+ */
+    static BaseType_t prvCompareAndSwapHolder( LightMutex_t * const pxMutex,
+                                               TaskHandle_t const xExpectedHolder,
+                                               TaskHandle_t const xNewHolder ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when the mutex could not be taken without blocking.  Waits in the
+ * Blocked state, with the holder inheriting the priority of the calling task if
+ * the mutex does not have a priority ceiling, until the mutex is taken or
+ * xTicksToWait expires.
+ */
+    static BaseType_t prvTakeBlocking( LightMutex_t * const pxMutex,
+                                       TaskHandle_t const xCurrentTask,
+                                       TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the priority of the highest priority task waiting to take the mutex,
+ * or tskIDLE_PRIORITY if no task is waiting.
+ */
+    static UBaseType_t prvGetHighestPriorityOfWaitingTasks( const LightMutex_t * const pxMutex ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        LightMutexHandle_t xLightMutexGenericCreateStatic( UBaseType_t uxCeilingPriority,
+                                                           StaticLightMutex_t * pxMutexBuffer )
+        {
+            LightMutex_t * pxMutex;
+
+            traceENTER_xLightMutexGenericCreateStatic( uxCeilingPriority, pxMutexBuffer );
+
+            /* A StaticLightMutex_t object must be provided. */
+            configASSERT( pxMutexBuffer );
+            configASSERT( ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) || ( uxCeilingPriority == lightmutexNO_PRIORITY_CEILING ) );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticLightMutex_t equals the size of the real
+                 * light mutex structure. */
+                volatile size_t xSize = sizeof( StaticLightMutex_t );
+                configASSERT( xSize == sizeof( LightMutex_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxMutex = ( LightMutex_t * ) pxMutexBuffer;
+
+            if( pxMutex != NULL )
+            {
+                pxMutex->xHolder = NULL;
+                vListInitialise( &( pxMutex->xTasksWaitingToTake ) );
+                pxMutex->uxCeilingPriority = uxCeilingPriority;
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note that
+                     * this mutex was created statically in case the mutex is later
+                     * deleted. */
+                    pxMutex->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+            }
+
+            traceRETURN_xLightMutexGenericCreateStatic( pxMutex );
+
+            return pxMutex;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        LightMutexHandle_t xLightMutexGenericCreate( UBaseType_t uxCeilingPriority )
+        {
+            LightMutex_t * pxMutex;
+
+            traceENTER_xLightMutexGenericCreate( uxCeilingPriority );
+
+            configASSERT( ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) || ( uxCeilingPriority == lightmutexNO_PRIORITY_CEILING ) );
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxMutex = ( LightMutex_t * ) pvPortMalloc( sizeof( LightMutex_t ) );
+
+            if( pxMutex != NULL )
+            {
+                pxMutex->xHolder = NULL;
+                vListInitialise( &( pxMutex->xTasksWaitingToTake ) );
+                pxMutex->uxCeilingPriority = uxCeilingPriority;
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note this
+                     * mutex was allocated dynamically in case the mutex is later
+                     * deleted. */
+                    pxMutex->ucStaticallyAllocated = pdFALSE;
+                }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+            }
+
+            traceRETURN_xLightMutexGenericCreate( pxMutex );
+
+            return pxMutex;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightMutexTake( LightMutexHandle_t xMutex,
+                                TickType_t xTicksToWait )
+    {
+        LightMutex_t * const pxMutex = xMutex;
+        TaskHandle_t xCurrentTask;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xLightMutexTake( xMutex, xTicksToWait );
+
+        configASSERT( pxMutex );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* The held count is incremented before the mutex is taken so the holder
+         * of the mutex is never seen holding no mutexes by a task that times out
+         * after inheriting the holder's priority. */
+        xCurrentTask = pvTaskIncrementMutexHeldCount();
+        configASSERT( xCurrentTask );
+
+        if( pxMutex->uxCeilingPriority != lightmutexNO_PRIORITY_CEILING )
+        {
+            /* The calling task is raised to the ceiling before it tries to take
+             * the mutex so it cannot be preempted by a task that uses the mutex
+             * between taking it and being raised. */
+            vTaskPriorityRaiseToCeiling( pxMutex->uxCeilingPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( prvCompareAndSwapHolder( pxMutex, NULL, xCurrentTask ) != pdFALSE )
+        {
+            /* The mutex was free, so was taken without entering the kernel. */
+            xReturn = pdPASS;
+        }
+        else
+        {
+            /* The mutex is held, so undo the increment.  The calling task still
+             * holds any mutex it inherited a priority through, so this can only
+             * restore its base priority if it was just raised to the ceiling of
+             * this mutex, in which case a task that became ready while it was
+             * raised may now have to run. */
+            if( xTaskDecrementMutexHeldCount() != pdFALSE )
+            {
+                lightmutexYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xTicksToWait != ( TickType_t ) 0 )
+            {
+                xReturn = prvTakeBlocking( pxMutex, xCurrentTask, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        traceRETURN_xLightMutexTake( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xLightMutexGive( LightMutexHandle_t xMutex )
+    {
+        LightMutex_t * const pxMutex = xMutex;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired;
+
+        traceENTER_xLightMutexGive( xMutex );
+
+        configASSERT( pxMutex );
+
+        if( prvCompareAndSwapHolder( pxMutex, xTaskGetCurrentTaskHandle(), NULL ) != pdFALSE )
+        {
+            xYieldRequired = xTaskDecrementMutexHeldCount();
+
+            /* A task that fails to take the mutex adds itself to the list of
+             * waiting tasks from within the same critical section in which it
+             * last saw the mutex held, so it is either already on the list or it
+             * will find the mutex free.  The kernel therefore only needs to be
+             * entered if the list is not empty. */
+            if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+            {
+                taskENTER_CRITICAL();
+                {
+                    if( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) == pdFALSE )
+                    {
+                        /* Unblock the highest priority waiting task, which will
+                         * then try to take the mutex again. */
+                        if( xTaskRemoveFromEventList( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE )
+                        {
+                            xYieldRequired = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xYieldRequired != pdFALSE )
+            {
+                lightmutexYIELD_IF_USING_PREEMPTION();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            /* The calling task is not the holder of the mutex. */
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xLightMutexGive( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xLightMutexGetHolder( LightMutexHandle_t xMutex )
+    {
+        const LightMutex_t * const pxMutex = xMutex;
+        TaskHandle_t xReturn;
+
+        traceENTER_xLightMutexGetHolder( xMutex );
+
+        configASSERT( pxMutex );
+
+        xReturn = pxMutex->xHolder;
+
+        traceRETURN_xLightMutexGetHolder( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vLightMutexDelete( LightMutexHandle_t xMutex )
+    {
+        LightMutex_t * const pxMutex = xMutex;
+
+        traceENTER_vLightMutexDelete( xMutex );
+
+        configASSERT( pxMutex );
+        configASSERT( pxMutex->xHolder == NULL );
+        configASSERT( listLIST_IS_EMPTY( &( pxMutex->xTasksWaitingToTake ) ) != pdFALSE );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The mutex can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxMutex );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The mutex could have been allocated statically or dynamically, so
+             * check before attempting to free the memory. */
+            if( pxMutex->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxMutex );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vLightMutexDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCompareAndSwapHolder( LightMutex_t * const pxMutex,
+                                               TaskHandle_t const xExpectedHolder,
+                                               TaskHandle_t const xNewHolder )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        #if ( ( configNUMBER_OF_CORES == 1 ) && defined( portCOMPARE_AND_SWAP_POINTER ) )
+        {
+            /* The port provides a lock free compare and swap.  With a single
+             * core the blocking path cannot run while the swap is in progress,
+             * as it runs from within a critical section, so the swap does not
+             * need to be serialised with it. */
+            if( portCOMPARE_AND_SWAP_POINTER( &( pxMutex->xHolder ), xExpectedHolder, xNewHolder ) != 0 )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* if ( ( configNUMBER_OF_CORES == 1 ) && defined( portCOMPARE_AND_SWAP_POINTER ) ) */
+        {
+            /* Otherwise the swap is made atomic with a critical section.  The
+             * interrupt masking used by atomic.h is not sufficient, as it only
+             * excludes the calling core, and on some ports, such as the Posix
+             * port, does not mask anything when called from a task.  With more
+             * than one core the critical section is also needed to ensure a task
+             * that gives the mutex sees any task that has just started waiting
+             * for it. */
+            taskENTER_CRITICAL();
+            {
+                if( pxMutex->xHolder == xExpectedHolder )
+                {
+                    pxMutex->xHolder = xNewHolder;
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif /* if ( ( configNUMBER_OF_CORES == 1 ) && defined( portCOMPARE_AND_SWAP_POINTER ) ) */
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvTakeBlocking( LightMutex_t * const pxMutex,
+                                       TaskHandle_t const xCurrentTask,
+                                       TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xExitLoop = pdFALSE;
+        BaseType_t xShouldBlock;
+        BaseType_t xAlreadyYielded;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* Light mutexes are not recursive, so a task that tries to take a mutex
+         * it already holds would wait forever. */
+        configASSERT( pxMutex->xHolder != xCurrentTask );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( xExitLoop == pdFALSE )
+        {
+            xShouldBlock = pdFALSE;
+
+            vTaskSuspendAll();
+            {
+                /* The holder can only release the mutex by compare and swap or
+                 * from within a critical section, so checking the holder and
+                 * joining the list of waiting tasks must be atomic. */
+                taskENTER_CRITICAL();
+                {
+                    if( pxMutex->xHolder == NULL )
+                    {
+                        pxMutex->xHolder = xCurrentTask;
+                        ( void ) pvTaskIncrementMutexHeldCount();
+
+                        if( pxMutex->uxCeilingPriority != lightmutexNO_PRIORITY_CEILING )
+                        {
+                            vTaskPriorityRaiseToCeiling( pxMutex->uxCeilingPriority );
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        xReturn = pdPASS;
+                        xExitLoop = pdTRUE;
+                    }
+                    else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+                    {
+                        xExitLoop = pdTRUE;
+                    }
+                    else
+                    {
+                        lightmutexSET_MUTEX_WAITED_ON( pxMutex );
+
+                        /* The holder of a mutex with a priority ceiling already
+                         * runs at or above the priority of every task that uses
+                         * the mutex, so there is nothing to inherit. */
+                        if( pxMutex->uxCeilingPriority != lightmutexNO_PRIORITY_CEILING )
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                        else if( xTaskPriorityInherit( pxMutex->xHolder ) != pdFALSE )
+                        {
+                            xInheritanceOccurred = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        vTaskPlaceOnEventList( &( pxMutex->xTasksWaitingToTake ), xTicksToWait );
+                        xShouldBlock = pdTRUE;
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            xAlreadyYielded = xTaskResumeAll();
+
+            if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        lightmutexCLEAR_MUTEX_WAITED_ON();
+
+        if( ( xReturn == pdFAIL ) && ( xInheritanceOccurred != pdFALSE ) )
+        {
+            /* The holder inherited the priority of this task, so it may now have
+             * to drop back to the priority of the highest priority task that is
+             * still waiting. */
+            taskENTER_CRITICAL();
+            {
+                uxHighestPriorityOfWaitingTasks = prvGetHighestPriorityOfWaitingTasks( pxMutex );
+                vTaskPriorityDisinheritAfterTimeout( pxMutex->xHolder, uxHighestPriorityOfWaitingTasks );
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetHighestPriorityOfWaitingTasks( const LightMutex_t * const pxMutex )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* The waiting tasks are held in priority order, so the first task in
+         * the list has the highest priority. */
+        if( listCURRENT_LIST_LENGTH( &( pxMutex->xTasksWaitingToTake ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxMutex->xTasksWaitingToTake ) ) );
+        }
+        else
+        {
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include light mutex functionality. If you want to include light mutexes
+ * then ensure configUSE_LIGHT_MUTEXES is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_LIGHT_MUTEXES == 1 */
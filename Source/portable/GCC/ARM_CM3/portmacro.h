@@ -256,6 +256,14 @@ portFORCE_INLINE static void vPortSetBASEPRI( uint32_t ulNewMaskValue )
 
 #define portMEMORY_BARRIER()    __asm volatile ( "" ::: "memory" )
 
+/* Lock free compare and swap of a pointer, implemented with LDREX/STREX and
+ * used by light mutexes. */
+#define portCOMPARE_AND_SWAP_POINTER( ppvDestination, pvComparand, pvExchange )    __sync_bool_compare_and_swap( ( ppvDestination ), ( pvComparand ), ( pvExchange ) )
+
+/* As portCOMPARE_AND_SWAP_POINTER(), but for a size_t.  Used by multi producer
+ * stream buffers. */
+#define portCOMPARE_AND_SWAP_SIZE( pxDestination, xComparand, xExchange )          __sync_bool_compare_and_swap( ( pxDestination ), ( xComparand ), ( xExchange ) )
+
 /* *INDENT-OFF* */
 #ifdef __cplusplus
     }
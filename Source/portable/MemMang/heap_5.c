@@ -117,6 +117,19 @@
 #define heapALLOCATE_BLOCK( pxBlock )            ( ( pxBlock->xBlockSize ) |= heapBLOCK_ALLOCATED_BITMASK )
 #define heapFREE_BLOCK( pxBlock )                ( ( pxBlock->xBlockSize ) &= ~heapBLOCK_ALLOCATED_BITMASK )
 
+/* Blocks smaller than ( 32 << n ) bytes are counted in histogram bucket n. */
+#define heapHISTOGRAM_FIRST_BUCKET_SHIFT    ( 5U )
+
+/* Hooks used to keep the free block statistics up to date when
+ * configHEAP_INCREMENTAL_STATS is 1. */
+#if ( configHEAP_INCREMENTAL_STATS == 1 )
+    #define heapSTATS_FREE_BLOCK_ADDED( pxBlock )      prvFreeBlockAdded( pxBlock )
+    #define heapSTATS_FREE_BLOCK_REMOVED( pxBlock )    prvFreeBlockRemoved( pxBlock )
+#else
+    #define heapSTATS_FREE_BLOCK_ADDED( pxBlock )
+    #define heapSTATS_FREE_BLOCK_REMOVED( pxBlock )
+#endif
+
 /* Setting configENABLE_HEAP_PROTECTOR to 1 enables heap block pointers
  * protection using an application supplied canary value to catch heap
  * corruption should a heap buffer overflow occur.
@@ -161,6 +174,23 @@ typedef struct A_BLOCK_LINK
     size_t xBlockSize;                     /**< The size of the free block. */
 } BlockLink_t;
 
+#if ( configHEAP_INCREMENTAL_STATS == 1 )
+
+/* Links the free blocks in each histogram bucket in order of size.  It is
+ * held in the free block itself, just after its BlockLink_t, so it costs
+ * nothing while the block is allocated. */
+    typedef struct A_SIZE_LINK
+    {
+        BlockLink_t * pxNextBySize;     /**< The next free block in the bucket, which is no smaller than this one. */
+        BlockLink_t * pxPreviousBySize; /**< The previous free block in the bucket, which is no larger than this one. */
+    } SizeLink_t;
+
+/* The void cast is used to prevent byte alignment warnings from the compiler.
+ * xHeapStructSize is a multiple of portBYTE_ALIGNMENT. */
+    #define heapSIZE_LINK( pxBlock )    ( ( SizeLink_t * ) ( void * ) ( ( ( uint8_t * ) ( pxBlock ) ) + xHeapStructSize ) )
+
+#endif /* configHEAP_INCREMENTAL_STATS */
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -172,6 +202,23 @@ typedef struct A_BLOCK_LINK
 static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) PRIVILEGED_FUNCTION;
 void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) PRIVILEGED_FUNCTION;
 
+#if ( configHEAP_INCREMENTAL_STATS == 1 )
+
+/*
+ * Update the free block statistics when pxBlock is added to, or removed from,
+ * the list of free blocks.  pxBlock must not change size while it is free.
+ */
+    static void prvFreeBlockAdded( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+    static void prvFreeBlockRemoved( BlockLink_t * pxBlock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the index of the histogram bucket that counts blocks of xBlockSize
+ * bytes.
+ */
+    static size_t prvHistogramBucket( size_t xBlockSize ) PRIVILEGED_FUNCTION;
+
+#endif /* configHEAP_INCREMENTAL_STATS */
+
 #if ( configENABLE_HEAP_PROTECTOR == 1 )
 
 /**
@@ -199,6 +246,20 @@ PRIVILEGED_DATA static size_t xMinimumEverFreeBytesRemaining = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulAllocations = ( size_t ) 0U;
 PRIVILEGED_DATA static size_t xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
+#if ( configHEAP_INCREMENTAL_STATS == 1 )
+
+/* Free block statistics that are updated as blocks enter and leave the list of
+ * free blocks, so vPortGetHeapStats() does not have to walk the list.  The free
+ * blocks in each histogram bucket are also linked in order of size, so the
+ * smallest free block is the first in the lowest bucket that is not empty, and
+ * the largest is the last in the highest bucket that is not empty. */
+    PRIVILEGED_DATA static size_t xNumberOfFreeBlocks = ( size_t ) 0U;
+    PRIVILEGED_DATA static size_t xFreeBlockHistogram[ configHEAP_HISTOGRAM_BUCKETS ];
+    PRIVILEGED_DATA static BlockLink_t * pxSmallestFreeBlockInBucket[ configHEAP_HISTOGRAM_BUCKETS ];
+    PRIVILEGED_DATA static BlockLink_t * pxLargestFreeBlockInBucket[ configHEAP_HISTOGRAM_BUCKETS ];
+
+#endif /* configHEAP_INCREMENTAL_STATS */
+
 #if ( configENABLE_HEAP_PROTECTOR == 1 )
 
 /* Canary value for protecting internal heap pointers. */
@@ -258,6 +319,21 @@ void * pvPortMalloc( size_t xWantedSize )
         {
             xWantedSize = 0;
         }
+
+        #if ( configHEAP_INCREMENTAL_STATS == 1 )
+        {
+            /* The block must be large enough to hold a SizeLink_t after its
+             * BlockLink_t once it is freed. */
+            if( ( xWantedSize > 0 ) && ( xWantedSize < heapMINIMUM_BLOCK_SIZE ) )
+            {
+                xWantedSize = heapMINIMUM_BLOCK_SIZE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
     }
     else
     {
@@ -299,6 +375,7 @@ void * pvPortMalloc( size_t xWantedSize )
                     /* This block is being returned for use so must be taken out
                      * of the list of free blocks. */
                     pxPreviousBlock->pxNextFreeBlock = pxBlock->pxNextFreeBlock;
+                    heapSTATS_FREE_BLOCK_REMOVED( pxBlock );
 
                     /* If the block is larger than required it can be split into
                      * two. */
@@ -321,6 +398,7 @@ void * pvPortMalloc( size_t xWantedSize )
                         /* Insert the new block into the list of free blocks. */
                         pxNewBlockLink->pxNextFreeBlock = pxPreviousBlock->pxNextFreeBlock;
                         pxPreviousBlock->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxNewBlockLink );
+                        heapSTATS_FREE_BLOCK_ADDED( pxNewBlockLink );
                     }
                     else
                     {
@@ -505,6 +583,7 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVI
 
     if( ( puc + pxIterator->xBlockSize ) == ( uint8_t * ) pxBlockToInsert )
     {
+        heapSTATS_FREE_BLOCK_REMOVED( pxIterator );
         pxIterator->xBlockSize += pxBlockToInsert->xBlockSize;
         pxBlockToInsert = pxIterator;
     }
@@ -521,7 +600,22 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVI
     {
         if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) != pxEnd )
         {
-            /* Form one big block from the two blocks. */
+            /* Form one big block from the two blocks.  The next block is the
+             * zero sized end marker of a region if the block being inserted is
+             * the last in that region, and end markers are not counted in the
+             * free block statistics. */
+            #if ( configHEAP_INCREMENTAL_STATS == 1 )
+            {
+                if( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->xBlockSize != 0 )
+                {
+                    heapSTATS_FREE_BLOCK_REMOVED( heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
             pxBlockToInsert->xBlockSize += heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->xBlockSize;
             pxBlockToInsert->pxNextFreeBlock = heapPROTECT_BLOCK_POINTER( pxIterator->pxNextFreeBlock )->pxNextFreeBlock;
         }
@@ -547,6 +641,8 @@ static void prvInsertBlockIntoFreeList( BlockLink_t * pxBlockToInsert ) /* PRIVI
     {
         mtCOVERAGE_TEST_MARKER();
     }
+
+    heapSTATS_FREE_BLOCK_ADDED( pxBlockToInsert );
 }
 /*-----------------------------------------------------------*/
 
@@ -645,6 +741,7 @@ void vPortDefineHeapRegions( const HeapRegion_t * const pxHeapRegions ) /* PRIVI
         }
 
         xTotalHeapSize += pxFirstFreeBlockInRegion->xBlockSize;
+        heapSTATS_FREE_BLOCK_ADDED( pxFirstFreeBlockInRegion );
 
         #if ( configENABLE_HEAP_PROTECTOR == 1 )
         {
@@ -674,6 +771,40 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
     BlockLink_t * pxBlock;
     size_t xBlocks = 0, xMaxSize = 0, xMinSize = SIZE_MAX;
 
+    #if ( configHEAP_INCREMENTAL_STATS == 1 )
+    {
+        size_t xBucket;
+
+        /* The free block statistics are kept up to date by pvPortMalloc() and
+         * vPortFree(), so the list of free blocks is never walked.  The time
+         * taken depends only on configHEAP_HISTOGRAM_BUCKETS. */
+        ( void ) pxBlock;
+
+        vTaskSuspendAll();
+        {
+            xBlocks = xNumberOfFreeBlocks;
+
+            for( xBucket = 0; xBucket < ( size_t ) configHEAP_HISTOGRAM_BUCKETS; xBucket++ )
+            {
+                if( pxSmallestFreeBlockInBucket[ xBucket ] != NULL )
+                {
+                    xMinSize = pxSmallestFreeBlockInBucket[ xBucket ]->xBlockSize;
+                    break;
+                }
+            }
+
+            for( xBucket = ( size_t ) configHEAP_HISTOGRAM_BUCKETS; xBucket > 0; xBucket-- )
+            {
+                if( pxLargestFreeBlockInBucket[ xBucket - 1 ] != NULL )
+                {
+                    xMaxSize = pxLargestFreeBlockInBucket[ xBucket - 1 ]->xBlockSize;
+                    break;
+                }
+            }
+        }
+        ( void ) xTaskResumeAll();
+    }
+    #else /* if ( configHEAP_INCREMENTAL_STATS == 1 ) */
     vTaskSuspendAll();
     {
         pxBlock = heapPROTECT_BLOCK_POINTER( xStart.pxNextFreeBlock );
@@ -711,6 +842,7 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
         }
     }
     ( void ) xTaskResumeAll();
+    #endif /* if ( configHEAP_INCREMENTAL_STATS == 1 ) */
 
     pxHeapStats->xSizeOfLargestFreeBlockInBytes = xMaxSize;
     pxHeapStats->xSizeOfSmallestFreeBlockInBytes = xMinSize;
@@ -727,6 +859,115 @@ void vPortGetHeapStats( HeapStats_t * pxHeapStats )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configHEAP_INCREMENTAL_STATS == 1 )
+
+    static void prvFreeBlockAdded( BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        const size_t xBucket = prvHistogramBucket( pxBlock->xBlockSize );
+        BlockLink_t * pxPrevious = pxLargestFreeBlockInBucket[ xBucket ];
+        BlockLink_t * pxNext = NULL;
+
+        configASSERT( sizeof( SizeLink_t ) <= xHeapStructSize );
+        configASSERT( pxBlock->xBlockSize >= heapMINIMUM_BLOCK_SIZE );
+
+        xNumberOfFreeBlocks++;
+        xFreeBlockHistogram[ xBucket ]++;
+
+        /* Find the block's place in its bucket, starting from the largest
+         * block, as the remainder of a block that is split by pvPortMalloc()
+         * is often the largest.  Only the blocks in the same bucket are
+         * visited. */
+        while( ( pxPrevious != NULL ) && ( pxPrevious->xBlockSize > pxBlock->xBlockSize ) )
+        {
+            pxNext = pxPrevious;
+            pxPrevious = heapPROTECT_BLOCK_POINTER( heapSIZE_LINK( pxPrevious )->pxPreviousBySize );
+        }
+
+        heapSIZE_LINK( pxBlock )->pxPreviousBySize = heapPROTECT_BLOCK_POINTER( pxPrevious );
+        heapSIZE_LINK( pxBlock )->pxNextBySize = heapPROTECT_BLOCK_POINTER( pxNext );
+
+        if( pxPrevious == NULL )
+        {
+            pxSmallestFreeBlockInBucket[ xBucket ] = pxBlock;
+        }
+        else
+        {
+            heapSIZE_LINK( pxPrevious )->pxNextBySize = heapPROTECT_BLOCK_POINTER( pxBlock );
+        }
+
+        if( pxNext == NULL )
+        {
+            pxLargestFreeBlockInBucket[ xBucket ] = pxBlock;
+        }
+        else
+        {
+            heapSIZE_LINK( pxNext )->pxPreviousBySize = heapPROTECT_BLOCK_POINTER( pxBlock );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvFreeBlockRemoved( BlockLink_t * pxBlock ) /* PRIVILEGED_FUNCTION */
+    {
+        const size_t xBucket = prvHistogramBucket( pxBlock->xBlockSize );
+        BlockLink_t * const pxPrevious = heapPROTECT_BLOCK_POINTER( heapSIZE_LINK( pxBlock )->pxPreviousBySize );
+        BlockLink_t * const pxNext = heapPROTECT_BLOCK_POINTER( heapSIZE_LINK( pxBlock )->pxNextBySize );
+
+        configASSERT( xNumberOfFreeBlocks > 0 );
+        configASSERT( xFreeBlockHistogram[ xBucket ] > 0 );
+
+        xNumberOfFreeBlocks--;
+        xFreeBlockHistogram[ xBucket ]--;
+
+        if( pxPrevious == NULL )
+        {
+            configASSERT( pxSmallestFreeBlockInBucket[ xBucket ] == pxBlock );
+            pxSmallestFreeBlockInBucket[ xBucket ] = pxNext;
+        }
+        else
+        {
+            heapSIZE_LINK( pxPrevious )->pxNextBySize = heapPROTECT_BLOCK_POINTER( pxNext );
+        }
+
+        if( pxNext == NULL )
+        {
+            configASSERT( pxLargestFreeBlockInBucket[ xBucket ] == pxBlock );
+            pxLargestFreeBlockInBucket[ xBucket ] = pxPrevious;
+        }
+        else
+        {
+            heapSIZE_LINK( pxNext )->pxPreviousBySize = heapPROTECT_BLOCK_POINTER( pxPrevious );
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static size_t prvHistogramBucket( size_t xBlockSize ) /* PRIVILEGED_FUNCTION */
+    {
+        size_t xBucket = 0;
+
+        xBlockSize >>= heapHISTOGRAM_FIRST_BUCKET_SHIFT;
+
+        while( ( xBlockSize != 0 ) && ( xBucket < ( size_t ) ( configHEAP_HISTOGRAM_BUCKETS - 1 ) ) )
+        {
+            xBlockSize >>= 1;
+            xBucket++;
+        }
+
+        return xBucket;
+    }
+/*-----------------------------------------------------------*/
+
+    void vPortGetHeapHistogram( HeapHistogram_t * pxHeapHistogram )
+    {
+        taskENTER_CRITICAL();
+        {
+            ( void ) memcpy( pxHeapHistogram->xFreeBlocksInBucket, xFreeBlockHistogram, sizeof( xFreeBlockHistogram ) );
+        }
+        taskEXIT_CRITICAL();
+    }
+/*-----------------------------------------------------------*/
+
+#endif /* configHEAP_INCREMENTAL_STATS */
+
 /*
  * Reset the state in this file. This state is normally initialized at start up.
  * This function must be called by the application before restarting the
@@ -741,6 +982,15 @@ void vPortHeapResetState( void )
     xNumberOfSuccessfulAllocations = ( size_t ) 0U;
     xNumberOfSuccessfulFrees = ( size_t ) 0U;
 
+    #if ( configHEAP_INCREMENTAL_STATS == 1 )
+    {
+        xNumberOfFreeBlocks = ( size_t ) 0U;
+        ( void ) memset( xFreeBlockHistogram, 0, sizeof( xFreeBlockHistogram ) );
+        ( void ) memset( pxSmallestFreeBlockInBucket, 0, sizeof( pxSmallestFreeBlockInBucket ) );
+        ( void ) memset( pxLargestFreeBlockInBucket, 0, sizeof( pxLargestFreeBlockInBucket ) );
+    }
+    #endif
+
     #if ( configENABLE_HEAP_PROTECTOR == 1 )
         pucHeapHighAddress = NULL;
         pucHeapLowAddress = NULL;
@@ -140,6 +140,13 @@ extern void vPortCancelThread( void * pxTaskToDelete );
  */
 #define portMEMORY_BARRIER()                        __asm volatile ( "" ::: "memory" )
 
+/* Lock free compare and swap of a pointer, used by light mutexes. */
+#define portCOMPARE_AND_SWAP_POINTER( ppvDestination, pvComparand, pvExchange )    __sync_bool_compare_and_swap( ( ppvDestination ), ( pvComparand ), ( pvExchange ) )
+
+/* Lock free compare and swap of a size_t, used by multi producer stream
+ * buffers. */
+#define portCOMPARE_AND_SWAP_SIZE( pxDestination, xComparand, xExchange )          __sync_bool_compare_and_swap( ( pxDestination ), ( xComparand ), ( xExchange ) )
+
 extern uint32_t ulPortGetRunTime( void );
 #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()    /* no-op */
 #define portGET_RUN_TIME_COUNTER_VALUE()            ulPortGetRunTime()
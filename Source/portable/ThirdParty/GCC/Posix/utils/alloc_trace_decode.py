@@ -0,0 +1,123 @@
+#!/usr/bin/env python3
+#
+# FreeRTOS Kernel V11.3.0
+# Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+#
+# SPDX-License-Identifier: MIT
+#
+# Permission is hereby granted, free of charge, to any person obtaining a copy of
+# this software and associated documentation files (the "Software"), to deal in
+# the Software without restriction, including without limitation the rights to
+# use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+# the Software, and to permit persons to whom the Software is furnished to do so,
+# subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in all
+# copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+# FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+# COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+# IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+# CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+#
+# https://www.FreeRTOS.org
+# https://github.com/FreeRTOS
+#
+
+"""
+Decodes the output of vAllocTraceReport() from an application built for the
+Posix port, resolving each call site address to a function and source line.
+
+The first line of the report holds the run time address of the tracer's
+record table, which is compared with the address of the same symbol in the
+executable to undo the load address randomisation of position independent
+executables.
+
+Usage:
+    alloc_trace_decode.py <executable> [report file]
+
+The report is read from standard input if no report file is given.  Requires
+nm and addr2line from binutils.
+"""
+
+import re
+import subprocess
+import sys
+
+ANCHOR_SYMBOL = "xAllocTraceRecords"
+
+
+def symbol_address(executable, symbol):
+    """Returns the link time address of symbol in executable."""
+    output = subprocess.run(["nm", executable], check=True,
+                            capture_output=True, text=True).stdout
+
+    for line in output.splitlines():
+        fields = line.split()
+
+        if len(fields) == 3 and fields[2] == symbol:
+            return int(fields[0], 16)
+
+    raise SystemExit(f"{symbol} not found in {executable} - was it built with configUSE_ALLOC_TRACE set to 1?")
+
+
+def resolve(executable, addresses):
+    """Returns a 'function at file:line' string for each link time address."""
+    if not addresses:
+        return []
+
+    # Return addresses point after the call instruction, so look up the
+    # byte before to get the line of the call itself.
+    output = subprocess.run(["addr2line", "-f", "-C", "-s", "-e", executable] +
+                            [hex(address - 1) for address in addresses],
+                            check=True, capture_output=True, text=True).stdout
+    lines = output.splitlines()
+
+    return [f"{lines[i]} at {lines[i + 1]}" for i in range(0, len(lines), 2)]
+
+
+def main():
+    if len(sys.argv) not in (2, 3):
+        raise SystemExit(__doc__)
+
+    executable = sys.argv[1]
+
+    if len(sys.argv) == 3:
+        with open(sys.argv[2], encoding="ascii") as report_file:
+            report = report_file.read()
+    else:
+        report = sys.stdin.read()
+
+    lines = [line.strip() for line in report.splitlines() if line.strip()]
+    header = re.match(ANCHOR_SYMBOL + r"=(0x[0-9a-fA-F]+) dropped=(\d+)", lines[0]) if lines else None
+
+    if header is None:
+        raise SystemExit("The report does not start with the line written by vAllocTraceReport().")
+
+    slide = int(header.group(1), 16) - symbol_address(executable, ANCHOR_SYMBOL)
+    groups = []
+
+    for line in lines[1:]:
+        caller, task, name, count, size, oldest = line.split("\t")
+        caller = int(caller, 16) if caller not in ("(nil)", "0x0") else 0
+        groups.append((caller, task, name, int(count), int(size), int(oldest)))
+
+    # Largest owners first.
+    groups.sort(key=lambda group: group[4], reverse=True)
+    call_sites = resolve(executable, [group[0] - slide for group in groups if group[0] != 0])
+    call_sites.reverse()
+
+    print(f"{'bytes':>10} {'blocks':>7} {'oldest':>10}  {'task':<16} call site")
+
+    for caller, task, name, count, size, oldest in groups:
+        call_site = call_sites.pop() if caller != 0 else "unknown"
+        print(f"{size:>10} {count:>7} {oldest:>10}  {name + ' (' + task + ')':<16} {call_site}")
+
+    if int(header.group(2)) != 0:
+        print(f"\n{header.group(2)} allocations were not recorded - increase configALLOC_TRACE_MAX_RECORDS.")
+
+
+if __name__ == "__main__":
+    main()
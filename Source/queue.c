@@ -38,6 +38,10 @@
 #include "task.h"
 #include "queue.h"
 
+#if ( configUSE_WAIT_ANY == 1 )
+    #include "wait_any.h"
+#endif
+
 #if ( configUSE_CO_ROUTINES == 1 )
     #include "croutine.h"
 #endif
@@ -47,12 +51,32 @@
  * correct privileged Vs unprivileged linkage and placement. */
 #undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
 
+#if ( configUSE_SPSC_QUEUES == 1 )
+    #if ( configUSE_TASK_NOTIFICATIONS != 1 )
+        #error configUSE_TASK_NOTIFICATIONS must be set to 1 to use queues created with xQueueCreateSPSC()
+    #endif
+
+    #if ( INCLUDE_xTaskGetCurrentTaskHandle != 1 )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use queues created with xQueueCreateSPSC()
+    #endif
+#endif /* configUSE_SPSC_QUEUES */
 
 /* Constants used with the cRxLock and cTxLock structure members. */
 #define queueUNLOCKED             ( ( int8_t ) -1 )
 #define queueLOCKED_UNMODIFIED    ( ( int8_t ) 0 )
 #define queueINT8_MAX             ( ( int8_t ) 127 )
 
+/* Constants used with the ucCopyType structure member.  Items of one of the
+ * sizes below are copied with a memcpy() of constant length, which compilers
+ * replace with a single load and store, instead of a call to the library
+ * memcpy() with a length that is only known at run time.  Items of a pointer
+ * size take the path of the matching integer size. */
+#define queueCOPY_GENERIC         ( ( uint8_t ) 0U )
+#define queueCOPY_1_BYTE          ( ( uint8_t ) 1U )
+#define queueCOPY_2_BYTES         ( ( uint8_t ) 2U )
+#define queueCOPY_4_BYTES         ( ( uint8_t ) 3U )
+#define queueCOPY_8_BYTES         ( ( uint8_t ) 4U )
+
 /* When the Queue_t structure is used to represent a base queue its pcHead and
  * pcTail members are used as pointers into the queue storage area.  When the
  * Queue_t structure is used to represent a mutex pcHead and pcTail pointers are
@@ -82,6 +106,15 @@ typedef struct SemaphoreData
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH    ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME          ( ( TickType_t ) 0U )
 
+/* Single producer single consumer queues do not maintain uxMessagesWaiting, as
+ * it would have to be updated by both the producer and the consumer.  The
+ * number of items is instead derived from the read and write indexes. */
+#if ( configUSE_SPSC_QUEUES == 1 )
+    #define queueMESSAGES_WAITING( pxQueue )    ( ( ( pxQueue )->ucIsSPSC != ( uint8_t ) pdFALSE ) ? prvSPSCMessagesWaiting( pxQueue ) : ( pxQueue )->uxMessagesWaiting )
+#else
+    #define queueMESSAGES_WAITING( pxQueue )    ( ( pxQueue )->uxMessagesWaiting )
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -95,6 +128,16 @@ typedef struct SemaphoreData
     #endif /* #if ( configNUMBER_OF_CORES == 1 ) */
 #endif
 
+/* Record, and later forget, the mutex a task is blocked on so priority
+ * inheritance can follow a chain of blocked mutex holders. */
+#if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) )
+    #define queueSET_MUTEX_WAITED_ON( pxQueue )    vTaskSetMutexWaitedOn( &( ( pxQueue )->u.xSemaphore.xMutexHolder ) )
+    #define queueCLEAR_MUTEX_WAITED_ON()           vTaskSetMutexWaitedOn( NULL )
+#else
+    #define queueSET_MUTEX_WAITED_ON( pxQueue )
+    #define queueCLEAR_MUTEX_WAITED_ON()
+#endif
+
 /*
  * Definition of the queue used by the scheduler.
  * Items are queued by copy, not reference.  See the following link for the
@@ -111,8 +154,8 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
         SemaphoreData_t xSemaphore; /**< Data required exclusively when this structure is used as a semaphore. */
     } u;
 
-    List_t xTasksWaitingToSend;             /**< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order. */
-    List_t xTasksWaitingToReceive;          /**< List of tasks that are blocked waiting to read from this queue.  Stored in priority order. */
+    List_t xTasksWaitingToSend;             /**< List of tasks that are blocked waiting to post onto this queue.  Stored in priority order, or in the order the tasks blocked if ucFIFOWaiters is pdTRUE. */
+    List_t xTasksWaitingToReceive;          /**< List of tasks that are blocked waiting to read from this queue.  Stored in priority order, or in the order the tasks blocked if ucFIFOWaiters is pdTRUE. */
 
     volatile UBaseType_t uxMessagesWaiting; /**< The number of items currently in the queue. */
     UBaseType_t uxLength;                   /**< The length of the queue defined as the number of items it will hold, not the number of bytes. */
@@ -120,25 +163,50 @@ typedef struct QueueDefinition /* The old naming convention is used to prevent b
 
     volatile int8_t cRxLock;                /**< Stores the number of items received from the queue (removed from the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
     volatile int8_t cTxLock;                /**< Stores the number of items transmitted to the queue (added to the queue) while the queue was locked.  Set to queueUNLOCKED when the queue is not locked. */
+    uint8_t ucCopyType;                     /**< Selects how items are copied into and out of the queue storage area.  Set from uxItemSize when the queue is created. */
+    uint8_t ucFIFOWaiters;                  /**< Set to pdTRUE if tasks waiting to send or receive are woken in the order they started waiting instead of in priority order. */
 
     #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
         uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the memory used by the queue was statically allocated to ensure no attempt is made to free the memory. */
     #endif
 
     #if ( configUSE_QUEUE_SETS == 1 )
-        struct QueueDefinition * pxQueueSetContainer;
+        struct QueueDefinition * pxQueueSetContainer; /**< The queue set this queue is a member of, or NULL if it is not a member of a set. */
+        struct QueueDefinition * pxQueueSetNextReady; /**< Links the members of a queue set that may be ready into a circular list.  NULL if the queue is not in the list. */
+        struct QueueDefinition * pxQueueSetReadyTail; /**< Only used by queue sets.  The member most recently added to the list of members that may be ready, or NULL if the list is empty. */
     #endif
 
     #if ( configUSE_TRACE_FACILITY == 1 )
         UBaseType_t uxQueueNumber;
         uint8_t ucQueueType;
     #endif
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+        volatile UBaseType_t uxSPSCWriteIndex;          /**< The next slot to write when the structure is used as a single producer single consumer queue, in the range 0 to ( 2 * uxLength ) - 1.  Only updated by the producer. */
+        volatile UBaseType_t uxSPSCReadIndex;           /**< The next slot to read when the structure is used as a single producer single consumer queue, in the range 0 to ( 2 * uxLength ) - 1.  Only updated by the consumer. */
+        volatile TaskHandle_t xSPSCTaskWaitingToSend;    /**< Holds the handle of the producer if it is blocked waiting for space. */
+        volatile TaskHandle_t xSPSCTaskWaitingToReceive; /**< Holds the handle of the consumer if it is blocked waiting for data. */
+        uint8_t ucIsSPSC;                               /**< Set to pdTRUE if the queue was created as a single producer single consumer queue. */
+    #endif
+
+    #if ( configUSE_WAIT_ANY == 1 )
+        WaitAnyObject_t * pxWaitAnyObjects; /**< Chain of the pxWaitAny() calls that include this queue, or NULL if there are none. */
+    #endif
 } xQUEUE;
 
 /* The old xQUEUE name is maintained above then typedefed to the new Queue_t
  * name below to enable the use of older kernel aware debuggers. */
 typedef xQUEUE Queue_t;
 
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configQUEUE_ARENA_SIZE > 0 ) )
+
+/* The Queue_t structures of dynamically created queues, semaphores and mutexes
+ * are taken from this arena, and only from the heap once it is exhausted.  The
+ * storage area of a queue is then allocated from the heap separately. */
+    PRIVILEGED_DATA static Queue_t xQueueArenaStorage[ configQUEUE_ARENA_SIZE ];
+    PRIVILEGED_DATA static KernelObjectArena_t xQueueArena = { xQueueArenaStorage, sizeof( Queue_t ), ( UBaseType_t ) configQUEUE_ARENA_SIZE, ( UBaseType_t ) 0U, NULL };
+#endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -189,6 +257,56 @@ static void prvUnlockQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
  */
 static BaseType_t prvIsQueueEmpty( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
 
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+/*
+ * Frees the memory used by a dynamically allocated queue.
+ */
+    static void prvFreeQueue( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+/*
+ * The number of items in a single producer single consumer queue.  Can be
+ * called from either side of the queue without a critical section.
+ */
+    static UBaseType_t prvSPSCMessagesWaiting( const Queue_t * pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy an item into, or out of, a single producer single consumer queue if
+ * there is space, or data, respectively.  Only the producer may call
+ * prvSPSCWrite() and only the consumer may call prvSPSCRead().  If
+ * xJustPeeking is pdTRUE the item is left in the queue.
+ */
+    static BaseType_t prvSPSCWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvSPSCRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const BaseType_t xJustPeeking ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblock the task, if any, that is recorded in *pxWaitingTask.  Used by the
+ * producer to wake the consumer and by the consumer to wake the producer.
+ */
+    static void prvSPSCNotify( volatile TaskHandle_t * pxWaitingTask ) PRIVILEGED_FUNCTION;
+    static void prvSPSCNotifyFromISR( volatile TaskHandle_t * pxWaitingTask,
+                                      BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * The task level send and receive of a single producer single consumer queue,
+ * used in place of the body of xQueueGenericSend(), xQueueReceive() and
+ * xQueuePeek().
+ */
+    static BaseType_t prvSPSCSend( Queue_t * const pxQueue,
+                                   const void * const pvItemToQueue,
+                                   TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+    static BaseType_t prvSPSCReceive( Queue_t * const pxQueue,
+                                      void * const pvBuffer,
+                                      TickType_t xTicksToWait,
+                                      const BaseType_t xJustPeeking ) PRIVILEGED_FUNCTION;
+#endif /* configUSE_SPSC_QUEUES */
+
 /*
  * Uses a critical section to determine if there is any space in a queue.
  *
@@ -210,13 +328,46 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
 static void prvCopyDataFromQueue( Queue_t * const pxQueue,
                                   void * const pvBuffer ) PRIVILEGED_FUNCTION;
 
+/*
+ * Copies a single item of pxQueue->uxItemSize bytes, using the copy type
+ * selected when the queue was created.
+ */
+static void prvCopyItem( const Queue_t * const pxQueue,
+                         void * const pvDestination,
+                         const void * const pvSource ) PRIVILEGED_FUNCTION;
+
+/*
+ * Places the calling task on one of the event lists of pxQueue, in priority
+ * order or at the end of the list depending on how the queue was created.
+ * Must be called with the scheduler suspended and the queue locked.
+ */
+static void prvPlaceOnEventList( const Queue_t * const pxQueue,
+                                 List_t * const pxEventList,
+                                 const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 /*
- * Checks to see if a queue is a member of a queue set, and if so, notifies
- * the queue set that the queue contains data.
+ * Notifies the queue set that pxQueue is a member of that pxQueue contains
+ * data, by adding pxQueue to the set's list of members that may be ready if it
+ * is not already in it.  Must be called from a critical section.
+ */
+    static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the first member of pxQueueSet's ready list that contains data, or
+ * NULL if no members contain data.  Members that no longer contain data are
+ * removed from the list as they are found, and the member returned is moved to
+ * the end of the list so members are selected in turn.  Must be called from a
+ * critical section.
+ */
+    static Queue_t * prvSelectReadyMember( Queue_t * const pxQueueSet ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes pxQueue from the ready list of the queue set it is a member of, if
+ * it is in the list.  Must be called from a critical section.
  */
-    static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
+    static void prvRemoveReadyMember( Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
@@ -317,6 +468,33 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
     {
         taskENTER_CRITICAL();
         {
+            #if ( configUSE_QUEUE_SETS == 1 )
+            {
+                /* If the queue is a set, the count is the number of members
+                 * in its ready list, so the list must be emptied along with
+                 * the count.  The set fields are not initialised yet when a
+                 * new queue is reset. */
+                if( ( xNewQueue == pdFALSE ) && ( pxQueue->pxQueueSetReadyTail != NULL ) )
+                {
+                    Queue_t * pxMember = pxQueue->pxQueueSetReadyTail;
+                    Queue_t * pxNext;
+
+                    do
+                    {
+                        pxNext = pxMember->pxQueueSetNextReady;
+                        pxMember->pxQueueSetNextReady = NULL;
+                        pxMember = pxNext;
+                    } while( pxMember != pxQueue->pxQueueSetReadyTail );
+
+                    pxQueue->pxQueueSetReadyTail = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_QUEUE_SETS */
+
             pxQueue->u.xQueue.pcTail = pxQueue->pcHead + ( pxQueue->uxLength * pxQueue->uxItemSize );
             pxQueue->uxMessagesWaiting = ( UBaseType_t ) 0U;
             pxQueue->pcWriteTo = pxQueue->pcHead;
@@ -324,6 +502,25 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
             pxQueue->cRxLock = queueUNLOCKED;
             pxQueue->cTxLock = queueUNLOCKED;
 
+            #if ( configUSE_SPSC_QUEUES == 1 )
+            {
+                pxQueue->uxSPSCWriteIndex = ( UBaseType_t ) 0U;
+                pxQueue->uxSPSCReadIndex = ( UBaseType_t ) 0U;
+
+                if( xNewQueue != pdFALSE )
+                {
+                    pxQueue->xSPSCTaskWaitingToSend = NULL;
+                    pxQueue->xSPSCTaskWaitingToReceive = NULL;
+                }
+                else
+                {
+                    /* As below, a producer that was blocked because the queue
+                     * was full can now continue. */
+                    prvSPSCNotify( &( pxQueue->xSPSCTaskWaitingToSend ) );
+                }
+            }
+            #endif /* configUSE_SPSC_QUEUES */
+
             if( xNewQueue == pdFALSE )
             {
                 /* If there are tasks blocked waiting to read from the queue, then
@@ -523,17 +720,47 @@ BaseType_t xQueueGenericReset( QueueHandle_t xQueue,
              * zero in the case the queue is used as a semaphore. */
             xQueueSizeInBytes = ( size_t ) ( ( size_t ) uxQueueLength * ( size_t ) uxItemSize );
 
-            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
-            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-            /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+            #if ( configQUEUE_ARENA_SIZE > 0 )
+            {
+                /* Take the queue structure from the arena, then allocate the
+                 * storage area, if any, from the heap. */
+                pxNewQueue = ( Queue_t * ) pvTaskAllocateKernelObject( &xQueueArena );
+                pucQueueStorage = NULL;
+
+                if( ( pxNewQueue != NULL ) && ( xQueueSizeInBytes > ( size_t ) 0 ) )
+                {
+                    /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                    /* coverity[misra_c_2012_rule_11_5_violation] */
+                    pucQueueStorage = ( uint8_t * ) pvPortMalloc( xQueueSizeInBytes );
+
+                    if( pucQueueStorage == NULL )
+                    {
+                        vTaskFreeKernelObject( &xQueueArena, pxNewQueue );
+                        pxNewQueue = NULL;
+                    }
+                }
+            }
+            #else /* if ( configQUEUE_ARENA_SIZE > 0 ) */
+            {
+                /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                pxNewQueue = ( Queue_t * ) pvPortMalloc( sizeof( Queue_t ) + xQueueSizeInBytes );
+                pucQueueStorage = NULL;
+
+                if( pxNewQueue != NULL )
+                {
+                    /* Jump past the queue structure to find the location of the
+                     * queue storage area. */
+                    pucQueueStorage = ( uint8_t * ) pxNewQueue;
+                    pucQueueStorage += sizeof( Queue_t );
+                }
+            }
+            #endif /* if ( configQUEUE_ARENA_SIZE > 0 ) */
 
             if( pxNewQueue != NULL )
             {
-                /* Jump past the queue structure to find the location of the queue
-                 * storage area. */
-                pucQueueStorage = ( uint8_t * ) pxNewQueue;
-                pucQueueStorage += sizeof( Queue_t );
 
                 #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
                 {
@@ -594,6 +821,41 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
      * defined. */
     pxNewQueue->uxLength = uxQueueLength;
     pxNewQueue->uxItemSize = uxItemSize;
+
+    switch( uxItemSize )
+    {
+        case ( UBaseType_t ) 1:
+            pxNewQueue->ucCopyType = queueCOPY_1_BYTE;
+            break;
+
+        case ( UBaseType_t ) 2:
+            pxNewQueue->ucCopyType = queueCOPY_2_BYTES;
+            break;
+
+        case ( UBaseType_t ) 4:
+            pxNewQueue->ucCopyType = queueCOPY_4_BYTES;
+            break;
+
+        case ( UBaseType_t ) 8:
+            pxNewQueue->ucCopyType = queueCOPY_8_BYTES;
+            break;
+
+        default:
+            pxNewQueue->ucCopyType = queueCOPY_GENERIC;
+            break;
+    }
+
+    pxNewQueue->ucFIFOWaiters = ( ucQueueType == queueQUEUE_TYPE_FIFO_WAITERS ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        /* The indexes run to twice the queue length so a full queue can be
+         * told apart from an empty one. */
+        configASSERT( ( ucQueueType != queueQUEUE_TYPE_SPSC ) || ( ( uxItemSize > ( UBaseType_t ) 0 ) && ( uxQueueLength <= ( ( ( UBaseType_t ) ~( ( UBaseType_t ) 0U ) ) / ( UBaseType_t ) 2U ) ) ) );
+        pxNewQueue->ucIsSPSC = ( ucQueueType == queueQUEUE_TYPE_SPSC ) ? ( uint8_t ) pdTRUE : ( uint8_t ) pdFALSE;
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     ( void ) xQueueGenericReset( pxNewQueue, pdTRUE );
 
     #if ( configUSE_TRACE_FACILITY == 1 )
@@ -605,9 +867,17 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength,
     #if ( configUSE_QUEUE_SETS == 1 )
     {
         pxNewQueue->pxQueueSetContainer = NULL;
+        pxNewQueue->pxQueueSetNextReady = NULL;
+        pxNewQueue->pxQueueSetReadyTail = NULL;
     }
     #endif /* configUSE_QUEUE_SETS */
 
+    #if ( configUSE_WAIT_ANY == 1 )
+    {
+        pxNewQueue->pxWaitAnyObjects = NULL;
+    }
+    #endif /* configUSE_WAIT_ANY */
+
     traceQUEUE_CREATE( pxNewQueue );
 }
 /*-----------------------------------------------------------*/
@@ -966,6 +1236,24 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            BaseType_t xReturn;
+
+            /* Items can only be added to the back of the queue. */
+            configASSERT( xCopyPosition == queueSEND_TO_BACK );
+
+            xReturn = prvSPSCSend( pxQueue, pvItemToQueue, xTicksToWait );
+
+            traceRETURN_xQueueGenericSend( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -1074,6 +1362,28 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
                 }
                 #endif /* configUSE_QUEUE_SETS */
 
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    /* Tasks blocked in pxWaitAny() are not on the queue's
+                     * event lists, so are unblocked separately. */
+                    if( pxQueue->pxWaitAnyObjects != NULL )
+                    {
+                        if( xWaitAnyNotifyReady( pxQueue->pxWaitAnyObjects, ( EventBits_t ) 0 ) != pdFALSE )
+                        {
+                            queueYIELD_IF_USING_PREEMPTION();
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_WAIT_ANY */
+
                 taskEXIT_CRITICAL();
 
                 traceRETURN_xQueueGenericSend( pdPASS );
@@ -1123,7 +1433,7 @@ BaseType_t xQueueGenericSend( QueueHandle_t xQueue,
             if( prvIsQueueFull( pxQueue ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_SEND( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
+                prvPlaceOnEventList( pxQueue, &( pxQueue->xTasksWaitingToSend ), xTicksToWait );
 
                 /* Unlocking the queue means queue events can effect the
                  * event list. It is possible that interrupts occurring now
@@ -1194,6 +1504,31 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            configASSERT( xCopyPosition == queueSEND_TO_BACK );
+
+            if( prvSPSCWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                traceQUEUE_SEND_FROM_ISR( pxQueue );
+                prvSPSCNotifyFromISR( &( pxQueue->xSPSCTaskWaitingToReceive ), pxHigherPriorityTaskWoken );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_SEND_FROM_ISR_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+            }
+
+            traceRETURN_xQueueGenericSendFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     /* Similar to xQueueGenericSend, except without blocking if there is no room
      * in the queue.  Also don't directly wake a task that was blocked on a queue
      * read, instead return a flag to say whether a context switch is required or
@@ -1319,6 +1654,29 @@ BaseType_t xQueueGenericSendFromISR( QueueHandle_t xQueue,
                 prvIncrementQueueTxLock( pxQueue, cTxLock );
             }
 
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                /* Unlike the queue's event lists, the tasks blocked in
+                 * pxWaitAny() are only accessed from critical sections, so can
+                 * be unblocked even if the queue is locked. */
+                if( pxQueue->pxWaitAnyObjects != NULL )
+                {
+                    if( ( xWaitAnyNotifyReady( pxQueue->pxWaitAnyObjects, ( EventBits_t ) 0 ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_WAIT_ANY */
+
             xReturn = pdPASS;
         }
         else
@@ -1490,6 +1848,29 @@ BaseType_t xQueueGiveFromISR( QueueHandle_t xQueue,
                 prvIncrementQueueTxLock( pxQueue, cTxLock );
             }
 
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                /* Unlike the queue's event lists, the tasks blocked in
+                 * pxWaitAny() are only accessed from critical sections, so can
+                 * be unblocked even if the queue is locked. */
+                if( pxQueue->pxWaitAnyObjects != NULL )
+                {
+                    if( ( xWaitAnyNotifyReady( pxQueue->pxWaitAnyObjects, ( EventBits_t ) 0 ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_WAIT_ANY */
+
             xReturn = pdPASS;
         }
         else
@@ -1530,6 +1911,19 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            const BaseType_t xReturn = prvSPSCReceive( pxQueue, pvBuffer, xTicksToWait, pdFALSE );
+
+            traceRETURN_xQueueReceive( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -1613,7 +2007,7 @@ BaseType_t xQueueReceive( QueueHandle_t xQueue,
             if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvPlaceOnEventList( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 prvUnlockQueue( pxQueue );
 
                 if( xTaskResumeAll() == pdFALSE )
@@ -1708,6 +2102,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                         /* Record the information required to implement
                          * priority inheritance should it become necessary. */
                         pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+                        queueCLEAR_MUTEX_WAITED_ON();
                     }
                     else
                     {
@@ -1792,6 +2187,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                     {
                         taskENTER_CRITICAL();
                         {
+                            queueSET_MUTEX_WAITED_ON( pxQueue );
                             xInheritanceOccurred = xTaskPriorityInherit( pxQueue->u.xSemaphore.xMutexHolder );
                         }
                         taskEXIT_CRITICAL();
@@ -1803,7 +2199,7 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
                 }
                 #endif /* if ( configUSE_MUTEXES == 1 ) */
 
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvPlaceOnEventList( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 prvUnlockQueue( pxQueue );
 
                 if( xTaskResumeAll() == pdFALSE )
@@ -1837,6 +2233,8 @@ BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue,
             {
                 #if ( configUSE_MUTEXES == 1 )
                 {
+                    queueCLEAR_MUTEX_WAITED_ON();
+
                     /* xInheritanceOccurred could only have be set if
                      * pxQueue->uxQueueType == queueQUEUE_IS_MUTEX so no need to
                      * test the mutex type again to check it is actually a mutex. */
@@ -1903,6 +2301,19 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
     }
     #endif
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            const BaseType_t xReturn = prvSPSCReceive( pxQueue, pvBuffer, xTicksToWait, pdTRUE );
+
+            traceRETURN_xQueuePeek( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     for( ; ; )
     {
         taskENTER_CRITICAL();
@@ -1993,7 +2404,7 @@ BaseType_t xQueuePeek( QueueHandle_t xQueue,
             if( prvIsQueueEmpty( pxQueue ) != pdFALSE )
             {
                 traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
-                vTaskPlaceOnEventList( &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
+                prvPlaceOnEventList( pxQueue, &( pxQueue->xTasksWaitingToReceive ), xTicksToWait );
                 prvUnlockQueue( pxQueue );
 
                 if( xTaskResumeAll() == pdFALSE )
@@ -2065,6 +2476,29 @@ BaseType_t xQueueReceiveFromISR( QueueHandle_t xQueue,
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            if( prvSPSCRead( pxQueue, pvBuffer, pdFALSE ) != pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FROM_ISR( pxQueue );
+                prvSPSCNotifyFromISR( &( pxQueue->xSPSCTaskWaitingToSend ), pxHigherPriorityTaskWoken );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_RECEIVE_FROM_ISR_FAILED( pxQueue );
+                xReturn = pdFAIL;
+            }
+
+            traceRETURN_xQueueReceiveFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
@@ -2165,6 +2599,28 @@ BaseType_t xQueuePeekFromISR( QueueHandle_t xQueue,
      * link: https://www.FreeRTOS.org/RTOS-Cortex-M3-M4.html */
     portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
 
+    #if ( configUSE_SPSC_QUEUES == 1 )
+    {
+        if( pxQueue->ucIsSPSC != ( uint8_t ) pdFALSE )
+        {
+            if( prvSPSCRead( pxQueue, pvBuffer, pdTRUE ) != pdFALSE )
+            {
+                traceQUEUE_PEEK_FROM_ISR( pxQueue );
+                xReturn = pdPASS;
+            }
+            else
+            {
+                traceQUEUE_PEEK_FROM_ISR_FAILED( pxQueue );
+                xReturn = pdFAIL;
+            }
+
+            traceRETURN_xQueuePeekFromISR( xReturn );
+
+            return xReturn;
+        }
+    }
+    #endif /* configUSE_SPSC_QUEUES */
+
     /* MISRA Ref 4.7.1 [Return value shall be checked] */
     /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
     /* coverity[misra_c_2012_directive_4_7_violation] */
@@ -2207,7 +2663,7 @@ UBaseType_t uxQueueMessagesWaiting( const QueueHandle_t xQueue )
 
     portBASE_TYPE_ENTER_CRITICAL();
     {
-        uxReturn = ( ( Queue_t * ) xQueue )->uxMessagesWaiting;
+        uxReturn = queueMESSAGES_WAITING( ( Queue_t * ) xQueue );
     }
     portBASE_TYPE_EXIT_CRITICAL();
 
@@ -2228,7 +2684,7 @@ UBaseType_t uxQueueSpacesAvailable( const QueueHandle_t xQueue )
 
     portBASE_TYPE_ENTER_CRITICAL();
     {
-        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - pxQueue->uxMessagesWaiting );
+        uxReturn = ( UBaseType_t ) ( pxQueue->uxLength - queueMESSAGES_WAITING( pxQueue ) );
     }
     portBASE_TYPE_EXIT_CRITICAL();
 
@@ -2246,7 +2702,7 @@ UBaseType_t uxQueueMessagesWaitingFromISR( const QueueHandle_t xQueue )
     traceENTER_uxQueueMessagesWaitingFromISR( xQueue );
 
     configASSERT( pxQueue );
-    uxReturn = pxQueue->uxMessagesWaiting;
+    uxReturn = queueMESSAGES_WAITING( pxQueue );
 
     traceRETURN_uxQueueMessagesWaitingFromISR( uxReturn );
 
@@ -2263,6 +2719,32 @@ void vQueueDelete( QueueHandle_t xQueue )
     configASSERT( pxQueue );
     traceQUEUE_DELETE( pxQueue );
 
+    #if ( configUSE_WAIT_ANY == 1 )
+    {
+        /* A task must not be waiting on the queue in pxWaitAny(). */
+        configASSERT( pxQueue->pxWaitAnyObjects == NULL );
+    }
+    #endif
+
+    #if ( configUSE_QUEUE_SETS == 1 )
+    {
+        /* A member that still has data is linked into its set's ready list,
+         * which would otherwise be left pointing at freed memory. */
+        if( pxQueue->pxQueueSetContainer != NULL )
+        {
+            taskENTER_CRITICAL();
+            {
+                prvRemoveReadyMember( pxQueue );
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_QUEUE_SETS */
+
     #if ( configQUEUE_REGISTRY_SIZE > 0 )
     {
         vQueueUnregisterQueue( pxQueue );
@@ -2273,7 +2755,7 @@ void vQueueDelete( QueueHandle_t xQueue )
     {
         /* The queue can only have been allocated dynamically - free it
          * again. */
-        vPortFree( pxQueue );
+        prvFreeQueue( pxQueue );
     }
     #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
     {
@@ -2281,7 +2763,7 @@ void vQueueDelete( QueueHandle_t xQueue )
          * check before attempting to free the memory. */
         if( pxQueue->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
         {
-            vPortFree( pxQueue );
+            prvFreeQueue( pxQueue );
         }
         else
         {
@@ -2300,6 +2782,35 @@ void vQueueDelete( QueueHandle_t xQueue )
 }
 /*-----------------------------------------------------------*/
 
+#if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+    static void prvFreeQueue( Queue_t * const pxQueue )
+    {
+        #if ( configQUEUE_ARENA_SIZE > 0 )
+        {
+            /* The storage area was allocated separately from the queue
+             * structure.  Semaphores and mutexes do not have one. */
+            if( pxQueue->uxItemSize > ( UBaseType_t ) 0 )
+            {
+                vPortFree( pxQueue->pcHead );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vTaskFreeKernelObject( &xQueueArena, pxQueue );
+        }
+        #else
+        {
+            vPortFree( pxQueue );
+        }
+        #endif /* if ( configQUEUE_ARENA_SIZE > 0 ) */
+    }
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TRACE_FACILITY == 1 )
 
     UBaseType_t uxQueueGetQueueNumber( QueueHandle_t xQueue )
@@ -2420,7 +2931,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else if( xPosition == queueSEND_TO_BACK )
     {
-        ( void ) memcpy( ( void * ) pxQueue->pcWriteTo, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        prvCopyItem( pxQueue, ( void * ) pxQueue->pcWriteTo, pvItemToQueue );
         pxQueue->pcWriteTo += pxQueue->uxItemSize;
 
         if( pxQueue->pcWriteTo >= pxQueue->u.xQueue.pcTail )
@@ -2434,7 +2945,7 @@ static BaseType_t prvCopyDataToQueue( Queue_t * const pxQueue,
     }
     else
     {
-        ( void ) memcpy( ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue, ( size_t ) pxQueue->uxItemSize );
+        prvCopyItem( pxQueue, ( void * ) pxQueue->u.xQueue.pcReadFrom, pvItemToQueue );
         pxQueue->u.xQueue.pcReadFrom -= pxQueue->uxItemSize;
 
         if( pxQueue->u.xQueue.pcReadFrom < pxQueue->pcHead )
@@ -2489,14 +3000,66 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue,
             mtCOVERAGE_TEST_MARKER();
         }
 
-        ( void ) memcpy( ( void * ) pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom, ( size_t ) pxQueue->uxItemSize );
+        prvCopyItem( pxQueue, pvBuffer, ( void * ) pxQueue->u.xQueue.pcReadFrom );
     }
 }
 /*-----------------------------------------------------------*/
 
-static void prvUnlockQueue( Queue_t * const pxQueue )
+static void prvCopyItem( const Queue_t * const pxQueue,
+                         void * const pvDestination,
+                         const void * const pvSource )
 {
-    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
+    /* memcpy() is used on every path, rather than an assignment through a
+     * cast pointer, as neither the item buffer passed in by the application
+     * nor the queue storage area provided to xQueueCreateStatic() is
+     * guaranteed to be aligned. */
+    switch( pxQueue->ucCopyType )
+    {
+        case queueCOPY_1_BYTE:
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) 1U );
+            break;
+
+        case queueCOPY_2_BYTES:
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) 2U );
+            break;
+
+        case queueCOPY_4_BYTES:
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) 4U );
+            break;
+
+        case queueCOPY_8_BYTES:
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) 8U );
+            break;
+
+        default:
+            ( void ) memcpy( pvDestination, pvSource, ( size_t ) pxQueue->uxItemSize );
+            break;
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvPlaceOnEventList( const Queue_t * const pxQueue,
+                                 List_t * const pxEventList,
+                                 const TickType_t xTicksToWait )
+{
+    if( pxQueue->ucFIFOWaiters != ( uint8_t ) pdFALSE )
+    {
+        /* O(1) insertion, and the task that has waited longest is the first
+         * to be woken. */
+        vTaskPlaceOnFIFOEventList( pxEventList, xTicksToWait );
+    }
+    else
+    {
+        /* O(n) insertion, and the highest priority task is the first to be
+         * woken. */
+        vTaskPlaceOnEventList( pxEventList, xTicksToWait );
+    }
+}
+/*-----------------------------------------------------------*/
+
+static void prvUnlockQueue( Queue_t * const pxQueue )
+{
+    /* THIS FUNCTION MUST BE CALLED WITH THE SCHEDULER SUSPENDED. */
 
     /* The lock counts contains the number of extra data items placed or
      * removed from the queue while the queue was locked.  When a queue is
@@ -2644,7 +3207,7 @@ BaseType_t xQueueIsQueueEmptyFromISR( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    if( pxQueue->uxMessagesWaiting == ( UBaseType_t ) 0 )
+    if( queueMESSAGES_WAITING( pxQueue ) == ( UBaseType_t ) 0 )
     {
         xReturn = pdTRUE;
     }
@@ -2689,7 +3252,7 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
     configASSERT( pxQueue );
 
-    if( pxQueue->uxMessagesWaiting == pxQueue->uxLength )
+    if( queueMESSAGES_WAITING( pxQueue ) == pxQueue->uxLength )
     {
         xReturn = pdTRUE;
     }
@@ -3174,6 +3737,105 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 #endif /* configUSE_TIMERS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CONDITION_VARIABLES == 1 )
+
+    BaseType_t xQueueRequeueWaitingTasks( QueueHandle_t xMutex,
+                                          List_t * const pxEventList )
+    {
+        Queue_t * const pxMutex = xMutex;
+        ListItem_t * pxEventListItem;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xQueueRequeueWaitingTasks( xMutex, pxEventList );
+
+        configASSERT( pxMutex );
+        configASSERT( pxEventList );
+
+        /* This function should not be called by application code.  It is
+         * designed for use by condition variables, and must be called from a
+         * critical section.  The tasks in pxEventList are only moved if the
+         * mutex is held, as otherwise there is no give of the mutex that would
+         * unblock them. */
+        if( ( pxMutex->uxQueueType == queueQUEUE_IS_MUTEX ) && ( pxMutex->u.xSemaphore.xMutexHolder != NULL ) )
+        {
+            while( listLIST_IS_EMPTY( pxEventList ) == pdFALSE )
+            {
+                /* The event list item value still holds the priority of the
+                 * task, so the tasks remain in priority order. */
+                pxEventListItem = listGET_HEAD_ENTRY( pxEventList );
+                ( void ) uxListRemove( pxEventListItem );
+                vListInsert( &( pxMutex->xTasksWaitingToReceive ), pxEventListItem );
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xQueueRequeueWaitingTasks( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_CONDITION_VARIABLES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    BaseType_t xQueueAddToWaitAny( QueueHandle_t xQueue,
+                                   WaitAnyObject_t * pxObject )
+    {
+        Queue_t * const pxQueue = xQueue;
+        BaseType_t xReturn;
+
+        traceENTER_xQueueAddToWaitAny( xQueue, pxObject );
+
+        configASSERT( pxQueue );
+
+        #if ( configUSE_SPSC_QUEUES == 1 )
+        {
+            /* Single producer single consumer queues do not use critical
+             * sections, so cannot notify pxWaitAny(). */
+            configASSERT( pxQueue->ucIsSPSC == ( uint8_t ) pdFALSE );
+        }
+        #endif
+
+        /* This function should not be called by application code.  It is
+         * designed for use by pxWaitAny(), and must be called from a critical
+         * section. */
+        vWaitAnyLinkObject( &( pxQueue->pxWaitAnyObjects ), pxObject );
+        xReturn = ( pxQueue->uxMessagesWaiting > ( UBaseType_t ) 0U ) ? pdTRUE : pdFALSE;
+
+        traceRETURN_xQueueAddToWaitAny( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    void vQueueRemoveFromWaitAny( QueueHandle_t xQueue,
+                                  WaitAnyObject_t * pxObject )
+    {
+        Queue_t * const pxQueue = xQueue;
+
+        traceENTER_vQueueRemoveFromWaitAny( xQueue, pxObject );
+
+        configASSERT( pxQueue );
+
+        /* Must be called from a critical section. */
+        vWaitAnyUnlinkObject( &( pxQueue->pxWaitAnyObjects ), pxObject );
+
+        traceRETURN_vQueueRemoveFromWaitAny();
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
 #if ( ( configUSE_QUEUE_SETS == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
 
     QueueSetHandle_t xQueueCreateSet( const UBaseType_t uxEventQueueLength )
@@ -3182,7 +3844,9 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueCreateSet( uxEventQueueLength );
 
-        pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), queueQUEUE_TYPE_SET );
+        /* The members that are ready are linked through the members
+         * themselves, so the set does not need a storage area. */
+        pxQueue = xQueueGenericCreate( uxEventQueueLength, ( UBaseType_t ) 0U, queueQUEUE_TYPE_SET );
 
         traceRETURN_xQueueCreateSet( pxQueue );
 
@@ -3202,7 +3866,17 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueCreateSetStatic( uxEventQueueLength );
 
-        pxQueue = xQueueGenericCreateStatic( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), pucQueueStorage, pxStaticQueue, queueQUEUE_TYPE_SET );
+        /* The members that are ready are linked through the members
+         * themselves, so pucQueueStorage is not used, and may be NULL.  It is
+         * still accepted so existing applications need not change. */
+        if( pucQueueStorage == NULL )
+        {
+            pxQueue = xQueueGenericCreateStatic( uxEventQueueLength, ( UBaseType_t ) 0U, NULL, pxStaticQueue, queueQUEUE_TYPE_SET );
+        }
+        else
+        {
+            pxQueue = xQueueGenericCreateStatic( uxEventQueueLength, ( UBaseType_t ) sizeof( Queue_t * ), pucQueueStorage, pxStaticQueue, queueQUEUE_TYPE_SET );
+        }
 
         traceRETURN_xQueueCreateSetStatic( pxQueue );
 
@@ -3228,15 +3902,37 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
                 /* Cannot add a queue/semaphore to more than one queue set. */
                 xReturn = pdFAIL;
             }
-            else if( ( ( Queue_t * ) xQueueOrSemaphore )->uxMessagesWaiting != ( UBaseType_t ) 0 )
-            {
-                /* Cannot add a queue/semaphore to a queue set if there are already
-                 * items in the queue/semaphore. */
-                xReturn = pdFAIL;
-            }
+
+            #if ( configUSE_SPSC_QUEUES == 1 )
+                else if( ( ( Queue_t * ) xQueueOrSemaphore )->ucIsSPSC != ( uint8_t ) pdFALSE )
+                {
+                    /* Single producer single consumer queues do not notify
+                     * queue sets. */
+                    xReturn = pdFAIL;
+                }
+            #endif
             else
             {
                 ( ( Queue_t * ) xQueueOrSemaphore )->pxQueueSetContainer = xQueueSet;
+
+                /* A queue/semaphore that already contains data is ready as
+                 * soon as it is added. */
+                if( ( ( Queue_t * ) xQueueOrSemaphore )->uxMessagesWaiting != ( UBaseType_t ) 0 )
+                {
+                    if( prvNotifyQueueSetContainer( ( Queue_t * ) xQueueOrSemaphore ) != pdFALSE )
+                    {
+                        queueYIELD_IF_USING_PREEMPTION();
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
                 xReturn = pdPASS;
             }
         }
@@ -3260,28 +3956,25 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
         traceENTER_xQueueRemoveFromSet( xQueueOrSemaphore, xQueueSet );
 
-        if( pxQueueOrSemaphore->pxQueueSetContainer != xQueueSet )
-        {
-            /* The queue was not a member of the set. */
-            xReturn = pdFAIL;
-        }
-        else if( pxQueueOrSemaphore->uxMessagesWaiting != ( UBaseType_t ) 0 )
-        {
-            /* It is dangerous to remove a queue from a set when the queue is
-             * not empty because the queue set will still hold pending events for
-             * the queue. */
-            xReturn = pdFAIL;
-        }
-        else
+        taskENTER_CRITICAL();
         {
-            taskENTER_CRITICAL();
+            if( pxQueueOrSemaphore->pxQueueSetContainer != xQueueSet )
             {
+                /* The queue was not a member of the set. */
+                xReturn = pdFAIL;
+            }
+            else
+            {
+                /* The set must not reference the queue once it is no longer a
+                 * member, whether or not the queue is empty. */
+                prvRemoveReadyMember( pxQueueOrSemaphore );
+
                 /* The queue is no longer contained in the set. */
                 pxQueueOrSemaphore->pxQueueSetContainer = NULL;
+                xReturn = pdPASS;
             }
-            taskEXIT_CRITICAL();
-            xReturn = pdPASS;
         }
+        taskEXIT_CRITICAL();
 
         traceRETURN_xQueueRemoveFromSet( xReturn );
 
@@ -3296,11 +3989,86 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
     QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet,
                                                 TickType_t const xTicksToWait )
     {
+        Queue_t * const pxQueueSet = ( Queue_t * ) xQueueSet;
         QueueSetMemberHandle_t xReturn = NULL;
+        TimeOut_t xTimeOut;
+        TickType_t xTicksRemaining = xTicksToWait;
+        BaseType_t xShouldBlock = pdTRUE;
+        BaseType_t xAlreadyYielded;
 
         traceENTER_xQueueSelectFromSet( xQueueSet, xTicksToWait );
 
-        ( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait );
+        configASSERT( pxQueueSet );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* The set's ready list is only accessed from critical sections, so
+         * unlike a queue the set is never locked. */
+        taskENTER_CRITICAL();
+        {
+            xReturn = prvSelectReadyMember( pxQueueSet );
+        }
+        taskEXIT_CRITICAL();
+
+        if( ( xReturn == NULL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+        }
+        else
+        {
+            xShouldBlock = pdFALSE;
+        }
+
+        /* The task is placed on the set's event list from the same critical
+         * section that found the list empty, so a member that becomes ready
+         * from an interrupt cannot be missed. */
+        while( xShouldBlock != pdFALSE )
+        {
+            xShouldBlock = pdFALSE;
+
+            vTaskSuspendAll();
+            {
+                taskENTER_CRITICAL();
+                {
+                    xReturn = prvSelectReadyMember( pxQueueSet );
+
+                    if( ( xReturn == NULL ) && ( xTaskCheckForTimeOut( &xTimeOut, &xTicksRemaining ) == pdFALSE ) )
+                    {
+                        traceBLOCKING_ON_QUEUE_RECEIVE( pxQueueSet );
+                        vTaskPlaceOnEventList( &( pxQueueSet->xTasksWaitingToReceive ), xTicksRemaining );
+                        xShouldBlock = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            xAlreadyYielded = xTaskResumeAll();
+
+            if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xReturn != NULL )
+        {
+            traceQUEUE_RECEIVE( pxQueueSet );
+        }
+        else
+        {
+            traceQUEUE_RECEIVE_FAILED( pxQueueSet );
+        }
 
         traceRETURN_xQueueSelectFromSet( xReturn );
 
@@ -3314,11 +4082,18 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
     QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
     {
-        QueueSetMemberHandle_t xReturn = NULL;
+        QueueSetMemberHandle_t xReturn;
+        UBaseType_t uxSavedInterruptStatus;
 
         traceENTER_xQueueSelectFromSetFromISR( xQueueSet );
 
-        ( void ) xQueueReceiveFromISR( ( QueueHandle_t ) xQueueSet, &xReturn, NULL );
+        configASSERT( xQueueSet );
+
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            xReturn = prvSelectReadyMember( ( Queue_t * ) xQueueSet );
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
         traceRETURN_xQueueSelectFromSetFromISR( xReturn );
 
@@ -3330,9 +4105,10 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
 
 #if ( configUSE_QUEUE_SETS == 1 )
 
-    static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
+    static BaseType_t prvNotifyQueueSetContainer( Queue_t * const pxQueue )
     {
         Queue_t * pxQueueSetContainer = pxQueue->pxQueueSetContainer;
+        Queue_t * pxTail;
         BaseType_t xReturn = pdFALSE;
 
         /* This function must be called form a critical section. */
@@ -3341,49 +4117,496 @@ BaseType_t xQueueIsQueueFullFromISR( const QueueHandle_t xQueue )
          * to prvNotifyQueueSetContainer is preceded by a check that
          * pxQueueSetContainer != NULL */
         configASSERT( pxQueueSetContainer ); /* LCOV_EXCL_BR_LINE */
-        configASSERT( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength );
 
-        /* pxQueue->pxQueueSetContainer is verified to be non-null by caller. */
-        /* coverity[dereference] */
-        if( pxQueueSetContainer->uxMessagesWaiting < pxQueueSetContainer->uxLength )
+        /* A queue is only added to the ready list once however many items are
+         * posted to it, so the set cannot overflow. */
+        if( pxQueue->pxQueueSetNextReady == NULL )
         {
-            const int8_t cTxLock = pxQueueSetContainer->cTxLock;
-
             traceQUEUE_SET_SEND( pxQueueSetContainer );
 
-            /* The data copied is the handle of the queue that contains data. */
-            xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
+            /* pxQueue->pxQueueSetContainer is verified to be non-null by caller. */
+            /* coverity[dereference] */
+            pxTail = pxQueueSetContainer->pxQueueSetReadyTail;
 
-            if( cTxLock == queueUNLOCKED )
+            if( pxTail == NULL )
+            {
+                pxQueue->pxQueueSetNextReady = pxQueue;
+            }
+            else
             {
-                if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+                pxQueue->pxQueueSetNextReady = pxTail->pxQueueSetNextReady;
+                pxTail->pxQueueSetNextReady = pxQueue;
+            }
+
+            pxQueueSetContainer->pxQueueSetReadyTail = pxQueue;
+            pxQueueSetContainer->uxMessagesWaiting = ( UBaseType_t ) ( pxQueueSetContainer->uxMessagesWaiting + ( UBaseType_t ) 1U );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( listLIST_IS_EMPTY( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) == pdFALSE )
+        {
+            if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
+            {
+                /* The task waiting has a higher priority. */
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+    static Queue_t * prvSelectReadyMember( Queue_t * const pxQueueSet )
+    {
+        Queue_t * pxTail = pxQueueSet->pxQueueSetReadyTail;
+        Queue_t * pxMember = NULL;
+
+        while( ( pxTail != NULL ) && ( pxMember == NULL ) )
+        {
+            pxMember = pxTail->pxQueueSetNextReady;
+
+            if( pxMember->uxMessagesWaiting != ( UBaseType_t ) 0 )
+            {
+                /* Rotate the list so the member returned is the last to be
+                 * selected again, and members that are ready together are
+                 * selected in turn. */
+                pxQueueSet->pxQueueSetReadyTail = pxMember;
+            }
+            else
+            {
+                /* The member was read without first being selected, or was
+                 * selected and then read until empty.  Members are only removed
+                 * from the list here, so reading from a member does not have to
+                 * update the set. */
+                if( pxMember == pxTail )
                 {
-                    if( xTaskRemoveFromEventList( &( pxQueueSetContainer->xTasksWaitingToReceive ) ) != pdFALSE )
-                    {
-                        /* The task waiting has a higher priority. */
-                        xReturn = pdTRUE;
-                    }
-                    else
-                    {
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    pxQueueSet->pxQueueSetReadyTail = NULL;
+                }
+                else
+                {
+                    pxTail->pxQueueSetNextReady = pxMember->pxQueueSetNextReady;
+                }
+
+                pxMember->pxQueueSetNextReady = NULL;
+                pxQueueSet->uxMessagesWaiting = ( UBaseType_t ) ( pxQueueSet->uxMessagesWaiting - ( UBaseType_t ) 1U );
+
+                pxMember = NULL;
+                pxTail = pxQueueSet->pxQueueSetReadyTail;
+            }
+        }
+
+        return pxMember;
+    }
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_QUEUE_SETS == 1 )
+
+    static void prvRemoveReadyMember( Queue_t * const pxQueue )
+    {
+        Queue_t * const pxQueueSet = pxQueue->pxQueueSetContainer;
+        Queue_t * pxPrevious;
+
+        if( pxQueue->pxQueueSetNextReady != NULL )
+        {
+            /* The list is singly linked, so walk round it to find the member
+             * before pxQueue.  This is only done when a queue is removed from
+             * a set. */
+            pxPrevious = pxQueue;
+
+            while( pxPrevious->pxQueueSetNextReady != pxQueue )
+            {
+                pxPrevious = pxPrevious->pxQueueSetNextReady;
+            }
+
+            if( pxPrevious == pxQueue )
+            {
+                /* pxQueue was the only member in the list. */
+                pxQueueSet->pxQueueSetReadyTail = NULL;
+            }
+            else
+            {
+                pxPrevious->pxQueueSetNextReady = pxQueue->pxQueueSetNextReady;
+
+                if( pxQueueSet->pxQueueSetReadyTail == pxQueue )
+                {
+                    pxQueueSet->pxQueueSetReadyTail = pxPrevious;
                 }
                 else
                 {
                     mtCOVERAGE_TEST_MARKER();
                 }
             }
+
+            pxQueue->pxQueueSetNextReady = NULL;
+            pxQueueSet->uxMessagesWaiting = ( UBaseType_t ) ( pxQueueSet->uxMessagesWaiting - ( UBaseType_t ) 1U );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_SPSC_QUEUES == 1 )
+
+    static UBaseType_t prvSPSCMessagesWaiting( const Queue_t * pxQueue )
+    {
+        const UBaseType_t uxWriteIndex = pxQueue->uxSPSCWriteIndex;
+        const UBaseType_t uxReadIndex = pxQueue->uxSPSCReadIndex;
+        UBaseType_t uxReturn;
+
+        /* Both indexes run from 0 to ( 2 * uxLength ) - 1, so the write index
+         * is up to uxLength ahead of the read index, modulo 2 * uxLength. */
+        if( uxWriteIndex >= uxReadIndex )
+        {
+            uxReturn = ( UBaseType_t ) ( uxWriteIndex - uxReadIndex );
+        }
+        else
+        {
+            uxReturn = ( UBaseType_t ) ( ( ( pxQueue->uxLength * ( UBaseType_t ) 2U ) - uxReadIndex ) + uxWriteIndex );
+        }
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSPSCWrite( Queue_t * const pxQueue,
+                                    const void * pvItemToQueue )
+    {
+        UBaseType_t uxWriteIndex = pxQueue->uxSPSCWriteIndex;
+        UBaseType_t uxSlot;
+        BaseType_t xReturn;
+
+        if( prvSPSCMessagesWaiting( pxQueue ) < pxQueue->uxLength )
+        {
+            uxSlot = ( uxWriteIndex < pxQueue->uxLength ) ? uxWriteIndex : ( UBaseType_t ) ( uxWriteIndex - pxQueue->uxLength );
+            prvCopyItem( pxQueue, ( void * ) &( pxQueue->pcHead[ ( size_t ) uxSlot * ( size_t ) pxQueue->uxItemSize ] ), pvItemToQueue );
+
+            if( uxWriteIndex == ( ( pxQueue->uxLength * ( UBaseType_t ) 2U ) - ( UBaseType_t ) 1U ) )
+            {
+                uxWriteIndex = ( UBaseType_t ) 0U;
+            }
             else
             {
-                prvIncrementQueueTxLock( pxQueueSetContainer, cTxLock );
+                uxWriteIndex++;
             }
+
+            /* The item must be in the storage area before the consumer can see
+             * the new write index, and the new write index must be visible
+             * before the producer checks for a waiting consumer. */
+            portMEMORY_BARRIER();
+            pxQueue->uxSPSCWriteIndex = uxWriteIndex;
+            portMEMORY_BARRIER();
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSPSCRead( Queue_t * const pxQueue,
+                                   void * const pvBuffer,
+                                   const BaseType_t xJustPeeking )
+    {
+        UBaseType_t uxReadIndex = pxQueue->uxSPSCReadIndex;
+        UBaseType_t uxSlot;
+        BaseType_t xReturn;
+
+        if( prvSPSCMessagesWaiting( pxQueue ) > ( UBaseType_t ) 0 )
+        {
+            /* Do not read the item before the write index that says it is
+             * there. */
+            portMEMORY_BARRIER();
+
+            uxSlot = ( uxReadIndex < pxQueue->uxLength ) ? uxReadIndex : ( UBaseType_t ) ( uxReadIndex - pxQueue->uxLength );
+            prvCopyItem( pxQueue, pvBuffer, ( void * ) &( pxQueue->pcHead[ ( size_t ) uxSlot * ( size_t ) pxQueue->uxItemSize ] ) );
+
+            if( xJustPeeking == pdFALSE )
+            {
+                if( uxReadIndex == ( ( pxQueue->uxLength * ( UBaseType_t ) 2U ) - ( UBaseType_t ) 1U ) )
+                {
+                    uxReadIndex = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    uxReadIndex++;
+                }
+
+                /* As in prvSPSCWrite(), but the slot must have been read before
+                 * the producer can see it is free. */
+                portMEMORY_BARRIER();
+                pxQueue->uxSPSCReadIndex = uxReadIndex;
+                portMEMORY_BARRIER();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSPSCNotify( volatile TaskHandle_t * pxWaitingTask )
+    {
+        TaskHandle_t xWaitingTask;
+
+        /* Only enter a critical section if the other side of the queue looks
+         * like it is blocked, so the common case does not involve the kernel. */
+        if( *pxWaitingTask != NULL )
+        {
+            taskENTER_CRITICAL();
+            {
+                xWaitingTask = *pxWaitingTask;
+
+                if( xWaitingTask != NULL )
+                {
+                    *pxWaitingTask = NULL;
+                    ( void ) xTaskNotifyIndexed( xWaitingTask, configQUEUE_SPSC_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSPSCNotifyFromISR( volatile TaskHandle_t * pxWaitingTask,
+                                      BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        TaskHandle_t xWaitingTask;
+        UBaseType_t uxSavedInterruptStatus;
+
+        if( *pxWaitingTask != NULL )
+        {
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+            {
+                xWaitingTask = *pxWaitingTask;
+
+                if( xWaitingTask != NULL )
+                {
+                    *pxWaitingTask = NULL;
+                    ( void ) xTaskNotifyIndexedFromISR( xWaitingTask, configQUEUE_SPSC_NOTIFICATION_INDEX, ( uint32_t ) 0, eNoAction, pxHigherPriorityTaskWoken );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvSPSCSend( Queue_t * const pxQueue,
+                                   const void * const pvItemToQueue,
+                                   TickType_t xTicksToWait )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE, xReturn;
+        TimeOut_t xTimeOut;
+
+        for( ; ; )
+        {
+            if( prvSPSCWrite( pxQueue, pvItemToQueue ) != pdFALSE )
+            {
+                traceQUEUE_SEND( pxQueue );
+                prvSPSCNotify( &( pxQueue->xSPSCTaskWaitingToReceive ) );
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                traceQUEUE_SEND_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+                break;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                traceQUEUE_SEND_FAILED( pxQueue );
+                xReturn = errQUEUE_FULL;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Record this task as the waiting producer before checking the
+             * queue is still full, so a consumer that makes space after the
+             * check is guaranteed to see the handle and send a notification. */
+            taskENTER_CRITICAL();
+            {
+                ( void ) xTaskNotifyStateClearIndexed( NULL, configQUEUE_SPSC_NOTIFICATION_INDEX );
+                configASSERT( pxQueue->xSPSCTaskWaitingToSend == NULL );
+                pxQueue->xSPSCTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+            }
+            taskEXIT_CRITICAL();
+
+            portMEMORY_BARRIER();
+
+            if( prvSPSCMessagesWaiting( pxQueue ) == pxQueue->uxLength )
+            {
+                traceBLOCKING_ON_QUEUE_SEND( pxQueue );
+                ( void ) xTaskNotifyWaitIndexed( configQUEUE_SPSC_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->xSPSCTaskWaitingToSend = NULL;
+        }
 
         return xReturn;
     }
+/*-----------------------------------------------------------*/
 
-#endif /* configUSE_QUEUE_SETS */
+    static BaseType_t prvSPSCReceive( Queue_t * const pxQueue,
+                                      void * const pvBuffer,
+                                      TickType_t xTicksToWait,
+                                      const BaseType_t xJustPeeking )
+    {
+        BaseType_t xEntryTimeSet = pdFALSE, xReturn;
+        TimeOut_t xTimeOut;
+
+        for( ; ; )
+        {
+            if( prvSPSCRead( pxQueue, pvBuffer, xJustPeeking ) != pdFALSE )
+            {
+                if( xJustPeeking == pdFALSE )
+                {
+                    traceQUEUE_RECEIVE( pxQueue );
+                    prvSPSCNotify( &( pxQueue->xSPSCTaskWaitingToSend ) );
+                }
+                else
+                {
+                    traceQUEUE_PEEK( pxQueue );
+                }
+
+                xReturn = pdPASS;
+                break;
+            }
+
+            if( xTicksToWait == ( TickType_t ) 0 )
+            {
+                xReturn = errQUEUE_EMPTY;
+                break;
+            }
+            else if( xEntryTimeSet == pdFALSE )
+            {
+                vTaskSetTimeOutState( &xTimeOut );
+                xEntryTimeSet = pdTRUE;
+            }
+            else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+            {
+                xReturn = errQUEUE_EMPTY;
+                break;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* As in prvSPSCSend(). */
+            taskENTER_CRITICAL();
+            {
+                ( void ) xTaskNotifyStateClearIndexed( NULL, configQUEUE_SPSC_NOTIFICATION_INDEX );
+                configASSERT( pxQueue->xSPSCTaskWaitingToReceive == NULL );
+                pxQueue->xSPSCTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            taskEXIT_CRITICAL();
+
+            portMEMORY_BARRIER();
+
+            if( prvSPSCMessagesWaiting( pxQueue ) == ( UBaseType_t ) 0 )
+            {
+                if( xJustPeeking == pdFALSE )
+                {
+                    traceBLOCKING_ON_QUEUE_RECEIVE( pxQueue );
+                }
+                else
+                {
+                    traceBLOCKING_ON_QUEUE_PEEK( pxQueue );
+                }
+
+                ( void ) xTaskNotifyWaitIndexed( configQUEUE_SPSC_NOTIFICATION_INDEX, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxQueue->xSPSCTaskWaitingToReceive = NULL;
+        }
+
+        if( xReturn != pdPASS )
+        {
+            if( xJustPeeking == pdFALSE )
+            {
+                traceQUEUE_RECEIVE_FAILED( pxQueue );
+            }
+            else
+            {
+                traceQUEUE_PEEK_FAILED( pxQueue );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+
+#endif /* configUSE_SPSC_QUEUES */
@@ -0,0 +1,852 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rw_lock.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. This #if is closed at the very
+ * bottom of this file. If you want to include reader-writer locks then ensure
+ * configUSE_RW_LOCKS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_RW_LOCKS == 1 )
+
+    #if ( ( INCLUDE_xTaskGetCurrentTaskHandle != 1 ) && ( configUSE_RECURSIVE_MUTEXES != 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+        #error INCLUDE_xTaskGetCurrentTaskHandle must be set to 1 to use reader-writer locks
+    #endif
+
+    #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+        #define rwlockSET_MUTEX_WAITED_ON( pxLock )    vTaskSetMutexWaitedOn( &( ( pxLock )->xWriter ) )
+        #define rwlockCLEAR_MUTEX_WAITED_ON()          vTaskSetMutexWaitedOn( NULL )
+    #else
+        #define rwlockSET_MUTEX_WAITED_ON( pxLock )
+        #define rwlockCLEAR_MUTEX_WAITED_ON()
+    #endif
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define rwlockYIELD_IF_USING_PREEMPTION()
+    #else
+        #define rwlockYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+    typedef struct RWLockDefinition
+    {
+        UBaseType_t uxReaders;         /**< The number of tasks and interrupts that hold read access. */
+        TaskHandle_t volatile xWriter; /**< The task that holds write access, or NULL if no task holds write access. */
+        List_t xTasksWaitingToRead;    /**< List of tasks that are blocked waiting for read access.  Stored in priority order. */
+        List_t xTasksWaitingToWrite;   /**< List of tasks that are blocked waiting for write access.  Stored in priority order. */
+        UBaseType_t uxWritersWaiting;  /**< The number of tasks waiting for write access, including any that have been unblocked but have not yet taken it. */
+
+        #if ( ( configSUPPORT_STATIC_ALLOCATION == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+            uint8_t ucStaticallyAllocated; /**< Set to pdTRUE if the lock is statically allocated to ensure no attempt is made to free the memory. */
+        #endif
+    } RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialises the members of a newly allocated lock.
+ */
+    static void prvInitialiseNewRWLock( RWLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns pdTRUE if read access, or write access if xForWrite is pdTRUE, can
+ * be granted now.  Must be called from within a critical section.
+ */
+    static BaseType_t prvIsAvailable( const RWLock_t * const pxLock,
+                                      const BaseType_t xForWrite ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called when read or write access could not be taken without blocking.  Waits
+ * in the Blocked state until access is taken or xTicksToWait expires.
+ */
+    static BaseType_t prvAcquireBlocking( RWLock_t * const pxLock,
+                                          const BaseType_t xForWrite,
+                                          TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unblocks the highest priority task waiting for write access if there is one,
+ * otherwise all the tasks waiting for read access.  Must be called from within
+ * a critical section when no task holds write access.  Returns pdTRUE if an
+ * unblocked task has a priority above the priority of the calling task.
+ */
+    static BaseType_t prvUnblockWaitingTasks( RWLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the priority of the highest priority task waiting for write access,
+ * or tskIDLE_PRIORITY if no task is waiting.
+ */
+    static UBaseType_t prvGetHighestPriorityOfWaitingWriters( const RWLock_t * const pxLock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        RWLockHandle_t xRWLockCreateStatic( StaticRWLock_t * pxLockBuffer )
+        {
+            RWLock_t * pxLock;
+
+            traceENTER_xRWLockCreateStatic( pxLockBuffer );
+
+            /* A StaticRWLock_t object must be provided. */
+            configASSERT( pxLockBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticRWLock_t equals the size of the real
+                 * lock structure. */
+                volatile size_t xSize = sizeof( StaticRWLock_t );
+                configASSERT( xSize == sizeof( RWLock_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            /* MISRA Ref 11.3.1 [Misaligned access] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+            /* coverity[misra_c_2012_rule_11_3_violation] */
+            pxLock = ( RWLock_t * ) pxLockBuffer;
+
+            if( pxLock != NULL )
+            {
+                prvInitialiseNewRWLock( pxLock );
+
+                #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note that
+                     * this lock was created statically in case the lock is later
+                     * deleted. */
+                    pxLock->ucStaticallyAllocated = pdTRUE;
+                }
+                #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+            }
+
+            traceRETURN_xRWLockCreateStatic( pxLock );
+
+            return pxLock;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        RWLockHandle_t xRWLockCreate( void )
+        {
+            RWLock_t * pxLock;
+
+            traceENTER_xRWLockCreate();
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) );
+
+            if( pxLock != NULL )
+            {
+                prvInitialiseNewRWLock( pxLock );
+
+                #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+                {
+                    /* Both static and dynamic allocation can be used, so note this
+                     * lock was allocated dynamically in case the lock is later
+                     * deleted. */
+                    pxLock->ucStaticallyAllocated = pdFALSE;
+                }
+                #endif /* configSUPPORT_STATIC_ALLOCATION */
+            }
+
+            traceRETURN_xRWLockCreate( pxLock );
+
+            return pxLock;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockAcquireRead( RWLockHandle_t xLock,
+                                   TickType_t xTicksToWait )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xRWLockAcquireRead( xLock, xTicksToWait );
+
+        configASSERT( pxLock );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        /* Try without suspending the scheduler first, as read access is
+         * normally available. */
+        taskENTER_CRITICAL();
+        {
+            if( prvIsAvailable( pxLock, pdFALSE ) != pdFALSE )
+            {
+                ( pxLock->uxReaders )++;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( ( xReturn == pdFAIL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            xReturn = prvAcquireBlocking( pxLock, pdFALSE, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRWLockAcquireRead( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockAcquireReadFromISR( RWLockHandle_t xLock )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xRWLockAcquireReadFromISR( xLock );
+
+        configASSERT( pxLock );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum system call (or maximum API call) interrupt priority.
+         * Interrupts that are above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( prvIsAvailable( pxLock, pdFALSE ) != pdFALSE )
+            {
+                ( pxLock->uxReaders )++;
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xRWLockAcquireReadFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockReleaseRead( RWLockHandle_t xLock )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xRWLockReleaseRead( xLock );
+
+        configASSERT( pxLock );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxLock->uxReaders > ( UBaseType_t ) 0U )
+            {
+                ( pxLock->uxReaders )--;
+
+                /* Tasks waiting for read access only wait while a task is
+                 * waiting for write access, so only a writer can be waiting
+                 * for the last reader to finish.  The unblocked writer is
+                 * still counted in uxWritersWaiting, so new readers wait
+                 * behind it until it has taken write access or timed out. */
+                if( ( pxLock->uxReaders == ( UBaseType_t ) 0U ) &&
+                    ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+                {
+                    xYieldRequired = xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRWLockReleaseRead( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockReleaseReadFromISR( RWLockHandle_t xLock,
+                                          BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_xRWLockReleaseReadFromISR( xLock, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxLock );
+
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( pxLock->uxReaders > ( UBaseType_t ) 0U )
+            {
+                ( pxLock->uxReaders )--;
+
+                if( ( pxLock->uxReaders == ( UBaseType_t ) 0U ) &&
+                    ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE ) )
+                {
+                    if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE )
+                    {
+                        if( pxHigherPriorityTaskWoken != NULL )
+                        {
+                            *pxHigherPriorityTaskWoken = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        traceRETURN_xRWLockReleaseReadFromISR( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockAcquireWrite( RWLockHandle_t xLock,
+                                    TickType_t xTicksToWait )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xRWLockAcquireWrite( xLock, xTicksToWait );
+
+        configASSERT( pxLock );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        taskENTER_CRITICAL();
+        {
+            if( prvIsAvailable( pxLock, pdTRUE ) != pdFALSE )
+            {
+                /* Record the information required to implement priority
+                 * inheritance should it become necessary. */
+                pxLock->xWriter = pvTaskIncrementMutexHeldCount();
+                xReturn = pdPASS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( ( xReturn == pdFAIL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+        {
+            xReturn = prvAcquireBlocking( pxLock, pdTRUE, xTicksToWait );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRWLockAcquireWrite( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xRWLockReleaseWrite( RWLockHandle_t xLock )
+    {
+        RWLock_t * const pxLock = xLock;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_xRWLockReleaseWrite( xLock );
+
+        configASSERT( pxLock );
+
+        taskENTER_CRITICAL();
+        {
+            if( pxLock->xWriter == xTaskGetCurrentTaskHandle() )
+            {
+                /* Drop any priority inherited while holding write access. */
+                xYieldRequired = xTaskPriorityDisinherit( pxLock->xWriter );
+                pxLock->xWriter = NULL;
+
+                if( prvUnblockWaitingTasks( pxLock ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                xReturn = pdPASS;
+            }
+            else
+            {
+                /* The calling task does not hold write access. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            rwlockYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xRWLockReleaseWrite( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xRWLockGetWriter( RWLockHandle_t xLock )
+    {
+        const RWLock_t * const pxLock = xLock;
+        TaskHandle_t xReturn;
+
+        traceENTER_xRWLockGetWriter( xLock );
+
+        configASSERT( pxLock );
+
+        xReturn = pxLock->xWriter;
+
+        traceRETURN_xRWLockGetWriter( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    UBaseType_t uxRWLockGetReaderCount( RWLockHandle_t xLock )
+    {
+        const RWLock_t * const pxLock = xLock;
+        UBaseType_t uxReturn;
+
+        traceENTER_uxRWLockGetReaderCount( xLock );
+
+        configASSERT( pxLock );
+
+        uxReturn = pxLock->uxReaders;
+
+        traceRETURN_uxRWLockGetReaderCount( uxReturn );
+
+        return uxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vRWLockDelete( RWLockHandle_t xLock )
+    {
+        RWLock_t * const pxLock = xLock;
+
+        traceENTER_vRWLockDelete( xLock );
+
+        configASSERT( pxLock );
+        configASSERT( pxLock->xWriter == NULL );
+        configASSERT( pxLock->uxReaders == ( UBaseType_t ) 0U );
+        configASSERT( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToRead ) ) != pdFALSE );
+        configASSERT( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) != pdFALSE );
+        configASSERT( pxLock->uxWritersWaiting == ( UBaseType_t ) 0U );
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 0 ) )
+        {
+            /* The lock can only have been allocated dynamically - free it
+             * again. */
+            vPortFree( pxLock );
+        }
+        #elif ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
+        {
+            /* The lock could have been allocated statically or dynamically, so
+             * check before attempting to free the memory. */
+            if( pxLock->ucStaticallyAllocated == ( uint8_t ) pdFALSE )
+            {
+                vPortFree( pxLock );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+
+        traceRETURN_vRWLockDelete();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewRWLock( RWLock_t * const pxLock )
+    {
+        pxLock->uxReaders = ( UBaseType_t ) 0U;
+        pxLock->xWriter = NULL;
+        vListInitialise( &( pxLock->xTasksWaitingToRead ) );
+        vListInitialise( &( pxLock->xTasksWaitingToWrite ) );
+        pxLock->uxWritersWaiting = ( UBaseType_t ) 0U;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvIsAvailable( const RWLock_t * const pxLock,
+                                      const BaseType_t xForWrite )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        if( pxLock->xWriter == NULL )
+        {
+            if( xForWrite != pdFALSE )
+            {
+                if( pxLock->uxReaders == ( UBaseType_t ) 0U )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* Writers are preferred, so new readers wait behind any task
+                 * that is already waiting for write access.  A writer that has
+                 * been unblocked is no longer in xTasksWaitingToWrite but has
+                 * not yet taken write access, so the count of waiting writers
+                 * is used rather than the list. */
+                if( pxLock->uxWritersWaiting == ( UBaseType_t ) 0U )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAcquireBlocking( RWLock_t * const pxLock,
+                                          const BaseType_t xForWrite,
+                                          TickType_t xTicksToWait )
+    {
+        TimeOut_t xTimeOut;
+        BaseType_t xReturn = pdFAIL;
+        BaseType_t xExitLoop = pdFALSE;
+        BaseType_t xShouldBlock;
+        BaseType_t xAlreadyYielded;
+        BaseType_t xInheritanceOccurred = pdFALSE;
+        BaseType_t xYieldRequired = pdFALSE;
+        BaseType_t xCountedAsWaiting = pdFALSE;
+
+        /* Reader-writer locks are not recursive, so a task that tries to take a
+         * lock it holds for writing would wait forever. */
+        configASSERT( pxLock->xWriter != xTaskGetCurrentTaskHandle() );
+
+        vTaskSetTimeOutState( &xTimeOut );
+
+        while( xExitLoop == pdFALSE )
+        {
+            xShouldBlock = pdFALSE;
+
+            vTaskSuspendAll();
+            {
+                /* The lock is only released from within a critical section, so
+                 * checking the lock and joining the list of waiting tasks must
+                 * be atomic. */
+                taskENTER_CRITICAL();
+                {
+                    if( prvIsAvailable( pxLock, xForWrite ) != pdFALSE )
+                    {
+                        if( xForWrite != pdFALSE )
+                        {
+                            pxLock->xWriter = pvTaskIncrementMutexHeldCount();
+                        }
+                        else
+                        {
+                            ( pxLock->uxReaders )++;
+                        }
+
+                        xReturn = pdPASS;
+                        xExitLoop = pdTRUE;
+                    }
+                    else if( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE )
+                    {
+                        xExitLoop = pdTRUE;
+                    }
+                    else if( xForWrite != pdFALSE )
+                    {
+                        /* Readers wait behind this task from now until it
+                         * takes write access or times out. */
+                        if( xCountedAsWaiting == pdFALSE )
+                        {
+                            ( pxLock->uxWritersWaiting )++;
+                            xCountedAsWaiting = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        /* Only a writer can inherit a priority, as there may be
+                         * any number of readers. */
+                        rwlockSET_MUTEX_WAITED_ON( pxLock );
+
+                        if( xTaskPriorityInherit( pxLock->xWriter ) != pdFALSE )
+                        {
+                            xInheritanceOccurred = pdTRUE;
+                        }
+                        else
+                        {
+                            mtCOVERAGE_TEST_MARKER();
+                        }
+
+                        vTaskPlaceOnEventList( &( pxLock->xTasksWaitingToWrite ), xTicksToWait );
+                        xShouldBlock = pdTRUE;
+                    }
+                    else
+                    {
+                        vTaskPlaceOnEventList( &( pxLock->xTasksWaitingToRead ), xTicksToWait );
+                        xShouldBlock = pdTRUE;
+                    }
+
+                    if( ( xExitLoop != pdFALSE ) && ( xCountedAsWaiting != pdFALSE ) )
+                    {
+                        ( pxLock->uxWritersWaiting )--;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            xAlreadyYielded = xTaskResumeAll();
+
+            if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        if( xForWrite != pdFALSE )
+        {
+            rwlockCLEAR_MUTEX_WAITED_ON();
+
+            if( xReturn == pdFAIL )
+            {
+                taskENTER_CRITICAL();
+                {
+                    if( xInheritanceOccurred != pdFALSE )
+                    {
+                        /* The writer inherited the priority of this task, so
+                         * may now have to drop back to the priority of the
+                         * highest priority task that is still waiting. */
+                        vTaskPriorityDisinheritAfterTimeout( pxLock->xWriter, prvGetHighestPriorityOfWaitingWriters( pxLock ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+
+                    /* Readers may have been waiting only because this task was
+                     * waiting for write access.  This task may also have been
+                     * unblocked to take write access as it timed out, in which
+                     * case the next waiting writer must be unblocked instead. */
+                    if( ( pxLock->xWriter == NULL ) &&
+                        ( ( pxLock->uxWritersWaiting == ( UBaseType_t ) 0U ) ||
+                          ( ( pxLock->uxReaders == ( UBaseType_t ) 0U ) && ( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE ) ) ) )
+                    {
+                        xYieldRequired = prvUnblockWaitingTasks( pxLock );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                taskEXIT_CRITICAL();
+
+                if( xYieldRequired != pdFALSE )
+                {
+                    rwlockYIELD_IF_USING_PREEMPTION();
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvUnblockWaitingTasks( RWLock_t * const pxLock )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        if( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToWrite ) ) == pdFALSE )
+        {
+            /* The unblocked writer will try to take write access again. */
+            xReturn = xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToWrite ) );
+        }
+        else
+        {
+            /* All the waiting readers can take read access together. */
+            while( listLIST_IS_EMPTY( &( pxLock->xTasksWaitingToRead ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxLock->xTasksWaitingToRead ) ) != pdFALSE )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static UBaseType_t prvGetHighestPriorityOfWaitingWriters( const RWLock_t * const pxLock )
+    {
+        UBaseType_t uxHighestPriorityOfWaitingTasks;
+
+        /* The waiting tasks are held in priority order, so the first task in
+         * the list has the highest priority. */
+        if( listCURRENT_LIST_LENGTH( &( pxLock->xTasksWaitingToWrite ) ) > 0U )
+        {
+            uxHighestPriorityOfWaitingTasks = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( &( pxLock->xTasksWaitingToWrite ) ) );
+        }
+        else
+        {
+            uxHighestPriorityOfWaitingTasks = tskIDLE_PRIORITY;
+        }
+
+        return uxHighestPriorityOfWaitingTasks;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include reader-writer lock functionality. If you want to include
+ * reader-writer locks then ensure configUSE_RW_LOCKS is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_RW_LOCKS == 1 */
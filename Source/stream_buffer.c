@@ -39,6 +39,10 @@
 #include "task.h"
 #include "stream_buffer.h"
 
+#if ( configUSE_WAIT_ANY == 1 )
+    #include "wait_any.h"
+#endif
+
 /* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
  * for the header files above, but not in this file, in order to generate the
  * correct privileged Vs unprivileged linkage and placement. */
@@ -225,6 +229,34 @@
     #define sbFLAGS_IS_MESSAGE_BUFFER          ( ( uint8_t ) 1 ) /* Set if the stream buffer was created as a message buffer, in which case it holds discrete messages rather than a stream. */
     #define sbFLAGS_IS_STATICALLY_ALLOCATED    ( ( uint8_t ) 2 ) /* Set if the stream buffer was created using statically allocated memory. */
     #define sbFLAGS_IS_BATCHING_BUFFER         ( ( uint8_t ) 4 ) /* Set if the stream buffer was created as a batching buffer, meaning the receiver task will only unblock when the trigger level exceededs. */
+    #define sbFLAGS_IS_MULTI_PRODUCER          ( ( uint8_t ) 8 ) /* Set if the stream buffer was created for multiple concurrent writers. */
+
+/* The xClaim member of a multi producer stream buffer holds the index of the
+ * end of the space claimed by writers in its upper bits, and the number of
+ * writers that are still copying into the claimed space in its lower
+ * sbCLAIM_COUNT_BITS bits.  Holding both in one variable lets a writer claim
+ * space, and find out whether it is the last writer to finish, with a single
+ * compare and swap. */
+    #define sbCLAIM_COUNT_BITS                 ( 8U )
+    #define sbCLAIM_COUNT_MASK                 ( ( ( size_t ) 1U << sbCLAIM_COUNT_BITS ) - ( size_t ) 1U )
+    #define sbCLAIM_MAX_LENGTH                 ( ( ~( size_t ) 0U ) >> sbCLAIM_COUNT_BITS )
+
+/* A stream buffer cannot be reset while a writer is part way through writing
+ * to it, which can only be the case for a multi producer buffer. */
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        #define sbWRITERS_IN_PROGRESS( pxStreamBuffer )    ( ( ( ( pxStreamBuffer )->xClaim & sbCLAIM_COUNT_MASK ) != ( size_t ) 0 ) ? pdTRUE : pdFALSE )
+    #else
+        #define sbWRITERS_IN_PROGRESS( pxStreamBuffer )    ( pdFALSE )
+    #endif
+
+/* The number of bytes that must be in the buffer for a write to wake the
+ * reader.  While the reader is holding off to coalesce notifications that is
+ * the coalescing byte count rather than the trigger level. */
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        #define sbNOTIFY_LEVEL_BYTES( pxStreamBuffer )    ( ( ( pxStreamBuffer )->xCoalescing != pdFALSE ) ? ( pxStreamBuffer )->xCoalesceBytes : ( pxStreamBuffer )->xTriggerLevelBytes )
+    #else
+        #define sbNOTIFY_LEVEL_BYTES( pxStreamBuffer )    ( ( pxStreamBuffer )->xTriggerLevelBytes )
+    #endif
 
 /*-----------------------------------------------------------*/
 
@@ -249,6 +281,20 @@ typedef struct StreamBufferDef_t
         StreamBufferCallbackFunction_t pxReceiveCompletedCallback; /* Optional callback called on receive complete.  sbRECEIVE_COMPLETED is called if this is NULL. */
     #endif
     UBaseType_t uxNotificationIndex;                               /* The index we are using for notification, by default tskDEFAULT_INDEX_TO_NOTIFY. */
+
+    #if ( configUSE_WAIT_ANY == 1 )
+        WaitAnyObject_t * pxWaitAnyObjects; /* Chain of the pxWaitAny() calls that include this stream buffer, or NULL if there are none. */
+    #endif
+
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        volatile size_t xClaim; /* End of the space claimed by writers and the number of writers still copying, see sbCLAIM_COUNT_BITS.  Only used by multi producer buffers. */
+    #endif
+
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        size_t xCoalesceBytes;           /* The number of bytes that ends a coalescing wait early. */
+        TickType_t xCoalesceTicks;       /* The longest a woken reader holds off for, or 0 if coalescing is disabled. */
+        volatile BaseType_t xCoalescing; /* pdTRUE while the reader is holding off, in which case writes only wake it once xCoalesceBytes are available. */
+    #endif
 } StreamBuffer_t;
 
 /*
@@ -274,25 +320,44 @@ static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
 /*
  * If the stream buffer is being used as a message buffer, then reads an entire
- * message out of the buffer.  If the stream buffer is being used as a stream
+ * message out of the buffer, scattering it across the xVectorCount buffers
+ * described by pxVectors.  If the stream buffer is being used as a stream
  * buffer then read as many bytes as possible from the buffer.
  * prvReadBytesFromBuffer() is called to actually extract the bytes from the
  * buffer's data storage area.
  */
 static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                        void * pvRxData,
+                                        const StreamBufferRxVector_t * pxVectors,
+                                        size_t xVectorCount,
                                         size_t xBufferLengthBytes,
                                         size_t xBytesAvailable ) PRIVILEGED_FUNCTION;
 
+/*
+ * Reads as many whole messages out of a message buffer as fit in the
+ * xBufferLengthBytes bytes pointed to by pucRxData, up to a maximum of
+ * xMaxMessages, and writes the length of each to pxMessageLengths.  The tail
+ * is only updated once, after the last message has been read.  Returns the
+ * number of messages read, and their total length in *pxBytesRead.
+ */
+static size_t prvReadMessagesFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                         uint8_t * pucRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * pxMessageLengths,
+                                         size_t xMaxMessages,
+                                         size_t xBytesAvailable,
+                                         size_t * pxBytesRead ) PRIVILEGED_FUNCTION;
+
 /*
  * If the stream buffer is being used as a message buffer, then writes an entire
- * message to the buffer.  If the stream buffer is being used as a stream
+ * message, gathered from the xVectorCount fragments described by pxVectors, to
+ * the buffer.  If the stream buffer is being used as a stream
  * buffer then write as many bytes as possible to the buffer.
  * prvWriteBytestoBuffer() is called to actually send the bytes to the buffer's
  * data storage area.
  */
 static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                       const void * pvTxData,
+                                       const StreamBufferTxVector_t * pxVectors,
+                                       size_t xVectorCount,
                                        size_t xDataLengthBytes,
                                        size_t xSpace,
                                        size_t xRequiredSpace ) PRIVILEGED_FUNCTION;
@@ -314,6 +379,99 @@ static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
                                       size_t xCount,
                                       size_t xTail ) PRIVILEGED_FUNCTION;
 
+/*
+ * The bodies of the send and receive functions.  Each takes the data as an
+ * array of xVectorCount fragments with a total length of xDataLengthBytes or
+ * xBufferLengthBytes, so the same code serves xStreamBufferSend() and
+ * xStreamBufferSendV(), and so on.
+ */
+static size_t prvSendVectors( StreamBuffer_t * const pxStreamBuffer,
+                              const StreamBufferTxVector_t * pxVectors,
+                              size_t xVectorCount,
+                              size_t xDataLengthBytes,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvSendVectorsFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                     const StreamBufferTxVector_t * pxVectors,
+                                     size_t xVectorCount,
+                                     size_t xDataLengthBytes,
+                                     BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+static size_t prvReceiveVectors( StreamBuffer_t * const pxStreamBuffer,
+                                 const StreamBufferRxVector_t * pxVectors,
+                                 size_t xVectorCount,
+                                 size_t xBufferLengthBytes,
+                                 TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvReceiveVectorsFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferRxVector_t * pxVectors,
+                                        size_t xVectorCount,
+                                        size_t xBufferLengthBytes,
+                                        BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/*
+ * Used by the task level send and receive functions to block until at least
+ * xRequiredSpace bytes are free, or more than xBytesToStoreMessageLength bytes
+ * are available, or xTicksToWait expires.  Each returns the space or the bytes
+ * available at the time it returns.
+ */
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesToStoreMessageLength,
+                              TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by prvWaitForData() after the reader has been woken by the arrival of
+ * data in an empty buffer.  Blocks for up to xTicksToWait until the buffer
+ * holds at least the coalescing byte count, then returns the number of bytes
+ * available.
+ */
+#if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+    static size_t prvWaitForCoalescedData( StreamBuffer_t * const pxStreamBuffer,
+                                           TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+
+/*
+ * Used by the writers to a multi producer buffer.  prvClaimSpace() reserves
+ * xRequiredSpace bytes for a message, or up to xDataLengthBytes bytes for a
+ * stream, after the space already claimed by other writers.  It returns the
+ * number of bytes claimed, and sets *pxClaimStart to the index of the start of
+ * the claimed space.  prvReleaseClaim() is called once the claimed space has
+ * been written, and moves xHead over all the claimed space if no other writer
+ * is still copying into it.
+ */
+    static size_t prvClaimSpace( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 size_t xRequiredSpace,
+                                 size_t * const pxClaimStart ) PRIVILEGED_FUNCTION;
+    static void prvReleaseClaim( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Atomically sets *pxDestination to xExchange if it equals xComparand.
+ * Returns pdTRUE if it did.
+ */
+    static BaseType_t prvCompareAndSwapSize( size_t volatile * const pxDestination,
+                                             size_t xComparand,
+                                             size_t xExchange ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+
+/*
+ * Return the number of bytes that can be written at xHead, or read at xTail,
+ * without wrapping back to the start of the buffer.
+ */
+static size_t prvContiguousSpace( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+static size_t prvContiguousBytes( const StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the total length of the fragments described by pxVectors.
+ */
+static size_t prvTxVectorLength( const StreamBufferTxVector_t * pxVectors,
+                                 size_t xVectorCount ) PRIVILEGED_FUNCTION;
+static size_t prvRxVectorLength( const StreamBufferRxVector_t * pxVectors,
+                                 size_t xVectorCount ) PRIVILEGED_FUNCTION;
+
 /*
  * Called by both pxStreamBufferCreate() and pxStreamBufferCreateStatic() to
  * initialise the members of the newly created stream buffer structure.
@@ -326,6 +484,22 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
                                           StreamBufferCallbackFunction_t pxSendCompletedCallback,
                                           StreamBufferCallbackFunction_t pxReceiveCompletedCallback ) PRIVILEGED_FUNCTION;
 
+#if ( configUSE_WAIT_ANY == 1 )
+
+/*
+ * Unblocks the tasks that are waiting on the stream buffer in pxWaitAny().
+ * Called when the data in the buffer reaches the trigger level.
+ */
+    static void prvNotifyWaitAny( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+/*
+ * As prvNotifyWaitAny(), but for use from an interrupt.  Returns pdTRUE if a
+ * task was unblocked that has a priority above the interrupted task.
+ */
+    static BaseType_t prvNotifyWaitAnyFromISR( StreamBuffer_t * const pxStreamBuffer ) PRIVILEGED_FUNCTION;
+
+#endif /* configUSE_WAIT_ANY */
+
 /*-----------------------------------------------------------*/
     #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
     StreamBufferHandle_t xStreamBufferGenericCreate( size_t xBufferSizeBytes,
@@ -349,6 +523,26 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER;
             configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
         }
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+            else if( xStreamBufferType == sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER )
+            {
+                /* Is a multi producer message buffer but not statically
+                 * allocated.  The length must leave room for the writer count
+                 * in xClaim. */
+                ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER;
+                configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+                configASSERT( xBufferSizeBytes < sbCLAIM_MAX_LENGTH );
+            }
+            else if( xStreamBufferType == sbTYPE_MULTI_PRODUCER_STREAM_BUFFER )
+            {
+                /* Is a multi producer stream buffer but not statically
+                 * allocated. */
+                ucFlags = sbFLAGS_IS_MULTI_PRODUCER;
+                configASSERT( xBufferSizeBytes > 0 );
+                configASSERT( xBufferSizeBytes < sbCLAIM_MAX_LENGTH );
+            }
+        #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
         else if( xStreamBufferType == sbTYPE_STREAM_BATCHING_BUFFER )
         {
             /* Is a batching buffer but not statically allocated. */
@@ -463,6 +657,22 @@ static void prvInitialiseNewStreamBuffer( StreamBuffer_t * const pxStreamBuffer,
             ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_STATICALLY_ALLOCATED;
             configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
         }
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+            else if( xStreamBufferType == sbTYPE_MULTI_PRODUCER_MESSAGE_BUFFER )
+            {
+                /* Statically allocated multi producer message buffer. */
+                ucFlags = sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+                configASSERT( xBufferSizeBytes > sbBYTES_TO_STORE_MESSAGE_LENGTH );
+                configASSERT( xBufferSizeBytes <= sbCLAIM_MAX_LENGTH );
+            }
+            else if( xStreamBufferType == sbTYPE_MULTI_PRODUCER_STREAM_BUFFER )
+            {
+                /* Statically allocated multi producer stream buffer. */
+                ucFlags = sbFLAGS_IS_MULTI_PRODUCER | sbFLAGS_IS_STATICALLY_ALLOCATED;
+                configASSERT( xBufferSizeBytes <= sbCLAIM_MAX_LENGTH );
+            }
+        #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
         else if( xStreamBufferType == sbTYPE_STREAM_BATCHING_BUFFER )
         {
             /* Statically allocated batching buffer. */
@@ -562,6 +772,13 @@ void vStreamBufferDelete( StreamBufferHandle_t xStreamBuffer )
 
     configASSERT( pxStreamBuffer );
 
+    #if ( configUSE_WAIT_ANY == 1 )
+    {
+        /* A task must not be waiting on the stream buffer in pxWaitAny(). */
+        configASSERT( pxStreamBuffer->pxWaitAnyObjects == NULL );
+    }
+    #endif
+
     traceSTREAM_BUFFER_DELETE( xStreamBuffer );
 
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) pdFALSE )
@@ -601,6 +818,11 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        size_t xCoalesceBytes;
+        TickType_t xCoalesceTicks;
+    #endif
+
     traceENTER_xStreamBufferReset( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -616,7 +838,7 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
     /* Can only reset a message buffer if there are no tasks blocked on it. */
     taskENTER_CRITICAL();
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) && ( sbWRITERS_IN_PROGRESS( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -625,6 +847,15 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+            {
+                /* The coalescing policy is a setting, like the trigger level,
+                 * so survives the reset. */
+                xCoalesceBytes = pxStreamBuffer->xCoalesceBytes;
+                xCoalesceTicks = pxStreamBuffer->xCoalesceTicks;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -639,6 +870,13 @@ BaseType_t xStreamBufferReset( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+            {
+                pxStreamBuffer->xCoalesceBytes = xCoalesceBytes;
+                pxStreamBuffer->xCoalesceTicks = xCoalesceTicks;
+            }
+            #endif
+
             traceSTREAM_BUFFER_RESET( xStreamBuffer );
 
             xReturn = pdPASS;
@@ -663,6 +901,11 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
         UBaseType_t uxStreamBufferNumber;
     #endif
 
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        size_t xCoalesceBytes;
+        TickType_t xCoalesceTicks;
+    #endif
+
     traceENTER_xStreamBufferResetFromISR( xStreamBuffer );
 
     configASSERT( pxStreamBuffer );
@@ -681,7 +924,7 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
     /* coverity[misra_c_2012_directive_4_7_violation] */
     uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
     {
-        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) )
+        if( ( pxStreamBuffer->xTaskWaitingToReceive == NULL ) && ( pxStreamBuffer->xTaskWaitingToSend == NULL ) && ( sbWRITERS_IN_PROGRESS( pxStreamBuffer ) == pdFALSE ) )
         {
             #if ( configUSE_SB_COMPLETED_CALLBACK == 1 )
             {
@@ -690,6 +933,15 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+            {
+                /* The coalescing policy is a setting, like the trigger level,
+                 * so survives the reset. */
+                xCoalesceBytes = pxStreamBuffer->xCoalesceBytes;
+                xCoalesceTicks = pxStreamBuffer->xCoalesceTicks;
+            }
+            #endif
+
             prvInitialiseNewStreamBuffer( pxStreamBuffer,
                                           pxStreamBuffer->pucBuffer,
                                           pxStreamBuffer->xLength,
@@ -704,6 +956,13 @@ BaseType_t xStreamBufferResetFromISR( StreamBufferHandle_t xStreamBuffer )
             }
             #endif
 
+            #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+            {
+                pxStreamBuffer->xCoalesceBytes = xCoalesceBytes;
+                pxStreamBuffer->xCoalesceTicks = xCoalesceTicks;
+            }
+            #endif
+
             traceSTREAM_BUFFER_RESET_FROM_ISR( xStreamBuffer );
 
             xReturn = pdPASS;
@@ -751,6 +1010,54 @@ BaseType_t xStreamBufferSetTriggerLevel( StreamBufferHandle_t xStreamBuffer,
 }
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+
+    BaseType_t xStreamBufferSetNotificationCoalescing( StreamBufferHandle_t xStreamBuffer,
+                                                       size_t xCoalesceBytes,
+                                                       TickType_t xCoalesceTicks )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferSetNotificationCoalescing( xStreamBuffer, xCoalesceBytes, xCoalesceTicks );
+
+        configASSERT( pxStreamBuffer );
+
+        if( xCoalesceBytes < pxStreamBuffer->xLength )
+        {
+            /* A buffer never holds xLength bytes, so a byte count of 0 is
+             * stored as xLength to end the wait on time only. */
+            if( xCoalesceBytes == ( size_t ) 0 )
+            {
+                xCoalesceBytes = pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            taskENTER_CRITICAL();
+            {
+                pxStreamBuffer->xCoalesceBytes = xCoalesceBytes;
+                pxStreamBuffer->xCoalesceTicks = xCoalesceTicks;
+            }
+            taskEXIT_CRITICAL();
+
+            xReturn = pdPASS;
+        }
+        else
+        {
+            xReturn = pdFAIL;
+        }
+
+        traceRETURN_xStreamBufferSetNotificationCoalescing( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_STREAM_BUFFER_COALESCING */
+/*-----------------------------------------------------------*/
+
 size_t xStreamBufferSpacesAvailable( StreamBufferHandle_t xStreamBuffer )
 {
     const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
@@ -811,16 +1118,56 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
                           TickType_t xTicksToWait )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xSpace = 0;
-    size_t xRequiredSpace = xDataLengthBytes;
-    TimeOut_t xTimeOut;
-    size_t xMaxReportedSpace = 0;
+    StreamBufferTxVector_t xVector;
+    size_t xReturn;
 
     traceENTER_xStreamBufferSend( xStreamBuffer, pvTxData, xDataLengthBytes, xTicksToWait );
 
     configASSERT( pvTxData );
     configASSERT( pxStreamBuffer );
 
+    xVector.pvData = pvTxData;
+    xVector.xLength = xDataLengthBytes;
+
+    xReturn = prvSendVectors( pxStreamBuffer, &xVector, ( size_t ) 1, xDataLengthBytes, xTicksToWait );
+
+    traceRETURN_xStreamBufferSend( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendV( StreamBufferHandle_t xStreamBuffer,
+                           const StreamBufferTxVector_t * pxVectors,
+                           size_t xVectorCount,
+                           TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferSendV( xStreamBuffer, pxVectors, xVectorCount, xTicksToWait );
+
+    configASSERT( pxVectors );
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvSendVectors( pxStreamBuffer, pxVectors, xVectorCount, prvTxVectorLength( pxVectors, xVectorCount ), xTicksToWait );
+
+    traceRETURN_xStreamBufferSendV( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSendVectors( StreamBuffer_t * const pxStreamBuffer,
+                              const StreamBufferTxVector_t * pxVectors,
+                              size_t xVectorCount,
+                              size_t xDataLengthBytes,
+                              TickType_t xTicksToWait )
+{
+    size_t xReturn, xSpace;
+    size_t xRequiredSpace = xDataLengthBytes;
+    size_t xMaxReportedSpace = 0;
+
     /* The maximum amount of space a stream buffer will ever report is its length
      * minus 1. */
     xMaxReportedSpace = pxStreamBuffer->xLength - ( size_t ) 1;
@@ -864,64 +1211,39 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
         }
     }
 
-    if( xTicksToWait != ( TickType_t ) 0 )
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
     {
-        vTaskSetTimeOutState( &xTimeOut );
-
-        do
+        /* Only one task can wait for space, so writers to a multi producer
+         * buffer never block. */
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
         {
-            /* Wait until the required number of bytes are free in the message
-             * buffer. */
-            taskENTER_CRITICAL();
-            {
-                xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-
-                if( xSpace < xRequiredSpace )
-                {
-                    /* Clear notification state as going to wait for space. */
-                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
-
-                    /* Should only be one writer. */
-                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
-                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
-                }
-                else
-                {
-                    taskEXIT_CRITICAL();
-                    break;
-                }
-            }
-            taskEXIT_CRITICAL();
-
-            traceBLOCKING_ON_STREAM_BUFFER_SEND( xStreamBuffer );
-            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-            pxStreamBuffer->xTaskWaitingToSend = NULL;
-        } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
+            xTicksToWait = ( TickType_t ) 0;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
+    #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
 
-    if( xSpace == ( size_t ) 0 )
-    {
-        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
-    }
+    xSpace = prvWaitForSpace( pxStreamBuffer, xRequiredSpace, xTicksToWait );
 
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxVectors, xVectorCount, xDataLengthBytes, xSpace, xRequiredSpace );
 
     if( xReturn > ( size_t ) 0 )
     {
-        traceSTREAM_BUFFER_SEND( xStreamBuffer, xReturn );
+        traceSTREAM_BUFFER_SEND( pxStreamBuffer, xReturn );
 
         /* Was a task waiting for the data? */
-        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        if( prvBytesInBuffer( pxStreamBuffer ) >= sbNOTIFY_LEVEL_BYTES( pxStreamBuffer ) )
         {
             prvSEND_COMPLETED( pxStreamBuffer );
+
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                prvNotifyWaitAny( pxStreamBuffer );
+            }
+            #endif /* configUSE_WAIT_ANY */
         }
         else
         {
@@ -931,11 +1253,9 @@ size_t xStreamBufferSend( StreamBufferHandle_t xStreamBuffer,
     else
     {
         mtCOVERAGE_TEST_MARKER();
-        traceSTREAM_BUFFER_SEND_FAILED( xStreamBuffer );
+        traceSTREAM_BUFFER_SEND_FAILED( pxStreamBuffer );
     }
 
-    traceRETURN_xStreamBufferSend( xReturn );
-
     return xReturn;
 }
 /*-----------------------------------------------------------*/
@@ -946,14 +1266,55 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
                                  BaseType_t * const pxHigherPriorityTaskWoken )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReturn, xSpace;
-    size_t xRequiredSpace = xDataLengthBytes;
+    StreamBufferTxVector_t xVector;
+    size_t xReturn;
 
     traceENTER_xStreamBufferSendFromISR( xStreamBuffer, pvTxData, xDataLengthBytes, pxHigherPriorityTaskWoken );
 
     configASSERT( pvTxData );
     configASSERT( pxStreamBuffer );
 
+    xVector.pvData = pvTxData;
+    xVector.xLength = xDataLengthBytes;
+
+    xReturn = prvSendVectorsFromISR( pxStreamBuffer, &xVector, ( size_t ) 1, xDataLengthBytes, pxHigherPriorityTaskWoken );
+
+    traceRETURN_xStreamBufferSendFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferSendVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                  const StreamBufferTxVector_t * pxVectors,
+                                  size_t xVectorCount,
+                                  BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferSendVFromISR( xStreamBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxVectors );
+    configASSERT( pxStreamBuffer );
+
+    xReturn = prvSendVectorsFromISR( pxStreamBuffer, pxVectors, xVectorCount, prvTxVectorLength( pxVectors, xVectorCount ), pxHigherPriorityTaskWoken );
+
+    traceRETURN_xStreamBufferSendVFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvSendVectorsFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                     const StreamBufferTxVector_t * pxVectors,
+                                     size_t xVectorCount,
+                                     size_t xDataLengthBytes,
+                                     BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    size_t xReturn, xSpace;
+    size_t xRequiredSpace = xDataLengthBytes;
+
     /* This send function is used to write to both message buffers and stream
      * buffers.  If this is a message buffer then the space needed must be
      * increased by the amount of bytes needed to store the length of the
@@ -971,17 +1332,30 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
     }
 
     xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
-    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pvTxData, xDataLengthBytes, xSpace, xRequiredSpace );
+    xReturn = prvWriteMessageToBuffer( pxStreamBuffer, pxVectors, xVectorCount, xDataLengthBytes, xSpace, xRequiredSpace );
 
     if( xReturn > ( size_t ) 0 )
     {
         /* Was a task waiting for the data? */
-        if( prvBytesInBuffer( pxStreamBuffer ) >= pxStreamBuffer->xTriggerLevelBytes )
+        if( prvBytesInBuffer( pxStreamBuffer ) >= sbNOTIFY_LEVEL_BYTES( pxStreamBuffer ) )
         {
             /* MISRA Ref 4.7.1 [Return value shall be checked] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
             /* coverity[misra_c_2012_directive_4_7_violation] */
             prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+            #if ( configUSE_WAIT_ANY == 1 )
+            {
+                if( ( prvNotifyWaitAnyFromISR( pxStreamBuffer ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                {
+                    *pxHigherPriorityTaskWoken = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_WAIT_ANY */
         }
         else
         {
@@ -993,22 +1367,41 @@ size_t xStreamBufferSendFromISR( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    traceSTREAM_BUFFER_SEND_FROM_ISR( xStreamBuffer, xReturn );
-    traceRETURN_xStreamBufferSendFromISR( xReturn );
+    traceSTREAM_BUFFER_SEND_FROM_ISR( pxStreamBuffer, xReturn );
 
     return xReturn;
 }
 /*-----------------------------------------------------------*/
 
 static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                       const void * pvTxData,
+                                       const StreamBufferTxVector_t * pxVectors,
+                                       size_t xVectorCount,
                                        size_t xDataLengthBytes,
                                        size_t xSpace,
                                        size_t xRequiredSpace )
 {
     size_t xNextHead = pxStreamBuffer->xHead;
+    size_t xBytesToWrite, xCount;
+    size_t x;
     configMESSAGE_BUFFER_LENGTH_TYPE xMessageLength;
 
+    #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+    {
+        if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+        {
+            /* Other writers may still be copying into the space between xHead
+             * and the end of the claimed space, so write after the claimed
+             * space instead.  xSpace becomes the space claimed, which is either
+             * all of xRequiredSpace or nothing for a message buffer. */
+            xSpace = prvClaimSpace( pxStreamBuffer, xDataLengthBytes, xRequiredSpace, &xNextHead );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+
     if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
     {
         /* This is a message buffer, as opposed to a stream buffer. */
@@ -1042,30 +1435,106 @@ static size_t prvWriteMessageToBuffer( StreamBuffer_t * const pxStreamBuffer,
 
     if( xDataLengthBytes != ( size_t ) 0 )
     {
-        /* Write the data to the buffer. */
-        /* MISRA Ref 11.5.5 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pvTxData, xDataLengthBytes, xNextHead );
-    }
+        /* Write the data to the buffer one fragment at a time, then update the
+         * head once so the reader sees the whole message, or all the bytes
+         * written, at once. */
+        xBytesToWrite = xDataLengthBytes;
 
-    return xDataLengthBytes;
-}
-/*-----------------------------------------------------------*/
+        for( x = 0; ( x < xVectorCount ) && ( xBytesToWrite > ( size_t ) 0 ); x++ )
+        {
+            xCount = configMIN( pxVectors[ x ].xLength, xBytesToWrite );
 
-size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
-                             void * pvRxData,
-                             size_t xBufferLengthBytes,
-                             TickType_t xTicksToWait )
+            if( xCount > ( size_t ) 0 )
+            {
+                /* MISRA Ref 11.5.5 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                xNextHead = prvWriteBytesToBuffer( pxStreamBuffer, ( const uint8_t * ) pxVectors[ x ].pvData, xCount, xNextHead );
+                xBytesToWrite -= xCount;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        #if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
+        {
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MULTI_PRODUCER ) != ( uint8_t ) 0 )
+            {
+                /* xHead is moved by whichever writer finishes last. */
+                prvReleaseClaim( pxStreamBuffer );
+            }
+            else
+            {
+                pxStreamBuffer->xHead = xNextHead;
+            }
+        }
+        #else /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+        {
+            pxStreamBuffer->xHead = xNextHead;
+        }
+        #endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+    }
+
+    return xDataLengthBytes;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
+                             void * pvRxData,
+                             size_t xBufferLengthBytes,
+                             TickType_t xTicksToWait )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+    StreamBufferRxVector_t xVector;
+    size_t xReceivedLength;
 
     traceENTER_xStreamBufferReceive( xStreamBuffer, pvRxData, xBufferLengthBytes, xTicksToWait );
 
     configASSERT( pvRxData );
     configASSERT( pxStreamBuffer );
 
+    xVector.pvData = pvRxData;
+    xVector.xLength = xBufferLengthBytes;
+
+    xReceivedLength = prvReceiveVectors( pxStreamBuffer, &xVector, ( size_t ) 1, xBufferLengthBytes, xTicksToWait );
+
+    traceRETURN_xStreamBufferReceive( xReceivedLength );
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveV( StreamBufferHandle_t xStreamBuffer,
+                              const StreamBufferRxVector_t * pxVectors,
+                              size_t xVectorCount,
+                              TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReceivedLength;
+
+    traceENTER_xStreamBufferReceiveV( xStreamBuffer, pxVectors, xVectorCount, xTicksToWait );
+
+    configASSERT( pxVectors );
+    configASSERT( pxStreamBuffer );
+
+    xReceivedLength = prvReceiveVectors( pxStreamBuffer, pxVectors, xVectorCount, prvRxVectorLength( pxVectors, xVectorCount ), xTicksToWait );
+
+    traceRETURN_xStreamBufferReceiveV( xReceivedLength );
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReceiveVectors( StreamBuffer_t * const pxStreamBuffer,
+                                 const StreamBufferRxVector_t * pxVectors,
+                                 size_t xVectorCount,
+                                 size_t xBufferLengthBytes,
+                                 TickType_t xTicksToWait )
+{
+    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
     /* This receive function is used by both message buffers, which store
      * discrete messages, and stream buffers, which store a continuous stream of
      * bytes.  Discrete messages include an additional
@@ -1086,56 +1555,7 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
         xBytesToStoreMessageLength = 0;
     }
 
-    if( xTicksToWait != ( TickType_t ) 0 )
-    {
-        /* Checking if there is data and clearing the notification state must be
-         * performed atomically. */
-        taskENTER_CRITICAL();
-        {
-            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-
-            /* If this function was invoked by a message buffer read then
-             * xBytesToStoreMessageLength holds the number of bytes used to hold
-             * the length of the next discrete message.  If this function was
-             * invoked by a stream buffer read then xBytesToStoreMessageLength will
-             * be 0. If this function was invoked by a stream batch buffer read
-             * then xBytesToStoreMessageLength will be xTriggerLevelBytes value
-             * for the buffer.*/
-            if( xBytesAvailable <= xBytesToStoreMessageLength )
-            {
-                /* Clear notification state as going to wait for data. */
-                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
-
-                /* Should only be one reader. */
-                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
-                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
-            }
-            else
-            {
-                mtCOVERAGE_TEST_MARKER();
-            }
-        }
-        taskEXIT_CRITICAL();
-
-        if( xBytesAvailable <= xBytesToStoreMessageLength )
-        {
-            /* Wait for data to be available. */
-            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( xStreamBuffer );
-            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
-            pxStreamBuffer->xTaskWaitingToReceive = NULL;
-
-            /* Recheck the data available after blocking. */
-            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-        }
-        else
-        {
-            mtCOVERAGE_TEST_MARKER();
-        }
-    }
-    else
-    {
-        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
-    }
+    xBytesAvailable = prvWaitForData( pxStreamBuffer, xBytesToStoreMessageLength, xTicksToWait );
 
     /* Whether receiving a discrete message (where xBytesToStoreMessageLength
      * holds the number of bytes used to store the message length) or a stream of
@@ -1144,13 +1564,13 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
      * read bytes from the buffer. */
     if( xBytesAvailable > xBytesToStoreMessageLength )
     {
-        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxVectors, xVectorCount, xBufferLengthBytes, xBytesAvailable );
 
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
         {
-            traceSTREAM_BUFFER_RECEIVE( xStreamBuffer, xReceivedLength );
-            prvRECEIVE_COMPLETED( xStreamBuffer );
+            traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, xReceivedLength );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
         }
         else
         {
@@ -1159,12 +1579,10 @@ size_t xStreamBufferReceive( StreamBufferHandle_t xStreamBuffer,
     }
     else
     {
-        traceSTREAM_BUFFER_RECEIVE_FAILED( xStreamBuffer );
+        traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
         mtCOVERAGE_TEST_MARKER();
     }
 
-    traceRETURN_xStreamBufferReceive( xReceivedLength );
-
     return xReceivedLength;
 }
 /*-----------------------------------------------------------*/
@@ -1219,13 +1637,54 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
                                     BaseType_t * const pxHigherPriorityTaskWoken )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+    StreamBufferRxVector_t xVector;
+    size_t xReceivedLength;
 
     traceENTER_xStreamBufferReceiveFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxHigherPriorityTaskWoken );
 
     configASSERT( pvRxData );
     configASSERT( pxStreamBuffer );
 
+    xVector.pvData = pvRxData;
+    xVector.xLength = xBufferLengthBytes;
+
+    xReceivedLength = prvReceiveVectorsFromISR( pxStreamBuffer, &xVector, ( size_t ) 1, xBufferLengthBytes, pxHigherPriorityTaskWoken );
+
+    traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength );
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferReceiveVFromISR( StreamBufferHandle_t xStreamBuffer,
+                                     const StreamBufferRxVector_t * pxVectors,
+                                     size_t xVectorCount,
+                                     BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReceivedLength;
+
+    traceENTER_xStreamBufferReceiveVFromISR( xStreamBuffer, pxVectors, xVectorCount, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxVectors );
+    configASSERT( pxStreamBuffer );
+
+    xReceivedLength = prvReceiveVectorsFromISR( pxStreamBuffer, pxVectors, xVectorCount, prvRxVectorLength( pxVectors, xVectorCount ), pxHigherPriorityTaskWoken );
+
+    traceRETURN_xStreamBufferReceiveVFromISR( xReceivedLength );
+
+    return xReceivedLength;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReceiveVectorsFromISR( StreamBuffer_t * const pxStreamBuffer,
+                                        const StreamBufferRxVector_t * pxVectors,
+                                        size_t xVectorCount,
+                                        size_t xBufferLengthBytes,
+                                        BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    size_t xReceivedLength = 0, xBytesAvailable, xBytesToStoreMessageLength;
+
     /* This receive function is used by both message buffers, which store
      * discrete messages, and stream buffers, which store a continuous stream of
      * bytes.  Discrete messages include an additional
@@ -1249,7 +1708,7 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
      * read bytes from the buffer. */
     if( xBytesAvailable > xBytesToStoreMessageLength )
     {
-        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pvRxData, xBufferLengthBytes, xBytesAvailable );
+        xReceivedLength = prvReadMessageFromBuffer( pxStreamBuffer, pxVectors, xVectorCount, xBufferLengthBytes, xBytesAvailable );
 
         /* Was a task waiting for space in the buffer? */
         if( xReceivedLength != ( size_t ) 0 )
@@ -1269,19 +1728,20 @@ size_t xStreamBufferReceiveFromISR( StreamBufferHandle_t xStreamBuffer,
         mtCOVERAGE_TEST_MARKER();
     }
 
-    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( xStreamBuffer, xReceivedLength );
-    traceRETURN_xStreamBufferReceiveFromISR( xReceivedLength );
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( pxStreamBuffer, xReceivedLength );
 
     return xReceivedLength;
 }
 /*-----------------------------------------------------------*/
 
 static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                        void * pvRxData,
+                                        const StreamBufferRxVector_t * pxVectors,
+                                        size_t xVectorCount,
                                         size_t xBufferLengthBytes,
                                         size_t xBytesAvailable )
 {
-    size_t xCount, xNextMessageLength;
+    size_t xCount, xNextMessageLength, xBytesToRead, xFragmentLength;
+    size_t x;
     configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
     size_t xNextTail = pxStreamBuffer->xTail;
 
@@ -1320,270 +1780,1231 @@ static size_t prvReadMessageFromBuffer( StreamBuffer_t * pxStreamBuffer,
 
     if( xCount != ( size_t ) 0 )
     {
-        /* Read the actual data and update the tail to mark the data as officially consumed. */
-        /* MISRA Ref 11.5.5 [Void pointer assignment] */
-        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-        /* coverity[misra_c_2012_rule_11_5_violation] */
-        pxStreamBuffer->xTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xCount, xNextTail );
+        /* Read the actual data one fragment at a time, then update the tail
+         * to mark the data as officially consumed. */
+        xBytesToRead = xCount;
+
+        for( x = 0; ( x < xVectorCount ) && ( xBytesToRead > ( size_t ) 0 ); x++ )
+        {
+            xFragmentLength = configMIN( pxVectors[ x ].xLength, xBytesToRead );
+
+            if( xFragmentLength > ( size_t ) 0 )
+            {
+                /* MISRA Ref 11.5.5 [Void pointer assignment] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+                /* coverity[misra_c_2012_rule_11_5_violation] */
+                xNextTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) pxVectors[ x ].pvData, xFragmentLength, xNextTail );
+                xBytesToRead -= xFragmentLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxStreamBuffer->xTail = xNextTail;
     }
 
     return xCount;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+size_t xStreamBufferReceiveBatch( StreamBufferHandle_t xStreamBuffer,
+                                  void * pvRxData,
+                                  size_t xBufferLengthBytes,
+                                  size_t * pxMessageLengths,
+                                  size_t xMaxMessages,
+                                  TickType_t xTicksToWait )
 {
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    size_t xTail;
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xMessages = 0, xBytesRead = 0, xBytesAvailable;
 
-    traceENTER_xStreamBufferIsEmpty( xStreamBuffer );
+    traceENTER_xStreamBufferReceiveBatch( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, xTicksToWait );
 
+    configASSERT( pvRxData );
+    configASSERT( pxMessageLengths );
     configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
 
-    /* True if no bytes are available. */
-    xTail = pxStreamBuffer->xTail;
+    /* Block only while the buffer does not hold a single message. */
+    xBytesAvailable = prvWaitForData( pxStreamBuffer, sbBYTES_TO_STORE_MESSAGE_LENGTH, xTicksToWait );
 
-    if( pxStreamBuffer->xHead == xTail )
+    if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
     {
-        xReturn = pdTRUE;
+        /* MISRA Ref 11.5.5 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        xMessages = prvReadMessagesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, xBytesAvailable, &xBytesRead );
+
+        /* Was a task waiting for space in the buffer?  It is notified once
+         * for the whole batch. */
+        if( xMessages != ( size_t ) 0 )
+        {
+            traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, xBytesRead );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
     else
     {
-        xReturn = pdFALSE;
+        traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
+        mtCOVERAGE_TEST_MARKER();
     }
 
-    traceRETURN_xStreamBufferIsEmpty( xReturn );
+    traceRETURN_xStreamBufferReceiveBatch( xMessages );
 
-    return xReturn;
+    return xMessages;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+size_t xStreamBufferReceiveBatchFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         void * pvRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * pxMessageLengths,
+                                         size_t xMaxMessages,
+                                         BaseType_t * const pxHigherPriorityTaskWoken )
 {
-    BaseType_t xReturn;
-    size_t xBytesToStoreMessageLength;
-    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xMessages = 0, xBytesRead = 0, xBytesAvailable;
 
-    traceENTER_xStreamBufferIsFull( xStreamBuffer );
+    traceENTER_xStreamBufferReceiveBatchFromISR( xStreamBuffer, pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, pxHigherPriorityTaskWoken );
 
+    configASSERT( pvRxData );
+    configASSERT( pxMessageLengths );
     configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 );
 
-    /* This generic version of the receive function is used by both message
-     * buffers, which store discrete messages, and stream buffers, which store a
-     * continuous stream of bytes.  Discrete messages include an additional
-     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
-    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
-    {
-        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
-    }
-    else
-    {
-        xBytesToStoreMessageLength = 0;
-    }
+    xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
 
-    /* True if the available space equals zero. */
-    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+    if( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH )
     {
-        xReturn = pdTRUE;
+        /* MISRA Ref 11.5.5 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        xMessages = prvReadMessagesFromBuffer( pxStreamBuffer, ( uint8_t * ) pvRxData, xBufferLengthBytes, pxMessageLengths, xMaxMessages, xBytesAvailable, &xBytesRead );
+
+        if( xMessages != ( size_t ) 0 )
+        {
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
     }
     else
     {
-        xReturn = pdFALSE;
+        mtCOVERAGE_TEST_MARKER();
     }
 
-    traceRETURN_xStreamBufferIsFull( xReturn );
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( pxStreamBuffer, xBytesRead );
 
-    return xReturn;
+    traceRETURN_xStreamBufferReceiveBatchFromISR( xMessages );
+
+    return xMessages;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
-                                              BaseType_t * pxHigherPriorityTaskWoken )
+static size_t prvReadMessagesFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                         uint8_t * pucRxData,
+                                         size_t xBufferLengthBytes,
+                                         size_t * pxMessageLengths,
+                                         size_t xMaxMessages,
+                                         size_t xBytesAvailable,
+                                         size_t * pxBytesRead )
 {
-    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
-
-    traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
-
-    configASSERT( pxStreamBuffer );
+    size_t xMessages = 0, xBytesRead = 0, xNextMessageLength, xMessageTail;
+    configMESSAGE_BUFFER_LENGTH_TYPE xTempNextMessageLength;
+    size_t xNextTail = pxStreamBuffer->xTail;
+    BaseType_t xMessageFits = pdTRUE;
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    while( ( xMessages < xMaxMessages ) &&
+           ( xBytesAvailable > sbBYTES_TO_STORE_MESSAGE_LENGTH ) &&
+           ( xMessageFits != pdFALSE ) )
     {
-        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+        xMessageTail = prvReadBytesFromBuffer( pxStreamBuffer, ( uint8_t * ) &xTempNextMessageLength, sbBYTES_TO_STORE_MESSAGE_LENGTH, xNextTail );
+        xNextMessageLength = ( size_t ) xTempNextMessageLength;
+
+        /* Messages are only read whole, so stop at the first one that does
+         * not fit in the space that remains. */
+        if( xNextMessageLength <= ( xBufferLengthBytes - xBytesRead ) )
         {
-            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
-                                                ( pxStreamBuffer )->uxNotificationIndex,
-                                                ( uint32_t ) 0,
-                                                eNoAction,
-                                                pxHigherPriorityTaskWoken );
-            ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
-            xReturn = pdTRUE;
+            if( xNextMessageLength > ( size_t ) 0 )
+            {
+                xMessageTail = prvReadBytesFromBuffer( pxStreamBuffer, &( pucRxData[ xBytesRead ] ), xNextMessageLength, xMessageTail );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxMessageLengths[ xMessages ] = xNextMessageLength;
+            xMessages++;
+            xBytesRead += xNextMessageLength;
+            xBytesAvailable -= sbBYTES_TO_STORE_MESSAGE_LENGTH + xNextMessageLength;
+            xNextTail = xMessageTail;
         }
         else
         {
-            xReturn = pdFALSE;
+            xMessageFits = pdFALSE;
         }
     }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_xStreamBufferSendCompletedFromISR( xReturn );
+    /* Mark all the messages that were read as consumed in one step. */
+    pxStreamBuffer->xTail = xNextTail;
+    *pxBytesRead = xBytesRead;
 
-    return xReturn;
+    return xMessages;
 }
 /*-----------------------------------------------------------*/
 
-BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
-                                                 BaseType_t * pxHigherPriorityTaskWoken )
+size_t xStreamBufferAcquireWrite( StreamBufferHandle_t xStreamBuffer,
+                                  void ** ppvData,
+                                  TickType_t xTicksToWait )
 {
     StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
-    BaseType_t xReturn;
-    UBaseType_t uxSavedInterruptStatus;
+    size_t xReturn;
 
-    traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+    traceENTER_xStreamBufferAcquireWrite( xStreamBuffer, ppvData, xTicksToWait );
 
+    configASSERT( ppvData );
     configASSERT( pxStreamBuffer );
 
-    /* MISRA Ref 4.7.1 [Return value shall be checked] */
-    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
-    /* coverity[misra_c_2012_directive_4_7_violation] */
-    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
-    {
+    /* A message buffer must be written a whole message at a time, and a multi
+     * producer buffer cannot hand out the space at xHead. */
+    configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
+
+    ( void ) prvWaitForSpace( pxStreamBuffer, ( size_t ) 1, xTicksToWait );
+
+    xReturn = prvContiguousSpace( pxStreamBuffer );
+    *ppvData = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] );
+
+    traceRETURN_xStreamBufferAcquireWrite( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferAcquireWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                         void ** ppvData )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferAcquireWriteFromISR( xStreamBuffer, ppvData );
+
+    configASSERT( ppvData );
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
+
+    xReturn = prvContiguousSpace( pxStreamBuffer );
+    *ppvData = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xHead ] );
+
+    traceRETURN_xStreamBufferAcquireWriteFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferCommitWrite( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xDataLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xNextHead;
+    BaseType_t xReturn;
+
+    traceENTER_xStreamBufferCommitWrite( xStreamBuffer, xDataLengthBytes );
+
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
+
+    /* The contiguous space can only have grown since the region was acquired,
+     * so a longer commit cannot have come from xStreamBufferAcquireWrite(). */
+    if( xDataLengthBytes > prvContiguousSpace( pxStreamBuffer ) )
+    {
+        traceSTREAM_BUFFER_SEND_FAILED( pxStreamBuffer );
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        if( xDataLengthBytes > ( size_t ) 0 )
+        {
+            xNextHead = pxStreamBuffer->xHead + xDataLengthBytes;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+
+            traceSTREAM_BUFFER_SEND( pxStreamBuffer, xDataLengthBytes );
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= sbNOTIFY_LEVEL_BYTES( pxStreamBuffer ) )
+            {
+                prvSEND_COMPLETED( pxStreamBuffer );
+
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    prvNotifyWaitAny( pxStreamBuffer );
+                }
+                #endif /* configUSE_WAIT_ANY */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+
+    traceRETURN_xStreamBufferCommitWrite( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferCommitWriteFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xDataLengthBytes,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xNextHead;
+    BaseType_t xReturn;
+
+    traceENTER_xStreamBufferCommitWriteFromISR( xStreamBuffer, xDataLengthBytes, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & ( sbFLAGS_IS_MESSAGE_BUFFER | sbFLAGS_IS_MULTI_PRODUCER ) ) == ( uint8_t ) 0 );
+
+    if( xDataLengthBytes > prvContiguousSpace( pxStreamBuffer ) )
+    {
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        if( xDataLengthBytes > ( size_t ) 0 )
+        {
+            xNextHead = pxStreamBuffer->xHead + xDataLengthBytes;
+
+            if( xNextHead >= pxStreamBuffer->xLength )
+            {
+                xNextHead -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xHead = xNextHead;
+
+            /* Was a task waiting for the data? */
+            if( prvBytesInBuffer( pxStreamBuffer ) >= sbNOTIFY_LEVEL_BYTES( pxStreamBuffer ) )
+            {
+                /* MISRA Ref 4.7.1 [Return value shall be checked] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+                /* coverity[misra_c_2012_directive_4_7_violation] */
+                prvSEND_COMPLETE_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    if( ( prvNotifyWaitAnyFromISR( pxStreamBuffer ) != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+                    {
+                        *pxHigherPriorityTaskWoken = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #endif /* configUSE_WAIT_ANY */
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+
+    traceSTREAM_BUFFER_SEND_FROM_ISR( pxStreamBuffer, ( xReturn == pdPASS ) ? xDataLengthBytes : ( size_t ) 0 );
+    traceRETURN_xStreamBufferCommitWriteFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferAcquireRead( StreamBufferHandle_t xStreamBuffer,
+                                 void ** ppvData,
+                                 TickType_t xTicksToWait )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn = 0, xBytesToWaitFor;
+
+    traceENTER_xStreamBufferAcquireRead( xStreamBuffer, ppvData, xTicksToWait );
+
+    configASSERT( ppvData );
+    configASSERT( pxStreamBuffer );
+
+    /* A message buffer must be read a whole message at a time. */
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    /* As per xStreamBufferReceive(), a batching buffer only returns data once
+     * it holds more than its trigger level. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_BATCHING_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToWaitFor = pxStreamBuffer->xTriggerLevelBytes;
+    }
+    else
+    {
+        xBytesToWaitFor = 0;
+    }
+
+    if( prvWaitForData( pxStreamBuffer, xBytesToWaitFor, xTicksToWait ) > xBytesToWaitFor )
+    {
+        xReturn = prvContiguousBytes( pxStreamBuffer );
+    }
+    else
+    {
+        traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    *ppvData = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xTail ] );
+
+    traceRETURN_xStreamBufferAcquireRead( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+size_t xStreamBufferAcquireReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                        void ** ppvData )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xReturn;
+
+    traceENTER_xStreamBufferAcquireReadFromISR( xStreamBuffer, ppvData );
+
+    configASSERT( ppvData );
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    xReturn = prvContiguousBytes( pxStreamBuffer );
+    *ppvData = &( pxStreamBuffer->pucBuffer[ pxStreamBuffer->xTail ] );
+
+    traceRETURN_xStreamBufferAcquireReadFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReleaseRead( StreamBufferHandle_t xStreamBuffer,
+                                     size_t xBufferLengthBytes )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xNextTail;
+    BaseType_t xReturn;
+
+    traceENTER_xStreamBufferReleaseRead( xStreamBuffer, xBufferLengthBytes );
+
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    /* The contiguous data can only have grown since the region was acquired,
+     * so a longer release cannot have come from xStreamBufferAcquireRead(). */
+    if( xBufferLengthBytes > prvContiguousBytes( pxStreamBuffer ) )
+    {
+        traceSTREAM_BUFFER_RECEIVE_FAILED( pxStreamBuffer );
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        if( xBufferLengthBytes > ( size_t ) 0 )
+        {
+            xNextTail = pxStreamBuffer->xTail + xBufferLengthBytes;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+
+            /* Was a task waiting for space in the buffer? */
+            traceSTREAM_BUFFER_RECEIVE( pxStreamBuffer, xBufferLengthBytes );
+            prvRECEIVE_COMPLETED( pxStreamBuffer );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+
+    traceRETURN_xStreamBufferReleaseRead( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReleaseReadFromISR( StreamBufferHandle_t xStreamBuffer,
+                                            size_t xBufferLengthBytes,
+                                            BaseType_t * const pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    size_t xNextTail;
+    BaseType_t xReturn;
+
+    traceENTER_xStreamBufferReleaseReadFromISR( xStreamBuffer, xBufferLengthBytes, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+    configASSERT( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) == ( uint8_t ) 0 );
+
+    if( xBufferLengthBytes > prvContiguousBytes( pxStreamBuffer ) )
+    {
+        xReturn = pdFAIL;
+    }
+    else
+    {
+        if( xBufferLengthBytes > ( size_t ) 0 )
+        {
+            xNextTail = pxStreamBuffer->xTail + xBufferLengthBytes;
+
+            if( xNextTail >= pxStreamBuffer->xLength )
+            {
+                xNextTail -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxStreamBuffer->xTail = xNextTail;
+
+            /* Was a task waiting for space in the buffer? */
+            /* MISRA Ref 4.7.1 [Return value shall be checked] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+            /* coverity[misra_c_2012_directive_4_7_violation] */
+            prvRECEIVE_COMPLETED_FROM_ISR( pxStreamBuffer, pxHigherPriorityTaskWoken );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        xReturn = pdPASS;
+    }
+
+    traceSTREAM_BUFFER_RECEIVE_FROM_ISR( pxStreamBuffer, ( xReturn == pdPASS ) ? xBufferLengthBytes : ( size_t ) 0 );
+    traceRETURN_xStreamBufferReleaseReadFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsEmpty( StreamBufferHandle_t xStreamBuffer )
+{
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    size_t xTail;
+
+    traceENTER_xStreamBufferIsEmpty( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    /* True if no bytes are available. */
+    xTail = pxStreamBuffer->xTail;
+
+    if( pxStreamBuffer->xHead == xTail )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    traceRETURN_xStreamBufferIsEmpty( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferIsFull( StreamBufferHandle_t xStreamBuffer )
+{
+    BaseType_t xReturn;
+    size_t xBytesToStoreMessageLength;
+    const StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+    traceENTER_xStreamBufferIsFull( xStreamBuffer );
+
+    configASSERT( pxStreamBuffer );
+
+    /* This generic version of the receive function is used by both message
+     * buffers, which store discrete messages, and stream buffers, which store a
+     * continuous stream of bytes.  Discrete messages include an additional
+     * sbBYTES_TO_STORE_MESSAGE_LENGTH bytes that hold the length of the message. */
+    if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+    {
+        xBytesToStoreMessageLength = sbBYTES_TO_STORE_MESSAGE_LENGTH;
+    }
+    else
+    {
+        xBytesToStoreMessageLength = 0;
+    }
+
+    /* True if the available space equals zero. */
+    if( xStreamBufferSpacesAvailable( xStreamBuffer ) <= xBytesToStoreMessageLength )
+    {
+        xReturn = pdTRUE;
+    }
+    else
+    {
+        xReturn = pdFALSE;
+    }
+
+    traceRETURN_xStreamBufferIsFull( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferSendCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
+                                              BaseType_t * pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    traceENTER_xStreamBufferSendCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    {
+        if( ( pxStreamBuffer )->xTaskWaitingToReceive != NULL )
+        {
+            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToReceive,
+                                                ( pxStreamBuffer )->uxNotificationIndex,
+                                                ( uint32_t ) 0,
+                                                eNoAction,
+                                                pxHigherPriorityTaskWoken );
+            ( pxStreamBuffer )->xTaskWaitingToReceive = NULL;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_xStreamBufferSendCompletedFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xStreamBufferReceiveCompletedFromISR( StreamBufferHandle_t xStreamBuffer,
+                                                 BaseType_t * pxHigherPriorityTaskWoken )
+{
+    StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+    BaseType_t xReturn;
+    UBaseType_t uxSavedInterruptStatus;
+
+    traceENTER_xStreamBufferReceiveCompletedFromISR( xStreamBuffer, pxHigherPriorityTaskWoken );
+
+    configASSERT( pxStreamBuffer );
+
+    /* MISRA Ref 4.7.1 [Return value shall be checked] */
+    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+    /* coverity[misra_c_2012_directive_4_7_violation] */
+    uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+    {
         if( ( pxStreamBuffer )->xTaskWaitingToSend != NULL )
         {
-            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
-                                                ( pxStreamBuffer )->uxNotificationIndex,
-                                                ( uint32_t ) 0,
-                                                eNoAction,
-                                                pxHigherPriorityTaskWoken );
-            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;
-            xReturn = pdTRUE;
+            ( void ) xTaskNotifyIndexedFromISR( ( pxStreamBuffer )->xTaskWaitingToSend,
+                                                ( pxStreamBuffer )->uxNotificationIndex,
+                                                ( uint32_t ) 0,
+                                                eNoAction,
+                                                pxHigherPriorityTaskWoken );
+            ( pxStreamBuffer )->xTaskWaitingToSend = NULL;
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            xReturn = pdFALSE;
+        }
+    }
+    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+    traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn );
+
+    return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
+                                     const uint8_t * pucData,
+                                     size_t xCount,
+                                     size_t xHead )
+{
+    size_t xFirstLength;
+
+    configASSERT( xCount > ( size_t ) 0 );
+
+    /* Calculate the number of bytes that can be added in the first write -
+     * which may be less than the total number of bytes that need to be added if
+     * the buffer will wrap back to the beginning. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xHead, xCount );
+
+    /* Write as many bytes as can be written in the first write. */
+    configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
+    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+
+    /* If the number of bytes written was less than the number that could be
+     * written in the first write... */
+    if( xCount > xFirstLength )
+    {
+        /* ...then write the remaining bytes to the start of the buffer. */
+        configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
+        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    xHead += xCount;
+
+    if( xHead >= pxStreamBuffer->xLength )
+    {
+        xHead -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xHead;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
+                                      uint8_t * pucData,
+                                      size_t xCount,
+                                      size_t xTail )
+{
+    size_t xFirstLength;
+
+    configASSERT( xCount != ( size_t ) 0 );
+
+    /* Calculate the number of bytes that can be read - which may be
+     * less than the number wanted if the data wraps around to the start of
+     * the buffer. */
+    xFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
+
+    /* Obtain the number of bytes it is possible to obtain in the first
+     * read.  Asserts check bounds of read and write. */
+    configASSERT( xFirstLength <= xCount );
+    configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
+    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+
+    /* If the total number of wanted bytes is greater than the number
+     * that could be read in the first read... */
+    if( xCount > xFirstLength )
+    {
+        /* ...then read the remaining bytes from the start of the buffer. */
+        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    /* Move the tail pointer to effectively remove the data read from the buffer. */
+    xTail += xCount;
+
+    if( xTail >= pxStreamBuffer->xLength )
+    {
+        xTail -= pxStreamBuffer->xLength;
+    }
+
+    return xTail;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+{
+    /* Returns the distance between xTail and xHead. */
+    size_t xCount;
+
+    xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
+    xCount -= pxStreamBuffer->xTail;
+
+    if( xCount >= pxStreamBuffer->xLength )
+    {
+        xCount -= pxStreamBuffer->xLength;
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xCount;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForSpace( StreamBuffer_t * const pxStreamBuffer,
+                               size_t xRequiredSpace,
+                               TickType_t xTicksToWait )
+{
+    size_t xSpace = 0;
+    TimeOut_t xTimeOut;
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        vTaskSetTimeOutState( &xTimeOut );
+
+        do
+        {
+            /* Wait until the required number of bytes are free in the message
+             * buffer. */
+            taskENTER_CRITICAL();
+            {
+                xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+                if( xSpace < xRequiredSpace )
+                {
+                    /* Clear notification state as going to wait for space. */
+                    ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                    /* Should only be one writer. */
+                    configASSERT( pxStreamBuffer->xTaskWaitingToSend == NULL );
+                    pxStreamBuffer->xTaskWaitingToSend = xTaskGetCurrentTaskHandle();
+                }
+                else
+                {
+                    taskEXIT_CRITICAL();
+                    break;
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            traceBLOCKING_ON_STREAM_BUFFER_SEND( pxStreamBuffer );
+            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToSend = NULL;
+        } while( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    if( xSpace == ( size_t ) 0 )
+    {
+        xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+    }
+    else
+    {
+        mtCOVERAGE_TEST_MARKER();
+    }
+
+    return xSpace;
+}
+/*-----------------------------------------------------------*/
+
+static size_t prvWaitForData( StreamBuffer_t * const pxStreamBuffer,
+                              size_t xBytesToStoreMessageLength,
+                              TickType_t xTicksToWait )
+{
+    size_t xBytesAvailable;
+
+    #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        TimeOut_t xTimeOut;
+    #endif
+
+    if( xTicksToWait != ( TickType_t ) 0 )
+    {
+        #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+        {
+            vTaskSetTimeOutState( &xTimeOut );
+        }
+        #endif
+
+        /* Checking if there is data and clearing the notification state must be
+         * performed atomically. */
+        taskENTER_CRITICAL();
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            /* If this function was invoked by a message buffer read then
+             * xBytesToStoreMessageLength holds the number of bytes used to hold
+             * the length of the next discrete message.  If this function was
+             * invoked by a stream buffer read then xBytesToStoreMessageLength will
+             * be 0. If this function was invoked by a stream batch buffer read
+             * then xBytesToStoreMessageLength will be xTriggerLevelBytes value
+             * for the buffer.*/
+            if( xBytesAvailable <= xBytesToStoreMessageLength )
+            {
+                /* Clear notification state as going to wait for data. */
+                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+
+                /* Should only be one reader. */
+                configASSERT( pxStreamBuffer->xTaskWaitingToReceive == NULL );
+                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xBytesAvailable <= xBytesToStoreMessageLength )
+        {
+            /* Wait for data to be available. */
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+
+            /* Recheck the data available after blocking. */
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            #if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+            {
+                /* If the reader was woken by the first data to arrive then hold
+                 * off for more, within what is left of the block time. */
+                if( ( pxStreamBuffer->xCoalesceTicks != ( TickType_t ) 0 ) &&
+                    ( xBytesAvailable > xBytesToStoreMessageLength ) &&
+                    ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) == pdFALSE ) )
+                {
+                    xBytesAvailable = prvWaitForCoalescedData( pxStreamBuffer, configMIN( xTicksToWait, pxStreamBuffer->xCoalesceTicks ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif /* configUSE_STREAM_BUFFER_COALESCING */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+    else
+    {
+        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+    }
+
+    return xBytesAvailable;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_STREAM_BUFFER_COALESCING == 1 )
+
+    static size_t prvWaitForCoalescedData( StreamBuffer_t * const pxStreamBuffer,
+                                           TickType_t xTicksToWait )
+    {
+        size_t xBytesAvailable;
+
+        /* As per prvWaitForData(), but writes only wake the reader once the
+         * coalescing byte count is reached rather than the trigger level. */
+        taskENTER_CRITICAL();
+        {
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+
+            if( xBytesAvailable < pxStreamBuffer->xCoalesceBytes )
+            {
+                ( void ) xTaskNotifyStateClearIndexed( NULL, pxStreamBuffer->uxNotificationIndex );
+                pxStreamBuffer->xCoalescing = pdTRUE;
+                pxStreamBuffer->xTaskWaitingToReceive = xTaskGetCurrentTaskHandle();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xBytesAvailable < pxStreamBuffer->xCoalesceBytes )
+        {
+            traceBLOCKING_ON_STREAM_BUFFER_RECEIVE( pxStreamBuffer );
+            ( void ) xTaskNotifyWaitIndexed( pxStreamBuffer->uxNotificationIndex, ( uint32_t ) 0, ( uint32_t ) 0, NULL, xTicksToWait );
+            pxStreamBuffer->xTaskWaitingToReceive = NULL;
+            pxStreamBuffer->xCoalescing = pdFALSE;
+
+            xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
         }
         else
         {
-            xReturn = pdFALSE;
+            mtCOVERAGE_TEST_MARKER();
         }
-    }
-    taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
 
-    traceRETURN_xStreamBufferReceiveCompletedFromISR( xReturn );
+        return xBytesAvailable;
+    }
 
-    return xReturn;
-}
+#endif /* configUSE_STREAM_BUFFER_COALESCING */
 /*-----------------------------------------------------------*/
 
-static size_t prvWriteBytesToBuffer( StreamBuffer_t * const pxStreamBuffer,
-                                     const uint8_t * pucData,
-                                     size_t xCount,
-                                     size_t xHead )
-{
-    size_t xFirstLength;
+#if ( configUSE_MULTI_PRODUCER_STREAM_BUFFERS == 1 )
 
-    configASSERT( xCount > ( size_t ) 0 );
+    static size_t prvClaimSpace( StreamBuffer_t * const pxStreamBuffer,
+                                 size_t xDataLengthBytes,
+                                 size_t xRequiredSpace,
+                                 size_t * const pxClaimStart )
+    {
+        size_t xClaim, xNewClaim, xStart, xEnd, xSpace;
+        size_t xClaimLength;
 
-    /* Calculate the number of bytes that can be added in the first write -
-     * which may be less than the total number of bytes that need to be added if
-     * the buffer will wrap back to the beginning. */
-    xFirstLength = configMIN( pxStreamBuffer->xLength - xHead, xCount );
+        do
+        {
+            xClaim = pxStreamBuffer->xClaim;
+            xStart = xClaim >> sbCLAIM_COUNT_BITS;
+
+            /* As per xStreamBufferSpacesAvailable(), but measured from the end
+             * of the claimed space rather than from xHead.  The reader only
+             * ever moves xTail towards xHead, so reading a stale xTail can only
+             * under estimate the space. */
+            xSpace = pxStreamBuffer->xLength + pxStreamBuffer->xTail;
+            xSpace -= xStart;
+            xSpace -= ( size_t ) 1;
+
+            if( xSpace >= pxStreamBuffer->xLength )
+            {
+                xSpace -= pxStreamBuffer->xLength;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-    /* Write as many bytes as can be written in the first write. */
-    configASSERT( ( xHead + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) ( &( pxStreamBuffer->pucBuffer[ xHead ] ) ), ( const void * ) pucData, xFirstLength );
+            if( ( pxStreamBuffer->ucFlags & sbFLAGS_IS_MESSAGE_BUFFER ) != ( uint8_t ) 0 )
+            {
+                /* A message is written whole or not at all. */
+                if( ( xDataLengthBytes != ( size_t ) 0 ) && ( xSpace >= xRequiredSpace ) )
+                {
+                    xClaimLength = xRequiredSpace;
+                }
+                else
+                {
+                    xClaimLength = 0;
+                }
+            }
+            else
+            {
+                xClaimLength = configMIN( xDataLengthBytes, xSpace );
+            }
 
-    /* If the number of bytes written was less than the number that could be
-     * written in the first write... */
-    if( xCount > xFirstLength )
-    {
-        /* ...then write the remaining bytes to the start of the buffer. */
-        configASSERT( ( xCount - xFirstLength ) <= pxStreamBuffer->xLength );
-        ( void ) memcpy( ( void * ) pxStreamBuffer->pucBuffer, ( const void * ) &( pucData[ xFirstLength ] ), xCount - xFirstLength );
-    }
-    else
-    {
-        mtCOVERAGE_TEST_MARKER();
+            if( xClaimLength == ( size_t ) 0 )
+            {
+                /* Nothing to claim, so leave xClaim unchanged. */
+                xNewClaim = xClaim;
+            }
+            else
+            {
+                xEnd = xStart + xClaimLength;
+
+                if( xEnd >= pxStreamBuffer->xLength )
+                {
+                    xEnd -= pxStreamBuffer->xLength;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* Move the end of the claimed space and count this writer in.
+                 * The count overflowing would need more writers than there are
+                 * nested interrupt levels and tasks on any supported target. */
+                configASSERT( ( xClaim & sbCLAIM_COUNT_MASK ) != sbCLAIM_COUNT_MASK );
+                xNewClaim = ( xEnd << sbCLAIM_COUNT_BITS ) | ( ( xClaim & sbCLAIM_COUNT_MASK ) + ( size_t ) 1 );
+            }
+        } while( prvCompareAndSwapSize( &( pxStreamBuffer->xClaim ), xClaim, xNewClaim ) == pdFALSE );
+
+        *pxClaimStart = xStart;
+
+        return xClaimLength;
     }
+/*-----------------------------------------------------------*/
 
-    xHead += xCount;
+    static void prvReleaseClaim( StreamBuffer_t * const pxStreamBuffer )
+    {
+        size_t xClaim;
+        BaseType_t xDone;
+
+        /* Writers complete in any order, so xHead can only be moved when no
+         * other writer is still copying, at which point everything up to the
+         * end of the claimed space has been written.  The count in xClaim is
+         * the number of writers still copying, so a writer that finds the
+         * count is 1 knows it is the only one, and is the only writer that can
+         * move xHead until it counts itself out.  It moves xHead to the end of
+         * the claim taken from the same value of xClaim that its compare and
+         * swap then counts it out of, so xHead only ever moves forward and
+         * never to a stale end.  If another writer claims space in the
+         * meantime the compare and swap fails, and the loop either moves xHead
+         * again or leaves the new writer to move it.  Each compare and swap
+         * orders the copy into the claimed space before the release. */
+        do
+        {
+            xClaim = pxStreamBuffer->xClaim;
+            configASSERT( ( xClaim & sbCLAIM_COUNT_MASK ) != ( size_t ) 0 );
 
-    if( xHead >= pxStreamBuffer->xLength )
-    {
-        xHead -= pxStreamBuffer->xLength;
+            if( ( xClaim & sbCLAIM_COUNT_MASK ) == ( size_t ) 1 )
+            {
+                portMEMORY_BARRIER();
+                pxStreamBuffer->xHead = xClaim >> sbCLAIM_COUNT_BITS;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            xDone = prvCompareAndSwapSize( &( pxStreamBuffer->xClaim ), xClaim, xClaim - ( size_t ) 1 );
+        } while( xDone == pdFALSE );
     }
-    else
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvCompareAndSwapSize( size_t volatile * const pxDestination,
+                                             size_t xComparand,
+                                             size_t xExchange )
     {
-        mtCOVERAGE_TEST_MARKER();
+        BaseType_t xReturn = pdFALSE;
+
+        #if defined( portCOMPARE_AND_SWAP_SIZE )
+        {
+            /* The port provides a lock free compare and swap, which also acts
+             * as a full memory barrier. */
+            if( portCOMPARE_AND_SWAP_SIZE( pxDestination, xComparand, xExchange ) != 0 )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #else /* if defined( portCOMPARE_AND_SWAP_SIZE ) */
+        {
+            UBaseType_t uxSavedInterruptStatus;
+
+            /* Otherwise the swap is made atomic with a critical section, which
+             * is only held for the swap itself rather than for the copy of the
+             * data.  The interrupt safe version is used as writers can be tasks
+             * or interrupts. */
+            uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+            {
+                if( *pxDestination == xComparand )
+                {
+                    *pxDestination = xExchange;
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+        }
+        #endif /* if defined( portCOMPARE_AND_SWAP_SIZE ) */
+
+        return xReturn;
     }
+/*-----------------------------------------------------------*/
 
-    return xHead;
+#endif /* configUSE_MULTI_PRODUCER_STREAM_BUFFERS */
+
+static size_t prvContiguousSpace( StreamBuffer_t * const pxStreamBuffer )
+{
+    size_t xSpace;
+
+    /* The free space may wrap, but the region handed out must not. */
+    xSpace = xStreamBufferSpacesAvailable( pxStreamBuffer );
+
+    return configMIN( xSpace, pxStreamBuffer->xLength - pxStreamBuffer->xHead );
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvReadBytesFromBuffer( StreamBuffer_t * pxStreamBuffer,
-                                      uint8_t * pucData,
-                                      size_t xCount,
-                                      size_t xTail )
+static size_t prvContiguousBytes( const StreamBuffer_t * const pxStreamBuffer )
 {
-    size_t xFirstLength;
+    size_t xCount;
 
-    configASSERT( xCount != ( size_t ) 0 );
+    xCount = prvBytesInBuffer( pxStreamBuffer );
 
-    /* Calculate the number of bytes that can be read - which may be
-     * less than the number wanted if the data wraps around to the start of
-     * the buffer. */
-    xFirstLength = configMIN( pxStreamBuffer->xLength - xTail, xCount );
+    return configMIN( xCount, pxStreamBuffer->xLength - pxStreamBuffer->xTail );
+}
+/*-----------------------------------------------------------*/
 
-    /* Obtain the number of bytes it is possible to obtain in the first
-     * read.  Asserts check bounds of read and write. */
-    configASSERT( xFirstLength <= xCount );
-    configASSERT( ( xTail + xFirstLength ) <= pxStreamBuffer->xLength );
-    ( void ) memcpy( ( void * ) pucData, ( const void * ) &( pxStreamBuffer->pucBuffer[ xTail ] ), xFirstLength );
+static size_t prvTxVectorLength( const StreamBufferTxVector_t * pxVectors,
+                                 size_t xVectorCount )
+{
+    size_t xLength = 0;
+    size_t x;
 
-    /* If the total number of wanted bytes is greater than the number
-     * that could be read in the first read... */
-    if( xCount > xFirstLength )
-    {
-        /* ...then read the remaining bytes from the start of the buffer. */
-        ( void ) memcpy( ( void * ) &( pucData[ xFirstLength ] ), ( void * ) ( pxStreamBuffer->pucBuffer ), xCount - xFirstLength );
-    }
-    else
+    for( x = 0; x < xVectorCount; x++ )
     {
-        mtCOVERAGE_TEST_MARKER();
-    }
+        /* Overflow? */
+        configASSERT( ( xLength + pxVectors[ x ].xLength ) >= xLength );
 
-    /* Move the tail pointer to effectively remove the data read from the buffer. */
-    xTail += xCount;
+        /* Only an empty fragment may omit its data. */
+        configASSERT( ( pxVectors[ x ].pvData != NULL ) || ( pxVectors[ x ].xLength == ( size_t ) 0 ) );
 
-    if( xTail >= pxStreamBuffer->xLength )
-    {
-        xTail -= pxStreamBuffer->xLength;
+        xLength += pxVectors[ x ].xLength;
     }
 
-    return xTail;
+    return xLength;
 }
 /*-----------------------------------------------------------*/
 
-static size_t prvBytesInBuffer( const StreamBuffer_t * const pxStreamBuffer )
+static size_t prvRxVectorLength( const StreamBufferRxVector_t * pxVectors,
+                                 size_t xVectorCount )
 {
-    /* Returns the distance between xTail and xHead. */
-    size_t xCount;
-
-    xCount = pxStreamBuffer->xLength + pxStreamBuffer->xHead;
-    xCount -= pxStreamBuffer->xTail;
+    size_t xLength = 0;
+    size_t x;
 
-    if( xCount >= pxStreamBuffer->xLength )
-    {
-        xCount -= pxStreamBuffer->xLength;
-    }
-    else
+    for( x = 0; x < xVectorCount; x++ )
     {
-        mtCOVERAGE_TEST_MARKER();
+        /* Overflow? */
+        configASSERT( ( xLength + pxVectors[ x ].xLength ) >= xLength );
+
+        /* Only an empty fragment may omit its buffer. */
+        configASSERT( ( pxVectors[ x ].pvData != NULL ) || ( pxVectors[ x ].xLength == ( size_t ) 0 ) );
+
+        xLength += pxVectors[ x ].xLength;
     }
 
-    return xCount;
+    return xLength;
 }
 /*-----------------------------------------------------------*/
 
@@ -1712,6 +3133,108 @@ void vStreamBufferSetStreamBufferNotificationIndex( StreamBufferHandle_t xStream
     #endif /* configUSE_TRACE_FACILITY */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_WAIT_ANY == 1 )
+
+    BaseType_t xStreamBufferAddToWaitAny( StreamBufferHandle_t xStreamBuffer,
+                                          WaitAnyObject_t * pxObject )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+        size_t xBytesAvailable;
+        BaseType_t xReturn;
+
+        traceENTER_xStreamBufferAddToWaitAny( xStreamBuffer, pxObject );
+
+        configASSERT( pxStreamBuffer );
+
+        /* This function should not be called by application code.  It is
+         * designed for use by pxWaitAny(), and must be called from a critical
+         * section.  The stream buffer is ready under the same condition that
+         * unblocks a task waiting in xStreamBufferReceive(). */
+        vWaitAnyLinkObject( &( pxStreamBuffer->pxWaitAnyObjects ), pxObject );
+        xBytesAvailable = prvBytesInBuffer( pxStreamBuffer );
+        xReturn = ( ( xBytesAvailable != ( size_t ) 0 ) && ( xBytesAvailable >= pxStreamBuffer->xTriggerLevelBytes ) ) ? pdTRUE : pdFALSE;
+
+        traceRETURN_xStreamBufferAddToWaitAny( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    void vStreamBufferRemoveFromWaitAny( StreamBufferHandle_t xStreamBuffer,
+                                         WaitAnyObject_t * pxObject )
+    {
+        StreamBuffer_t * const pxStreamBuffer = xStreamBuffer;
+
+        traceENTER_vStreamBufferRemoveFromWaitAny( xStreamBuffer, pxObject );
+
+        configASSERT( pxStreamBuffer );
+
+        /* Must be called from a critical section. */
+        vWaitAnyUnlinkObject( &( pxStreamBuffer->pxWaitAnyObjects ), pxObject );
+
+        traceRETURN_vStreamBufferRemoveFromWaitAny();
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    static void prvNotifyWaitAny( StreamBuffer_t * const pxStreamBuffer )
+    {
+        /* Any task unblocked here is switched to by xTaskResumeAll() if
+         * necessary, as is done by sbSEND_COMPLETED(). */
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                if( pxStreamBuffer->pxWaitAnyObjects != NULL )
+                {
+                    ( void ) xWaitAnyNotifyReady( pxStreamBuffer->pxWaitAnyObjects, ( EventBits_t ) 0 );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        ( void ) xTaskResumeAll();
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_WAIT_ANY == 1 )
+
+    static BaseType_t prvNotifyWaitAnyFromISR( StreamBuffer_t * const pxStreamBuffer )
+    {
+        UBaseType_t uxSavedInterruptStatus;
+        BaseType_t xReturn = pdFALSE;
+
+        uxSavedInterruptStatus = taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( pxStreamBuffer->pxWaitAnyObjects != NULL )
+            {
+                xReturn = xWaitAnyNotifyReady( pxStreamBuffer->pxWaitAnyObjects, ( EventBits_t ) 0 );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_WAIT_ANY */
+/*-----------------------------------------------------------*/
+
 /* This entire source file will be skipped if the application is not configured
  * to include stream buffer functionality. This #if is closed at the very bottom
  * of this file. If you want to include stream buffers then ensure
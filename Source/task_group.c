@@ -0,0 +1,551 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "task_group.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task group functionality. This #if is closed at the very bottom of
+ * this file. If you want to include task groups then ensure
+ * configUSE_TASK_GROUPS is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_TASK_GROUPS == 1 )
+
+    #if ( configUSE_PREEMPTION == 0 )
+
+/* If the cooperative scheduler is being used then a yield should not be
+ * performed just because a higher priority task has been woken. */
+        #define taskgroupYIELD_IF_USING_PREEMPTION()
+    #else
+        #define taskgroupYIELD_IF_USING_PREEMPTION()    taskYIELD_WITHIN_API()
+    #endif
+
+/*
+ * Members that are ready to run are held in one list per priority, like tasks.
+ * The group task is held in xTaskWaiting while no member is ready.
+ *
+ * uxPriority is the base priority the group task was last given, which is the
+ * priority of the member that is running or, if higher, of the highest
+ * priority member that is ready.  The group task lowers it when it takes a
+ * member to run and when it blocks, and posts raise it, all from within
+ * critical sections.
+ */
+    typedef struct TaskGroupDefinition
+    {
+        List_t xReadyMembers[ configMAX_PRIORITIES ]; /**< Prioritised ready members. */
+        List_t xTaskWaiting;                          /**< Holds the group task while no member is ready. */
+        TaskHandle_t xTask;                           /**< The group task. */
+        UBaseType_t uxTopReadyPriority;               /**< No ready member has a priority above this. */
+        UBaseType_t uxPriority;                       /**< The base priority the group task was last given. */
+    } TaskGroup_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The group task, which runs the members of the group passed in pvParameters.
+ */
+    static portTASK_FUNCTION_PROTO( prvTaskGroupTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*
+ * Initialises the lists of a newly allocated group.
+ */
+    static void prvInitialiseNewGroup( TaskGroup_t * const pxGroup ) PRIVILEGED_FUNCTION;
+
+/*
+ * Removes the highest priority ready member from the ready lists and returns
+ * it, or returns NULL if no member is ready.  Must be called from within a
+ * critical section.
+ */
+    static TaskGroupMember_t * prvTakeReadyMember( TaskGroup_t * const pxGroup ) PRIVILEGED_FUNCTION;
+
+/*
+ * Records the events posted to a member and makes the member ready if it is
+ * not already.  Must be called from within a critical section.  Returns
+ * pdTRUE if the group task needs its priority raised to that of the member.
+ */
+    static BaseType_t prvPostEvents( TaskGroupMember_t * const pxMember,
+                                     uint32_t ulEvents ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_STATIC_ALLOCATION == 1 )
+
+        TaskGroupHandle_t xTaskGroupCreateStatic( const char * const pcName,
+                                                  const configSTACK_DEPTH_TYPE uxStackDepth,
+                                                  StackType_t * const puxStackBuffer,
+                                                  StaticTask_t * const pxTaskBuffer,
+                                                  StaticTaskGroup_t * const pxGroupBuffer )
+        {
+            TaskGroup_t * pxGroup = NULL;
+
+            traceENTER_xTaskGroupCreateStatic( pcName, uxStackDepth, puxStackBuffer, pxTaskBuffer, pxGroupBuffer );
+
+            configASSERT( puxStackBuffer );
+            configASSERT( pxTaskBuffer );
+            configASSERT( pxGroupBuffer );
+
+            #if ( configASSERT_DEFINED == 1 )
+            {
+                /* Sanity check that the size of the structure used to declare a
+                 * variable of type StaticTaskGroup_t equals the size of the real
+                 * group structure. */
+                volatile size_t xSize = sizeof( StaticTaskGroup_t );
+                configASSERT( xSize == sizeof( TaskGroup_t ) );
+            }
+            #endif /* configASSERT_DEFINED */
+
+            if( ( puxStackBuffer != NULL ) && ( pxTaskBuffer != NULL ) && ( pxGroupBuffer != NULL ) )
+            {
+                /* MISRA Ref 11.3.1 [Misaligned access] */
+                /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-113 */
+                /* coverity[misra_c_2012_rule_11_3_violation] */
+                pxGroup = ( TaskGroup_t * ) pxGroupBuffer;
+
+                prvInitialiseNewGroup( pxGroup );
+
+                /* The group task starts at the idle priority and blocks the
+                 * first time it runs, unless a member has been posted to by
+                 * then. */
+                pxGroup->xTask = xTaskCreateStatic( prvTaskGroupTask,
+                                                    pcName,
+                                                    uxStackDepth,
+                                                    ( void * ) pxGroup,
+                                                    tskIDLE_PRIORITY,
+                                                    puxStackBuffer,
+                                                    pxTaskBuffer );
+                configASSERT( pxGroup->xTask );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xTaskGroupCreateStatic( pxGroup );
+
+            return pxGroup;
+        }
+
+    #endif /* configSUPPORT_STATIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    #if ( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+        TaskGroupHandle_t xTaskGroupCreate( const char * const pcName,
+                                            const configSTACK_DEPTH_TYPE uxStackDepth )
+        {
+            TaskGroup_t * pxGroup;
+
+            traceENTER_xTaskGroupCreate( pcName, uxStackDepth );
+
+            /* MISRA Ref 11.5.1 [Malloc memory assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxGroup = ( TaskGroup_t * ) pvPortMalloc( sizeof( TaskGroup_t ) );
+
+            if( pxGroup != NULL )
+            {
+                prvInitialiseNewGroup( pxGroup );
+
+                if( xTaskCreate( prvTaskGroupTask,
+                                 pcName,
+                                 uxStackDepth,
+                                 ( void * ) pxGroup,
+                                 tskIDLE_PRIORITY,
+                                 &( pxGroup->xTask ) ) != pdPASS )
+                {
+                    vPortFree( pxGroup );
+                    pxGroup = NULL;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            traceRETURN_xTaskGroupCreate( pxGroup );
+
+            return pxGroup;
+        }
+
+    #endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+    TaskHandle_t xTaskGroupGetTaskHandle( TaskGroupHandle_t xGroup )
+    {
+        TaskGroup_t * const pxGroup = xGroup;
+
+        traceENTER_xTaskGroupGetTaskHandle( xGroup );
+
+        configASSERT( pxGroup );
+
+        traceRETURN_xTaskGroupGetTaskHandle( pxGroup->xTask );
+
+        return pxGroup->xTask;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGroupAddMember( TaskGroupHandle_t xGroup,
+                              TaskGroupMember_t * pxMember,
+                              TaskGroupMemberFunction_t pxMemberFunction,
+                              void * pvParameters,
+                              UBaseType_t uxPriority )
+    {
+        traceENTER_vTaskGroupAddMember( xGroup, pxMember, pxMemberFunction, pvParameters, uxPriority );
+
+        configASSERT( xGroup );
+        configASSERT( pxMember );
+        configASSERT( pxMemberFunction );
+        configASSERT( uxPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        vListInitialiseItem( &( pxMember->xReadyListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxMember->xReadyListItem ), pxMember );
+        pxMember->pxGroup = xGroup;
+        pxMember->pxMemberFunction = pxMemberFunction;
+        pxMember->pvParameters = pvParameters;
+        pxMember->ulPendingEvents = 0U;
+
+        if( uxPriority >= ( UBaseType_t ) configMAX_PRIORITIES )
+        {
+            pxMember->uxPriority = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+        }
+        else
+        {
+            pxMember->uxPriority = uxPriority;
+        }
+
+        traceRETURN_vTaskGroupAddMember();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGroupPost( TaskGroupMember_t * pxMember,
+                         uint32_t ulEvents )
+    {
+        TaskGroup_t * pxGroup;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_vTaskGroupPost( pxMember, ulEvents );
+
+        configASSERT( pxMember );
+        configASSERT( pxMember->pxGroup );
+        configASSERT( ulEvents != 0U );
+
+        pxGroup = pxMember->pxGroup;
+
+        taskENTER_CRITICAL();
+        {
+            if( prvPostEvents( pxMember, ulEvents ) != pdFALSE )
+            {
+                xYieldRequired = xTaskGroupSetPriority( pxGroup->xTask, pxMember->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( listLIST_IS_EMPTY( &( pxGroup->xTaskWaiting ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxGroup->xTaskWaiting ) ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( xYieldRequired != pdFALSE )
+        {
+            taskgroupYIELD_IF_USING_PREEMPTION();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskGroupPost();
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGroupPostFromISR( TaskGroupMember_t * pxMember,
+                                uint32_t ulEvents,
+                                BaseType_t * const pxHigherPriorityTaskWoken )
+    {
+        TaskGroup_t * pxGroup;
+        BaseType_t xYieldRequired = pdFALSE;
+        UBaseType_t uxSavedInterruptStatus;
+
+        traceENTER_vTaskGroupPostFromISR( pxMember, ulEvents, pxHigherPriorityTaskWoken );
+
+        configASSERT( pxMember );
+        configASSERT( pxMember->pxGroup );
+        configASSERT( ulEvents != 0U );
+
+        /* RTOS ports that support interrupt nesting have the concept of a
+         * maximum system call (or maximum API call) interrupt priority.
+         * Interrupts that are above the maximum system call priority are keep
+         * permanently enabled, even when the RTOS kernel is in a critical section,
+         * but cannot make any calls to FreeRTOS API functions. */
+        portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+        pxGroup = pxMember->pxGroup;
+
+        /* MISRA Ref 4.7.1 [Return value shall be checked] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#dir-47 */
+        /* coverity[misra_c_2012_directive_4_7_violation] */
+        uxSavedInterruptStatus = ( UBaseType_t ) taskENTER_CRITICAL_FROM_ISR();
+        {
+            if( prvPostEvents( pxMember, ulEvents ) != pdFALSE )
+            {
+                xYieldRequired = xTaskGroupRaisePriorityFromISR( pxGroup->xTask, pxMember->uxPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( listLIST_IS_EMPTY( &( pxGroup->xTaskWaiting ) ) == pdFALSE )
+            {
+                if( xTaskRemoveFromEventList( &( pxGroup->xTaskWaiting ) ) != pdFALSE )
+                {
+                    xYieldRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL_FROM_ISR( uxSavedInterruptStatus );
+
+        if( ( xYieldRequired != pdFALSE ) && ( pxHigherPriorityTaskWoken != NULL ) )
+        {
+            *pxHigherPriorityTaskWoken = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskGroupPostFromISR();
+    }
+/*-----------------------------------------------------------*/
+
+    static portTASK_FUNCTION( prvTaskGroupTask, pvParameters )
+    {
+        /* MISRA Ref 11.5.6 [Void pointer assignment] */
+        /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+        /* coverity[misra_c_2012_rule_11_5_violation] */
+        TaskGroup_t * const pxGroup = ( TaskGroup_t * ) pvParameters;
+        TaskGroupMember_t * pxMember;
+        uint32_t ulEvents = 0U;
+        BaseType_t xYieldRequired;
+        BaseType_t xAlreadyYielded;
+
+        for( ; configCONTROL_INFINITE_LOOP(); )
+        {
+            xYieldRequired = pdFALSE;
+
+            vTaskSuspendAll();
+            {
+                taskENTER_CRITICAL();
+                {
+                    pxMember = prvTakeReadyMember( pxGroup );
+
+                    if( pxMember != NULL )
+                    {
+                        ulEvents = pxMember->ulPendingEvents;
+                        pxMember->ulPendingEvents = 0U;
+
+                        /* Run at the priority of the member, which may be
+                         * lower than the priority of the member that ran
+                         * last.  If a higher priority member becomes ready
+                         * while this one runs then posting it raises the
+                         * priority again. */
+                        pxGroup->uxPriority = pxMember->uxPriority;
+                        xYieldRequired = xTaskGroupSetPriority( pxGroup->xTask, pxGroup->uxPriority );
+                    }
+                    else
+                    {
+                        /* Wait at the idle priority, so the first post after
+                         * the group task unblocks sets its priority to that
+                         * of the member posted to. */
+                        traceBLOCKING_ON_TASK_GROUP( pxGroup );
+                        vTaskPlaceOnEventList( &( pxGroup->xTaskWaiting ), portMAX_DELAY );
+                        pxGroup->uxPriority = tskIDLE_PRIORITY;
+                        ( void ) xTaskGroupSetPriority( pxGroup->xTask, pxGroup->uxPriority );
+                        xYieldRequired = pdTRUE;
+                    }
+                }
+                taskEXIT_CRITICAL();
+            }
+            xAlreadyYielded = xTaskResumeAll();
+
+            if( ( xYieldRequired != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+            {
+                taskYIELD_WITHIN_API();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( pxMember != NULL )
+            {
+                traceTASK_GROUP_MEMBER_RUN( pxMember, ulEvents );
+                pxMember->pxMemberFunction( ulEvents, pxMember->pvParameters );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvInitialiseNewGroup( TaskGroup_t * const pxGroup )
+    {
+        UBaseType_t uxPriority;
+
+        for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+        {
+            vListInitialise( &( pxGroup->xReadyMembers[ uxPriority ] ) );
+        }
+
+        vListInitialise( &( pxGroup->xTaskWaiting ) );
+        pxGroup->xTask = NULL;
+        pxGroup->uxTopReadyPriority = tskIDLE_PRIORITY;
+        pxGroup->uxPriority = tskIDLE_PRIORITY;
+    }
+/*-----------------------------------------------------------*/
+
+    static TaskGroupMember_t * prvTakeReadyMember( TaskGroup_t * const pxGroup )
+    {
+        TaskGroupMember_t * pxMember = NULL;
+        UBaseType_t uxTopPriority = pxGroup->uxTopReadyPriority;
+
+        while( ( uxTopPriority > tskIDLE_PRIORITY ) &&
+               ( listLIST_IS_EMPTY( &( pxGroup->xReadyMembers[ uxTopPriority ] ) ) != pdFALSE ) )
+        {
+            uxTopPriority--;
+        }
+
+        pxGroup->uxTopReadyPriority = uxTopPriority;
+
+        if( listLIST_IS_EMPTY( &( pxGroup->xReadyMembers[ uxTopPriority ] ) ) == pdFALSE )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxMember = listGET_OWNER_OF_HEAD_ENTRY( &( pxGroup->xReadyMembers[ uxTopPriority ] ) );
+            ( void ) uxListRemove( &( pxMember->xReadyListItem ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pxMember;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvPostEvents( TaskGroupMember_t * const pxMember,
+                                     uint32_t ulEvents )
+    {
+        TaskGroup_t * const pxGroup = pxMember->pxGroup;
+        BaseType_t xRaisePriority = pdFALSE;
+
+        pxMember->ulPendingEvents |= ulEvents;
+
+        /* A member that is already ready keeps its place in the ready list.  A
+         * member that is running is made ready again, so it runs once more
+         * after it returns. */
+        if( listLIST_ITEM_CONTAINER( &( pxMember->xReadyListItem ) ) == NULL )
+        {
+            if( pxMember->uxPriority > pxGroup->uxTopReadyPriority )
+            {
+                pxGroup->uxTopReadyPriority = pxMember->uxPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            vListInsertEnd( &( pxGroup->xReadyMembers[ pxMember->uxPriority ] ), &( pxMember->xReadyListItem ) );
+
+            if( pxMember->uxPriority > pxGroup->uxPriority )
+            {
+                pxGroup->uxPriority = pxMember->uxPriority;
+                xRaisePriority = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xRaisePriority;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include task group functionality. If you want to include task groups then
+ * ensure configUSE_TASK_GROUPS is set to 1 in FreeRTOSConfig.h. */
+#endif /* configUSE_TASK_GROUPS == 1 */
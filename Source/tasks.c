@@ -65,6 +65,20 @@
     #include <stdio.h>
 #endif /* configUSE_STATS_FORMATTING_FUNCTIONS == 1 ) */
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* Tasks in the EDF priority band preempt each other by deadline rather than by
+ * priority, so a task also preempts the running task if both are in the band
+ * and it must run first. */
+    #define taskTASK_PREEMPTS_CURRENT( pxTCB )                                      \
+    ( ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority ) ||                       \
+      ( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&          \
+        ( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&       \
+        ( prvEDFRunsBefore( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) )
+#else
+    #define taskTASK_PREEMPTS_CURRENT( pxTCB )    ( ( pxTCB )->uxPriority > pxCurrentTCB->uxPriority )
+#endif
+
 #if ( configUSE_PREEMPTION == 0 )
 
 /* If the cooperative scheduler is being used then a yield should not be
@@ -87,7 +101,7 @@
 
         #define taskYIELD_ANY_CORE_IF_USING_PREEMPTION( pxTCB ) \
     do {                                                        \
-        if( pxCurrentTCB->uxPriority < ( pxTCB )->uxPriority )  \
+        if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )                \
         {                                                       \
             portYIELD_WITHIN_API();                             \
         }                                                       \
@@ -173,6 +187,25 @@
     #define taskRESERVED_TASK_NAME_LENGTH    1U
 #endif /* if ( ( configNUMBER_OF_CORES > 1 ) */
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* Tasks in the EDF priority band are selected by deadline, other priorities
+ * share the processor between their tasks in turn. */
+    #define taskSELECT_TASK_FROM_READY_LIST( uxTopPriority )                                   \
+    do {                                                                                      \
+        if( ( uxTopPriority ) == ( UBaseType_t ) configEDF_PRIORITY )                         \
+        {                                                                                     \
+            pxCurrentTCB = prvEDFSelectTask();                                                \
+        }                                                                                     \
+        else                                                                                  \
+        {                                                                                     \
+            listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+        }                                                                                     \
+    } while( 0 )
+#else
+    #define taskSELECT_TASK_FROM_READY_LIST( uxTopPriority )    listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) )
+#endif
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 /* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -205,7 +238,7 @@
                                                                                          \
         /* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of \
          * the  same priority get an equal share of the processor time. */                    \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) ); \
+        taskSELECT_TASK_FROM_READY_LIST( uxTopPriority );                                     \
         uxTopReadyPriority = uxTopPriority;                                                   \
     } while( 0 ) /* taskSELECT_HIGHEST_PRIORITY_TASK */
     #else /* if ( configNUMBER_OF_CORES == 1 ) */
@@ -240,7 +273,7 @@
         /* Find the highest priority list that contains ready tasks. */                         \
         portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );                          \
         configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 ); \
-        listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );   \
+        taskSELECT_TASK_FROM_READY_LIST( uxTopPriority );                                       \
     } while( 0 )
 
 /*-----------------------------------------------------------*/
@@ -278,16 +311,57 @@
 
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_PER_CORE_READY_LISTS == 1 )
+
+/* Value of xReadyListCore for a task held in the shared ready lists. */
+    #define taskSHARED_READY_LISTS    ( ( BaseType_t ) -1 )
+
+/* A task that may only run on one core is held in the ready lists of that
+ * core, and every other task in the shared ready lists pxReadyTasksLists.  The
+ * highest priority of each core's lists is tracked in uxCoreTopReadyPriority
+ * in the same way as uxTopReadyPriority tracks that of the shared lists. */
+    #define prvGetReadyListForTask( pxTCB, uxPriority )          \
+    ( ( ( pxTCB )->xReadyListCore == taskSHARED_READY_LISTS ) ? \
+      &( pxReadyTasksLists[ ( uxPriority ) ] ) :                \
+      &( pxCoreReadyTasksLists[ ( pxTCB )->xReadyListCore ][ ( uxPriority ) ] ) )
+
+    #define taskRECORD_TASK_READY_PRIORITY( pxTCB )                                            \
+    do {                                                                                       \
+        if( ( pxTCB )->xReadyListCore == taskSHARED_READY_LISTS )                              \
+        {                                                                                      \
+            taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                \
+        }                                                                                      \
+        else if( ( pxTCB )->uxPriority > uxCoreTopReadyPriority[ ( pxTCB )->xReadyListCore ] ) \
+        {                                                                                      \
+            uxCoreTopReadyPriority[ ( pxTCB )->xReadyListCore ] = ( pxTCB )->uxPriority;       \
+        }                                                                                      \
+        else                                                                                   \
+        {                                                                                      \
+            mtCOVERAGE_TEST_MARKER();                                                          \
+        }                                                                                      \
+    } while( 0 )
+
+/* The number of ready tasks of the given priority that the given core may
+ * select. */
+    #define taskREADY_TASKS_FOR_CORE( uxPriority, xCoreID )                   \
+    ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) ) + \
+      listCURRENT_LIST_LENGTH( &( pxCoreReadyTasksLists[ ( xCoreID ) ][ ( uxPriority ) ] ) ) )
+#else
+    #define prvGetReadyListForTask( pxTCB, uxPriority )        ( &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+    #define taskRECORD_TASK_READY_PRIORITY( pxTCB )            taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority )
+    #define taskREADY_TASKS_FOR_CORE( uxPriority, xCoreID )    listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+#endif /* configUSE_PER_CORE_READY_LISTS */
+
 /*
  * Place the task represented by pxTCB into the appropriate ready list for
  * the task.  It is inserted at the end of the list.
  */
-#define prvAddTaskToReadyList( pxTCB )                                                                     \
-    do {                                                                                                   \
-        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                           \
-        taskRECORD_READY_PRIORITY( ( pxTCB )->uxPriority );                                                \
-        listINSERT_END( &( pxReadyTasksLists[ ( pxTCB )->uxPriority ] ), &( ( pxTCB )->xStateListItem ) ); \
-        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                      \
+#define prvAddTaskToReadyList( pxTCB )                                                                             \
+    do {                                                                                                           \
+        traceMOVED_TASK_TO_READY_STATE( pxTCB );                                                                   \
+        taskRECORD_TASK_READY_PRIORITY( pxTCB );                                                                   \
+        listINSERT_END( prvGetReadyListForTask( ( pxTCB ), ( pxTCB )->uxPriority ), &( ( pxTCB )->xStateListItem ) ); \
+        tracePOST_MOVED_TASK_TO_READY_STATE( pxTCB );                                                              \
     } while( 0 )
 /*-----------------------------------------------------------*/
 
@@ -414,6 +488,10 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_MUTEXES == 1 )
         UBaseType_t uxBasePriority; /**< The priority last assigned to the task - used by the priority inheritance mechanism. */
         UBaseType_t uxMutexesHeld;
+
+        #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+            TaskHandle_t volatile * pxMutexHolderWaitedOn; /**< Points to the holder of the mutex the task is blocked on, or NULL, so priority inheritance can follow chains of blocked mutex holders. */
+        #endif
     #endif
 
     #if ( configUSE_APPLICATION_TASK_TAG == 1 )
@@ -450,6 +528,51 @@ typedef struct tskTaskControlBlock       /* The old naming convention is used to
     #if ( configUSE_POSIX_ERRNO == 1 )
         int iTaskErrno;
     #endif
+
+    #if ( configUSE_TASK_GROUPS == 1 )
+        UBaseType_t uxGroupRaisedPriority; /**< The priority an interrupt raised a task group's task to while the task was ready and the scheduler was suspended, or 0. */
+    #endif
+
+    #if ( ( configUSE_EDF_SCHEDULING == 1 ) || ( configUSE_PERIODIC_TASKS == 1 ) )
+        TickType_t xPeriodicRelease;  /**< The release time of the current cycle of a periodic or EDF task. */
+        TickType_t xPeriodicPeriod;   /**< The time between releases, or 0 if the task is not periodic. */
+        TickType_t xPeriodicDeadline; /**< The deadline of each cycle relative to its release. */
+    #endif
+
+    #if ( configUSE_EDF_SCHEDULING == 1 )
+        TickType_t xEDFDeadline; /**< The absolute deadline of the current job of an EDF task. */
+        uint32_t ulEDFDensity;   /**< The share of the processor reserved for the task, in units of 1/65536, or 0 if the task has not been admitted as an EDF task. */
+    #endif
+
+    #if ( configUSE_TASK_BUDGETS == 1 )
+        ListItem_t xBudgetListItem;                                                     /**< Used to reference the task from the list of tasks that have a budget. */
+        TickType_t xBudget;                                                             /**< The processor time the task can use at its priority in each period. */
+        TickType_t xBudgetPeriod;                                                       /**< The time after which consumed budget is replenished, or 0 if the task has no budget. */
+        TickType_t xBudgetRemaining;                                                    /**< The budget not yet consumed. */
+        TickType_t xBudgetConsumed;                                                     /**< The total number of ticks charged to the task since its budget was set. */
+        TickType_t xBudgetLastCharge;                                                   /**< The tick at which the task was last charged. */
+        TickType_t xBudgetReplenishTime[ configTASK_BUDGET_MAX_REPLENISHMENTS ];        /**< When each pending replenishment is due, in the order they are due. */
+        TickType_t xBudgetReplenishAmount[ configTASK_BUDGET_MAX_REPLENISHMENTS ];      /**< The budget each pending replenishment returns. */
+        UBaseType_t uxBudgetReplenishHead;                                              /**< The index of the pending replenishment that is due next. */
+        UBaseType_t uxBudgetReplenishCount;                                             /**< The number of pending replenishments. */
+        UBaseType_t uxBudgetPriority;                                                   /**< The priority of the task while it has budget remaining. */
+        UBaseType_t uxBudgetLowPriority;                                                /**< The priority of the task while its budget is exhausted. */
+        UBaseType_t uxBudgetExhaustions;                                                /**< The number of times the task exhausted its budget. */
+        BaseType_t xBudgetExhausted;                                                    /**< pdTRUE while the task is demoted to uxBudgetLowPriority. */
+    #endif
+
+    #if ( configUSE_PERIODIC_TASKS == 1 )
+        TickType_t xPeriodicMaxResponseTime;                                 /**< The longest time from release to completion of a cycle. */
+        TickType_t xPeriodicMaxLateness;                                     /**< The longest time by which a cycle missed its deadline. */
+        uint32_t ulPeriodicCycles;                                           /**< The number of cycles completed. */
+        uint32_t ulPeriodicDeadlineMisses;                                   /**< The number of cycles that completed after their deadline. */
+        uint32_t ulPeriodicOverruns;                                         /**< The number of cycles that completed after the release of the next cycle. */
+        uint32_t ulPeriodicHistogram[ configPERIODIC_TASK_HISTOGRAM_BUCKETS ]; /**< Cycles counted by response time, the last bucket counting deadline misses. */
+    #endif
+
+    #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+        BaseType_t xReadyListCore; /**< The core whose ready lists hold the task while it is ready, or taskSHARED_READY_LISTS if its affinity allows more than one core. */
+    #endif
 } tskTCB;
 
 /* The old tskTCB name is maintained above then typedefed to the new TCB_t name
@@ -480,6 +603,13 @@ PRIVILEGED_DATA static List_t * volatile pxDelayedTaskList;              /**< Po
 PRIVILEGED_DATA static List_t * volatile pxOverflowDelayedTaskList;      /**< Points to the delayed task list currently being used to hold tasks that have overflowed the current tick count. */
 PRIVILEGED_DATA static List_t xPendingReadyList;                         /**< Tasks that have been readied while the scheduler was suspended.  They will be moved to the ready list when the scheduler is resumed. */
 
+#if ( configUSE_PER_CORE_READY_LISTS == 1 )
+
+    PRIVILEGED_DATA static List_t pxCoreReadyTasksLists[ configNUMBER_OF_CORES ][ configMAX_PRIORITIES ]; /**< Prioritised ready tasks that may only run on one core. */
+    PRIVILEGED_DATA static volatile UBaseType_t uxCoreTopReadyPriority[ configNUMBER_OF_CORES ];          /**< The highest priority of a task in each core's ready lists, or higher. */
+
+#endif
+
 #if ( INCLUDE_vTaskDelete == 1 )
 
     PRIVILEGED_DATA static List_t xTasksWaitingTermination; /**< Tasks that have been deleted - but their memory not yet freed. */
@@ -539,6 +669,38 @@ PRIVILEGED_DATA static volatile configRUN_TIME_COUNTER_TYPE ulTotalRunTime[ conf
 
 #endif
 
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/* The greatest total share of the processor that can be reserved by EDF
+ * tasks, in units of 1/65536. */
+    #define taskEDF_DENSITY_BOUND    ( ( ( uint32_t ) configEDF_UTILISATION_BOUND << 16 ) / 100U )
+
+/* The sum of the shares of the processor reserved by the admitted EDF tasks,
+ * in units of 1/65536. */
+PRIVILEGED_DATA static uint32_t ulEDFTotalDensity = 0U;
+
+#endif
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+PRIVILEGED_DATA static List_t xBudgetedTaskList; /**< Tasks that have a budget, in no particular order. */
+
+#endif
+
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTASK_ARENA_SIZE > 0 ) )
+
+/* The TCBs of dynamically created tasks are taken from this arena, and only
+ * from the heap once it is exhausted. */
+PRIVILEGED_DATA static TCB_t xTaskArenaStorage[ configTASK_ARENA_SIZE ];
+PRIVILEGED_DATA static KernelObjectArena_t xTaskArena = { xTaskArenaStorage, sizeof( TCB_t ), ( UBaseType_t ) configTASK_ARENA_SIZE, ( UBaseType_t ) 0U, NULL };
+
+    #define tskALLOCATE_TCB()       ( ( TCB_t * ) pvTaskAllocateKernelObject( &xTaskArena ) )
+    #define tskFREE_TCB( pxTCB )    vTaskFreeKernelObject( &xTaskArena, ( pxTCB ) )
+#else
+    #define tskALLOCATE_TCB()       ( ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) ) )
+    #define tskFREE_TCB( pxTCB )    vPortFree( pxTCB )
+#endif
+
 /*-----------------------------------------------------------*/
 
 /* File private functions. --------------------------------*/
@@ -568,12 +730,108 @@ static BaseType_t prvCreateIdleTasks( void );
 
 #if ( configNUMBER_OF_CORES > 1 )
 
+/*
+ * Selects the first task in pxReadyList that may run on the given core and is
+ * not running on another core.  Returns pdTRUE if a task was selected.
+ */
+    static BaseType_t prvSelectTaskFromReadyList( const List_t * const pxReadyList,
+                                                  BaseType_t xCoreID,
+                                                  BaseType_t xIdleTasksOnly );
+
 /*
  * Selects the highest priority available task for the given core.
  */
     static void prvSelectHighestPriorityTask( BaseType_t xCoreID );
 #endif /* #if ( configNUMBER_OF_CORES > 1 ) */
 
+#if ( configUSE_PER_CORE_READY_LISTS == 1 )
+
+/*
+ * Sets the ready lists that hold pxTCB from its core affinity mask.  Must not
+ * be called while the task is in a ready list.
+ */
+    static void prvSetReadyListCore( TCB_t * pxTCB );
+#endif
+
+/*
+ * Sets the base priority of a task on behalf of the kernel, for task groups
+ * and task budgets, moving the task to the ready list of its new priority if it
+ * is ready.  Must be called from a critical section, and not from an interrupt
+ * while the scheduler is suspended.  Returns pdTRUE if a yield is required.
+ */
+#if ( ( configUSE_TASK_GROUPS == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) )
+    static BaseType_t prvSetBasePriority( TCB_t * const pxTCB,
+                                          UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+#endif
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) || ( configUSE_PERIODIC_TASKS == 1 ) )
+
+/*
+ * Releases the first cycle of a periodic or EDF task now and clears the timing
+ * recorded for its cycles.  Must be called from a critical section.
+ */
+    static void prvPeriodicStart( TCB_t * const pxTCB,
+                                  TickType_t xPeriod,
+                                  TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+/*
+ * Called by xTaskPeriodicWait() and xTaskEDFWaitForNextPeriod() when the
+ * running task completes a cycle.  Records the response time of the cycle if
+ * configUSE_PERIODIC_TASKS is 1, and sets the deadline of the next job of an
+ * EDF task.  Returns the time by which the cycle missed its deadline, or 0 if
+ * it met it.
+ */
+    static TickType_t prvPeriodicCycleComplete( TCB_t * const pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+/*
+ * Returns pdTRUE if pxTCB must run before pxOtherTCB when both are in the EDF
+ * priority band, that is if its deadline is earlier.  A task that is in the
+ * band without having been admitted, which can only happen through priority
+ * inheritance or vTaskPrioritySet(), runs before the EDF tasks.
+ */
+    static BaseType_t prvEDFRunsBefore( const TCB_t * const pxTCB,
+                                        const TCB_t * const pxOtherTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the task in the ready list of the EDF priority band that must run
+ * first.  The list must not be empty.
+ */
+    static TCB_t * prvEDFSelectTask( void ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns xExecutionTime / xDeadline in units of 1/65536, rounded up.
+ * xExecutionTime must not be greater than xDeadline.
+ */
+    static uint32_t prvEDFDensity( TickType_t xExecutionTime,
+                                   TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Called from xTaskIncrementTick() once xConstTickCount is the new tick count.
+ * Applies the replenishments that are due and charges the tick to the running
+ * task, demoting and restoring the priorities of tasks with a budget as their
+ * budgets are exhausted and replenished.  Returns pdTRUE if a context switch
+ * is required.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    static BaseType_t prvBudgetTick( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+#endif
+
+/*
+ * Applies the replenishments that are due at or before xConstTickCount,
+ * restoring the priorities of tasks whose budget was exhausted.  Must be called
+ * from a critical section or the tick interrupt.  Returns pdTRUE if a context
+ * switch is required.
+ */
+#if ( configUSE_TASK_BUDGETS == 1 )
+    static BaseType_t prvBudgetReplenish( const TickType_t xConstTickCount ) PRIVILEGED_FUNCTION;
+#endif
+
 /**
  * Utility task that simply returns pdTRUE if the task referenced by xTask is
  * currently in the Suspended state, or pdFALSE if the task referenced by xTask
@@ -699,6 +957,41 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait,
  */
 static void prvResetNextTaskUnblockTime( void ) PRIVILEGED_FUNCTION;
 
+#if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) )
+
+/*
+ * Changes the priority of a task that inherited, or is disinheriting, a
+ * priority through a chain of mutex holders, moving it to the ready list of
+ * its new priority if it is in the Ready state.
+ */
+    static void prvSetInheritedPriority( TCB_t * pxTCB,
+                                         UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * If pxTCB is blocked on a mutex then re-sort it within the list of tasks
+ * waiting for the mutex, as its priority has just changed, and return the task
+ * that holds the mutex.  Otherwise return NULL.
+ */
+    static TCB_t * prvGetMutexHolderWaitedOn( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Passes the priority pxTCB has just inherited on to the holder of the mutex
+ * pxTCB is blocked on, if any, and from there along the chain of blocked mutex
+ * holders for up to configPRIORITY_INHERITANCE_DEPTH tasks in total.
+ */
+    static void prvInheritPriorityThroughChain( TCB_t * pxTCB,
+                                                UBaseType_t uxInheritedPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Undoes prvInheritPriorityThroughChain() after the priority of pxTCB has been
+ * lowered, dropping each holder along the chain to the greater of its base
+ * priority and the priority of the highest priority task still waiting for the
+ * mutex it holds.
+ */
+    static void prvDisinheritPriorityThroughChain( TCB_t * pxTCB ) PRIVILEGED_FUNCTION;
+
+#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) ) */
+
 #if ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 )
 
 /*
@@ -1003,23 +1296,111 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
 /*-----------------------------------------------------------*/
 
 #if ( configNUMBER_OF_CORES > 1 )
+    static BaseType_t prvSelectTaskFromReadyList( const List_t * const pxReadyList,
+                                                  BaseType_t xCoreID,
+                                                  BaseType_t xIdleTasksOnly )
+    {
+        const ListItem_t * pxEndMarker = listGET_END_MARKER( pxReadyList );
+        ListItem_t * pxIterator;
+        TCB_t * pxTCB;
+        BaseType_t xTaskScheduled = pdFALSE;
+
+        for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+
+            /* When falling back to the idle priority because only one priority
+             * level is allowed to run at a time, we should ONLY schedule the true
+             * idle tasks, not user tasks at the idle priority. */
+            if( ( xIdleTasksOnly != pdFALSE ) && ( ( pxTCB->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) == 0U ) )
+            {
+                continue;
+            }
+
+            if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+            {
+                #if ( configUSE_CORE_AFFINITY == 1 )
+                    if( ( pxTCB->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID ) ) != 0U )
+                #endif
+                {
+                    /* If the task is not being executed by any core swap it in. */
+                    pxCurrentTCBs[ xCoreID ]->xTaskRunState = taskTASK_NOT_RUNNING;
+                    pxTCB->xTaskRunState = xCoreID;
+                    pxCurrentTCBs[ xCoreID ] = pxTCB;
+                    xTaskScheduled = pdTRUE;
+                }
+            }
+            else if( pxTCB == pxCurrentTCBs[ xCoreID ] )
+            {
+                configASSERT( ( pxTCB->xTaskRunState == xCoreID ) || ( pxTCB->xTaskRunState == taskTASK_SCHEDULED_TO_YIELD ) );
+
+                #if ( configUSE_CORE_AFFINITY == 1 )
+                    if( ( pxTCB->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID ) ) != 0U )
+                #endif
+                {
+                    /* The task is already running on this core, mark it as scheduled. */
+                    pxTCB->xTaskRunState = xCoreID;
+                    xTaskScheduled = pdTRUE;
+                }
+            }
+            else
+            {
+                /* This task is running on the core other than xCoreID. */
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xTaskScheduled != pdFALSE )
+            {
+                /* A task has been selected to run on this core. */
+                break;
+            }
+        }
+
+        return xTaskScheduled;
+    }
+/*-----------------------------------------------------------*/
+
     static void prvSelectHighestPriorityTask( BaseType_t xCoreID )
     {
         UBaseType_t uxCurrentPriority = uxTopReadyPriority;
         BaseType_t xTaskScheduled = pdFALSE;
         BaseType_t xDecrementTopPriority = pdTRUE;
-        TCB_t * pxTCB = NULL;
 
         #if ( configUSE_CORE_AFFINITY == 1 )
-            const TCB_t * pxPreviousTCB = NULL;
+            const TCB_t * const pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
         #endif
         #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
             BaseType_t xPriorityDropped = pdFALSE;
         #endif
+        #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+            BaseType_t xDecrementCoreTopPriority = pdTRUE;
+
+            /* When the task leaving the core came from the core's own ready
+             * lists the shared lists are searched first at each priority, and
+             * the other way round, so tasks of equal priority in the two sets of
+             * lists take turns on the core. */
+            const BaseType_t xSearchSharedListsFirst = ( pxCurrentTCBs[ xCoreID ]->xReadyListCore == xCoreID ) ? pdTRUE : pdFALSE;
+        #endif
 
         /* This function should be called when scheduler is running. */
         configASSERT( xSchedulerRunning == pdTRUE );
 
+        #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+        {
+            if( uxCoreTopReadyPriority[ xCoreID ] > uxCurrentPriority )
+            {
+                uxCurrentPriority = uxCoreTopReadyPriority[ xCoreID ];
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif
+
         /* A new task is created and a running task with the same priority yields
          * itself to run the new task. When a running task yields itself, it is still
          * in the ready list. This running task will be selected before the new task
@@ -1030,11 +1411,11 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
          *
          * To fix these problems, the running task should be put to the end of the
          * ready list before searching for the ready task in the ready list. */
-        if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ),
+        if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxCurrentTCBs[ xCoreID ], pxCurrentTCBs[ xCoreID ]->uxPriority ),
                                      &pxCurrentTCBs[ xCoreID ]->xStateListItem ) == pdTRUE )
         {
             ( void ) uxListRemove( &pxCurrentTCBs[ xCoreID ]->xStateListItem );
-            vListInsertEnd( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ),
+            vListInsertEnd( prvGetReadyListForTask( pxCurrentTCBs[ xCoreID ], pxCurrentTCBs[ xCoreID ]->uxPriority ),
                             &pxCurrentTCBs[ xCoreID ]->xStateListItem );
         }
 
@@ -1052,92 +1433,97 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             }
             #endif
 
-            if( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxCurrentPriority ] ) ) == pdFALSE )
+            #if ( configUSE_PER_CORE_READY_LISTS == 1 )
             {
-                const List_t * const pxReadyList = &( pxReadyTasksLists[ uxCurrentPriority ] );
-                const ListItem_t * pxEndMarker = listGET_END_MARKER( pxReadyList );
-                ListItem_t * pxIterator;
+                const List_t * const pxCoreReadyList = &( pxCoreReadyTasksLists[ xCoreID ][ uxCurrentPriority ] );
+                const List_t * const pxSharedReadyList = &( pxReadyTasksLists[ uxCurrentPriority ] );
 
-                /* The ready task list for uxCurrentPriority is not empty, so uxTopReadyPriority
-                 * must not be decremented any further. */
-                xDecrementTopPriority = pdFALSE;
+                /* The highest ready priority of each set of lists is lowered
+                 * while the search has found all of its lists empty. */
+                if( listLIST_IS_EMPTY( pxCoreReadyList ) == pdFALSE )
+                {
+                    xDecrementCoreTopPriority = pdFALSE;
+                }
+                else if( ( xDecrementCoreTopPriority != pdFALSE ) &&
+                         ( uxCoreTopReadyPriority[ xCoreID ] == uxCurrentPriority ) &&
+                         ( uxCurrentPriority > tskIDLE_PRIORITY ) )
+                {
+                    uxCoreTopReadyPriority[ xCoreID ]--;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+                if( listLIST_IS_EMPTY( pxSharedReadyList ) == pdFALSE )
                 {
-                    /* MISRA Ref 11.5.3 [Void pointer assignment] */
-                    /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
-                    /* coverity[misra_c_2012_rule_11_5_violation] */
-                    pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+                    xDecrementTopPriority = pdFALSE;
+                }
+                else if( ( xDecrementTopPriority != pdFALSE ) &&
+                         ( uxTopReadyPriority == uxCurrentPriority ) &&
+                         ( uxCurrentPriority > tskIDLE_PRIORITY ) )
+                {
+                    uxTopReadyPriority--;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
 
-                    #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
+                if( xSearchSharedListsFirst != pdFALSE )
+                {
+                    xTaskScheduled = prvSelectTaskFromReadyList( pxSharedReadyList, xCoreID, pdFALSE );
+
+                    if( xTaskScheduled == pdFALSE )
                     {
-                        /* When falling back to the idle priority because only one priority
-                         * level is allowed to run at a time, we should ONLY schedule the true
-                         * idle tasks, not user tasks at the idle priority. */
-                        if( uxCurrentPriority < uxTopReadyPriority )
-                        {
-                            if( ( pxTCB->uxTaskAttributes & taskATTRIBUTE_IS_IDLE ) == 0U )
-                            {
-                                continue;
-                            }
-                        }
+                        xTaskScheduled = prvSelectTaskFromReadyList( pxCoreReadyList, xCoreID, pdFALSE );
                     }
-                    #endif /* #if ( configRUN_MULTIPLE_PRIORITIES == 0 ) */
+                }
+                else
+                {
+                    xTaskScheduled = prvSelectTaskFromReadyList( pxCoreReadyList, xCoreID, pdFALSE );
 
-                    if( pxTCB->xTaskRunState == taskTASK_NOT_RUNNING )
+                    if( xTaskScheduled == pdFALSE )
                     {
-                        #if ( configUSE_CORE_AFFINITY == 1 )
-                            if( ( pxTCB->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID ) ) != 0U )
-                        #endif
-                        {
-                            /* If the task is not being executed by any core swap it in. */
-                            pxCurrentTCBs[ xCoreID ]->xTaskRunState = taskTASK_NOT_RUNNING;
-                            #if ( configUSE_CORE_AFFINITY == 1 )
-                                pxPreviousTCB = pxCurrentTCBs[ xCoreID ];
-                            #endif
-                            pxTCB->xTaskRunState = xCoreID;
-                            pxCurrentTCBs[ xCoreID ] = pxTCB;
-                            xTaskScheduled = pdTRUE;
-                        }
+                        xTaskScheduled = prvSelectTaskFromReadyList( pxSharedReadyList, xCoreID, pdFALSE );
                     }
-                    else if( pxTCB == pxCurrentTCBs[ xCoreID ] )
-                    {
-                        configASSERT( ( pxTCB->xTaskRunState == xCoreID ) || ( pxTCB->xTaskRunState == taskTASK_SCHEDULED_TO_YIELD ) );
+                }
+            }
+            #else /* #if ( configUSE_PER_CORE_READY_LISTS == 1 ) */
+            {
+                if( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxCurrentPriority ] ) ) == pdFALSE )
+                {
+                    BaseType_t xIdleTasksOnly = pdFALSE;
 
-                        #if ( configUSE_CORE_AFFINITY == 1 )
-                            if( ( pxTCB->uxCoreAffinityMask & ( ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID ) ) != 0U )
-                        #endif
+                    /* The ready task list for uxCurrentPriority is not empty, so uxTopReadyPriority
+                     * must not be decremented any further. */
+                    xDecrementTopPriority = pdFALSE;
+
+                    #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
+                    {
+                        if( uxCurrentPriority < uxTopReadyPriority )
                         {
-                            /* The task is already running on this core, mark it as scheduled. */
-                            pxTCB->xTaskRunState = xCoreID;
-                            xTaskScheduled = pdTRUE;
+                            xIdleTasksOnly = pdTRUE;
                         }
                     }
-                    else
-                    {
-                        /* This task is running on the core other than xCoreID. */
-                        mtCOVERAGE_TEST_MARKER();
-                    }
+                    #endif /* #if ( configRUN_MULTIPLE_PRIORITIES == 0 ) */
 
-                    if( xTaskScheduled != pdFALSE )
-                    {
-                        /* A task has been selected to run on this core. */
-                        break;
-                    }
+                    xTaskScheduled = prvSelectTaskFromReadyList( &( pxReadyTasksLists[ uxCurrentPriority ] ), xCoreID, xIdleTasksOnly );
                 }
-            }
-            else
-            {
-                if( xDecrementTopPriority != pdFALSE )
+                else
                 {
-                    uxTopReadyPriority--;
-                    #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
+                    if( xDecrementTopPriority != pdFALSE )
                     {
-                        xPriorityDropped = pdTRUE;
+                        uxTopReadyPriority--;
+                        #if ( configRUN_MULTIPLE_PRIORITIES == 0 )
+                        {
+                            xPriorityDropped = pdTRUE;
+                        }
+                        #endif
                     }
-                    #endif
                 }
             }
+            #endif /* #if ( configUSE_PER_CORE_READY_LISTS == 1 ) */
 
             /* There are configNUMBER_OF_CORES Idle tasks created when scheduler started.
              * The scheduler should be able to select a task to run when uxCurrentPriority
@@ -1182,7 +1568,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
         {
             if( xTaskScheduled == pdTRUE )
             {
-                if( ( pxPreviousTCB != NULL ) && ( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxPreviousTCB->uxPriority ] ), &( pxPreviousTCB->xStateListItem ) ) != pdFALSE ) )
+                if( ( pxPreviousTCB != pxCurrentTCBs[ xCoreID ] ) && ( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxPreviousTCB, pxPreviousTCB->uxPriority ), &( pxPreviousTCB->xStateListItem ) ) != pdFALSE ) )
                 {
                     /* A ready task was just evicted from this core. See if it can be
                      * scheduled on any other core. */
@@ -1533,7 +1919,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = tskALLOCATE_TCB();
 
             if( pxNewTCB != NULL )
             {
@@ -1660,7 +2046,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+            pxNewTCB = tskALLOCATE_TCB();
 
             if( pxNewTCB != NULL )
             {
@@ -1677,7 +2063,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 if( pxNewTCB->pxStack == NULL )
                 {
                     /* Could not allocate the stack.  Delete the allocated TCB. */
-                    vPortFree( pxNewTCB );
+                    tskFREE_TCB( pxNewTCB );
                     pxNewTCB = NULL;
                 }
             }
@@ -1698,7 +2084,7 @@ static void prvAddNewTaskToReadyList( TCB_t * pxNewTCB ) PRIVILEGED_FUNCTION;
                 /* MISRA Ref 11.5.1 [Malloc memory assignment] */
                 /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
                 /* coverity[misra_c_2012_rule_11_5_violation] */
-                pxNewTCB = ( TCB_t * ) pvPortMalloc( sizeof( TCB_t ) );
+                pxNewTCB = tskALLOCATE_TCB();
 
                 if( pxNewTCB != NULL )
                 {
@@ -1941,6 +2327,13 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
     listSET_LIST_ITEM_VALUE( &( pxNewTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxPriority );
     listSET_LIST_ITEM_OWNER( &( pxNewTCB->xEventListItem ), pxNewTCB );
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vListInitialiseItem( &( pxNewTCB->xBudgetListItem ) );
+        listSET_LIST_ITEM_OWNER( &( pxNewTCB->xBudgetListItem ), pxNewTCB );
+    }
+    #endif
+
     #if ( portUSING_MPU_WRAPPERS == 1 )
     {
         vPortStoreTaskMPUSettings( &( pxNewTCB->xMPUSettings ), xRegions, pxNewTCB->pxStack, uxStackDepth );
@@ -2164,6 +2557,12 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
             #endif /* configUSE_TRACE_FACILITY */
             traceTASK_CREATE( pxNewTCB );
 
+            #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+            {
+                prvSetReadyListCore( pxNewTCB );
+            }
+            #endif
+
             prvAddTaskToReadyList( pxNewTCB );
 
             portSETUP_TCB( pxNewTCB );
@@ -2256,6 +2655,26 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                 mtCOVERAGE_TEST_MARKER();
             }
 
+            #if ( configUSE_EDF_SCHEDULING == 1 )
+            {
+                /* Return the share of the processor reserved by the task. */
+                ulEDFTotalDensity -= pxTCB->ulEDFDensity;
+            }
+            #endif
+
+            #if ( configUSE_TASK_BUDGETS == 1 )
+            {
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            #endif
+
             /* Increment the uxTaskNumber also so kernel aware debuggers can
              * detect that the task lists need re-generating.  This is done before
              * portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
@@ -2947,7 +3366,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                  * nothing more than change its priority variable. However, if
                  * the task is in a ready list it needs to be removed and placed
                  * in the list appropriate to its new priority. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                 {
                     /* The task is currently in its ready list - remove before
                      * adding it to its new ready list.  As we are in a critical
@@ -3033,6 +3452,23 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 
             pxTCB->uxCoreAffinityMask = uxCoreAffinityMask;
 
+            #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+            {
+                /* A ready task is moved to the ready lists that match its new
+                 * affinity. */
+                if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, pxTCB->uxPriority ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xStateListItem ) );
+                    prvSetReadyListCore( pxTCB );
+                    prvAddTaskToReadyList( pxTCB );
+                }
+                else
+                {
+                    prvSetReadyListCore( pxTCB );
+                }
+            }
+            #endif /* #if ( configUSE_PER_CORE_READY_LISTS == 1 ) */
+
             if( xSchedulerRunning != pdFALSE )
             {
                 if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
@@ -3074,22 +3510,51 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
 #endif /* #if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
-    UBaseType_t vTaskCoreAffinityGet( ConstTaskHandle_t xTask )
+#if ( configUSE_PER_CORE_READY_LISTS == 1 )
+    static void prvSetReadyListCore( TCB_t * pxTCB )
     {
-        const TCB_t * pxTCB;
-        UBaseType_t uxCoreAffinityMask;
+        const UBaseType_t uxCoreMap = ( UBaseType_t ) ( pxTCB->uxCoreAffinityMask & ( ( 1U << configNUMBER_OF_CORES ) - 1U ) );
+        BaseType_t xCoreID;
 
-        traceENTER_vTaskCoreAffinityGet( xTask );
+        pxTCB->xReadyListCore = taskSHARED_READY_LISTS;
 
-        portBASE_TYPE_ENTER_CRITICAL();
+        /* Only a task whose affinity allows exactly one core is held in the
+         * ready lists of that core. */
+        if( ( uxCoreMap != 0U ) && ( ( uxCoreMap & ( uxCoreMap - 1U ) ) == 0U ) )
         {
-            pxTCB = prvGetTCBFromHandle( xTask );
-            configASSERT( pxTCB != NULL );
-
-            uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
-        }
-        portBASE_TYPE_EXIT_CRITICAL();
+            for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                if( uxCoreMap == ( ( UBaseType_t ) 1U << ( UBaseType_t ) xCoreID ) )
+                {
+                    pxTCB->xReadyListCore = xCoreID;
+                    break;
+                }
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
+#endif /* #if ( configUSE_PER_CORE_READY_LISTS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( ( configNUMBER_OF_CORES > 1 ) && ( configUSE_CORE_AFFINITY == 1 ) )
+    UBaseType_t vTaskCoreAffinityGet( ConstTaskHandle_t xTask )
+    {
+        const TCB_t * pxTCB;
+        UBaseType_t uxCoreAffinityMask;
+
+        traceENTER_vTaskCoreAffinityGet( xTask );
+
+        portBASE_TYPE_ENTER_CRITICAL();
+        {
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            uxCoreAffinityMask = pxTCB->uxCoreAffinityMask;
+        }
+        portBASE_TYPE_EXIT_CRITICAL();
 
         traceRETURN_vTaskCoreAffinityGet( uxCoreAffinityMask );
 
@@ -3495,7 +3960,7 @@ static void prvInitialiseNewTask( TaskFunction_t pxTaskCode,
                     {
                         /* Ready lists can be accessed so move the task from the
                          * suspended list to the ready list directly. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                         {
                             xYieldRequired = pdTRUE;
 
@@ -3972,6 +4437,20 @@ void vTaskSuspendAll( void )
             {
                 xHigherPriorityReadyTasks = pdTRUE;
             }
+
+            #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+            {
+                BaseType_t xCoreID;
+
+                for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                {
+                    if( uxCoreTopReadyPriority[ xCoreID ] > tskIDLE_PRIORITY )
+                    {
+                        xHigherPriorityReadyTasks = pdTRUE;
+                    }
+                }
+            }
+            #endif
         }
         #else
         {
@@ -4060,14 +4539,36 @@ BaseType_t xTaskResumeAll( void )
                         pxTCB = listGET_OWNER_OF_HEAD_ENTRY( ( &xPendingReadyList ) );
                         listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
                         portMEMORY_BARRIER();
-                        listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
-                        prvAddTaskToReadyList( pxTCB );
+
+                        #if ( configUSE_TASK_GROUPS == 1 )
+                            if( pxTCB->uxGroupRaisedPriority != ( UBaseType_t ) 0U )
+                            {
+                                /* The task was already in a ready list when an
+                                 * interrupt raised its priority, so it only needs
+                                 * to move to the ready list of its new priority. */
+                                if( pxTCB->uxGroupRaisedPriority > pxTCB->uxPriority )
+                                {
+                                    ( void ) prvSetBasePriority( pxTCB, pxTCB->uxGroupRaisedPriority );
+                                }
+                                else
+                                {
+                                    mtCOVERAGE_TEST_MARKER();
+                                }
+
+                                pxTCB->uxGroupRaisedPriority = ( UBaseType_t ) 0U;
+                            }
+                            else
+                        #endif /* configUSE_TASK_GROUPS */
+                        {
+                            listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
+                            prvAddTaskToReadyList( pxTCB );
+                        }
 
                         #if ( configNUMBER_OF_CORES == 1 )
                         {
                             /* If the moved task has a priority higher than the current
                              * task then a yield must be performed. */
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                             {
                                 xYieldPendings[ xCoreID ] = pdTRUE;
                             }
@@ -4343,6 +4844,17 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 uxQueue--;
                 pxTCB = prvSearchForNameWithinSingleList( ( List_t * ) &( pxReadyTasksLists[ uxQueue ] ), pcNameToQuery );
 
+                #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+                {
+                    BaseType_t xCoreID;
+
+                    for( xCoreID = ( BaseType_t ) 0; ( xCoreID < ( BaseType_t ) configNUMBER_OF_CORES ) && ( pxTCB == NULL ); xCoreID++ )
+                    {
+                        pxTCB = prvSearchForNameWithinSingleList( &( pxCoreReadyTasksLists[ xCoreID ][ uxQueue ] ), pcNameToQuery );
+                    }
+                }
+                #endif
+
                 if( pxTCB != NULL )
                 {
                     /* Found the handle. */
@@ -4467,6 +4979,17 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
                 {
                     uxQueue--;
                     uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxReadyTasksLists[ uxQueue ] ), eReady ) );
+
+                    #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+                    {
+                        BaseType_t xCoreID;
+
+                        for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+                        {
+                            uxTask = ( UBaseType_t ) ( uxTask + prvListTasksWithinSingleList( &( pxTaskStatusArray[ uxTask ] ), &( pxCoreReadyTasksLists[ xCoreID ][ uxQueue ] ), eReady ) );
+                        }
+                    }
+                    #endif
                 } while( uxQueue > ( UBaseType_t ) tskIDLE_PRIORITY );
 
                 /* Fill in an TaskStatus_t structure with information on each
@@ -4602,6 +5125,26 @@ char * pcTaskGetName( TaskHandle_t xTaskToQuery )
 
         xTickCount += xTicksToJump;
 
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            /* Return the budget of any replenishments that fell due while the
+             * tick was suppressed, so a demoted task that is woken by the
+             * interrupt that ended the sleep runs at its proper priority. */
+            taskENTER_CRITICAL();
+            {
+                if( prvBudgetReplenish( xTickCount ) != pdFALSE )
+                {
+                    xYieldPendings[ 0 ] = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        #endif /* configUSE_TASK_BUDGETS */
+
         traceINCREASE_TICK_COUNT( xTicksToJump );
         traceRETURN_vTaskStepTick();
     }
@@ -4695,7 +5238,7 @@ BaseType_t xTaskCatchUpTicks( TickType_t xTicksToCatchUp )
                         /* Preemption is on, but a context switch should only be
                          * performed if the unblocked task has a priority that is
                          * higher than the currently executing task. */
-                        if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                        if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                         {
                             /* Pend the yield to be performed when the scheduler
                              * is unsuspended. */
@@ -4846,7 +5389,7 @@ BaseType_t xTaskIncrementTick( void )
                              * processing time (which happens when both
                              * preemption and time slicing are on) is
                              * handled below.*/
-                            if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                            if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                             {
                                 xSwitchRequired = pdTRUE;
                             }
@@ -4888,7 +5431,7 @@ BaseType_t xTaskIncrementTick( void )
 
                 for( xCoreID = 0; xCoreID < ( ( BaseType_t ) configNUMBER_OF_CORES ); xCoreID++ )
                 {
-                    if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCBs[ xCoreID ]->uxPriority ] ) ) > 1U )
+                    if( taskREADY_TASKS_FOR_CORE( pxCurrentTCBs[ xCoreID ]->uxPriority, xCoreID ) > 1U )
                     {
                         xYieldPendings[ xCoreID ] = pdTRUE;
                     }
@@ -4902,6 +5445,23 @@ BaseType_t xTaskIncrementTick( void )
         }
         #endif /* #if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) ) */
 
+        #if ( configUSE_TASK_BUDGETS == 1 )
+        {
+            if( prvBudgetTick( xConstTickCount ) != pdFALSE )
+            {
+                #if ( configUSE_PREEMPTION == 1 )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                #endif
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_TASK_BUDGETS */
+
         #if ( configUSE_TICK_HOOK == 1 )
         {
             /* Guard against the tick hook being called when the pended tick
@@ -5363,6 +5923,30 @@ void vTaskPlaceOnUnorderedEventList( List_t * pxEventList,
 }
 /*-----------------------------------------------------------*/
 
+void vTaskPlaceOnFIFOEventList( List_t * const pxEventList,
+                                const TickType_t xTicksToWait )
+{
+    traceENTER_vTaskPlaceOnFIFOEventList( pxEventList, xTicksToWait );
+
+    configASSERT( pxEventList );
+
+    /* THIS FUNCTION MUST BE CALLED WITH THE
+     * SCHEDULER SUSPENDED AND THE QUEUE BEING ACCESSED LOCKED. */
+
+    /* Place the event list item of the TCB at the end of the event list, so
+     * the task that has waited longest is the first to be woken by the event.
+     * The item value is left holding the task's priority, as for
+     * vTaskPlaceOnEventList(), but is not used to order the list.  The event
+     * list index is never moved from the list end, so listINSERT_END() places
+     * the item after every item already in the list. */
+    listINSERT_END( pxEventList, &( pxCurrentTCB->xEventListItem ) );
+
+    prvAddCurrentTaskToDelayedList( xTicksToWait, pdTRUE );
+
+    traceRETURN_vTaskPlaceOnFIFOEventList();
+}
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_TIMERS == 1 )
 
     void vTaskPlaceOnEventListRestricted( List_t * const pxEventList,
@@ -5457,7 +6041,7 @@ BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList )
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( taskTASK_PREEMPTS_CURRENT( pxUnblockedTCB ) )
         {
             /* Return true if the task removed from the event list has a higher
              * priority than the calling task.  This allows the calling task to know if
@@ -5540,7 +6124,7 @@ void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem,
 
     #if ( configNUMBER_OF_CORES == 1 )
     {
-        if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+        if( taskTASK_PREEMPTS_CURRENT( pxUnblockedTCB ) )
         {
             /* The unblocked task has a priority above that of the calling task, so
              * a context switch is required.  This function is called with the
@@ -5595,6 +6179,75 @@ void vTaskInternalSetTimeOutState( TimeOut_t * const pxTimeOut )
 }
 /*-----------------------------------------------------------*/
 
+#if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( ( configTASK_ARENA_SIZE + configQUEUE_ARENA_SIZE + configTIMER_ARENA_SIZE + configEVENT_GROUP_ARENA_SIZE ) > 0 ) )
+
+    void * pvTaskAllocateKernelObject( KernelObjectArena_t * pxArena )
+    {
+        void * pvReturn;
+
+        taskENTER_CRITICAL();
+        {
+            /* Reuse the most recently freed object first, then objects that
+             * have never been used.  Both are constant time. */
+            pvReturn = pxArena->pvFreeList;
+
+            if( pvReturn != NULL )
+            {
+                pxArena->pvFreeList = *( ( void ** ) pvReturn );
+            }
+            else if( pxArena->uxNextUnused < pxArena->uxObjects )
+            {
+                pvReturn = ( void * ) ( ( ( uint8_t * ) pxArena->pvStorage ) + ( pxArena->xObjectSize * ( size_t ) pxArena->uxNextUnused ) );
+                ( pxArena->uxNextUnused )++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        if( pvReturn == NULL )
+        {
+            /* The arena is exhausted, so fall back to the heap. */
+            pvReturn = pvPortMalloc( pxArena->xObjectSize );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return pvReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskFreeKernelObject( KernelObjectArena_t * pxArena,
+                                void * pvObject )
+    {
+        const portPOINTER_SIZE_TYPE uxStart = ( portPOINTER_SIZE_TYPE ) pxArena->pvStorage;
+        const portPOINTER_SIZE_TYPE uxObject = ( portPOINTER_SIZE_TYPE ) pvObject;
+
+        if( ( uxObject >= uxStart ) &&
+            ( ( uxObject - uxStart ) < ( portPOINTER_SIZE_TYPE ) ( pxArena->xObjectSize * ( size_t ) pxArena->uxObjects ) ) )
+        {
+            configASSERT( ( ( uxObject - uxStart ) % ( portPOINTER_SIZE_TYPE ) pxArena->xObjectSize ) == 0U );
+
+            taskENTER_CRITICAL();
+            {
+                *( ( void ** ) pvObject ) = pxArena->pvFreeList;
+                pxArena->pvFreeList = pvObject;
+            }
+            taskEXIT_CRITICAL();
+        }
+        else
+        {
+            vPortFree( pvObject );
+        }
+    }
+
+#endif /* if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( ( configTASK_ARENA_SIZE + configQUEUE_ARENA_SIZE + configTIMER_ARENA_SIZE + configEVENT_GROUP_ARENA_SIZE ) > 0 ) ) */
+/*-----------------------------------------------------------*/
+
 BaseType_t xTaskCheckForTimeOut( TimeOut_t * const pxTimeOut,
                                  TickType_t * const pxTicksToWait )
 {
@@ -5769,7 +6422,7 @@ void vTaskMissedYield( void )
                  * the ready list at the idle priority contains one more task than the
                  * number of idle tasks, which is equal to the configured numbers of cores
                  * then a task other than the idle task is ready to execute. */
-                if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+                if( taskREADY_TASKS_FOR_CORE( tskIDLE_PRIORITY, portGET_CORE_ID() ) > ( UBaseType_t ) configNUMBER_OF_CORES )
                 {
                     taskYIELD();
                 }
@@ -5858,7 +6511,7 @@ static portTASK_FUNCTION( prvIdleTask, pvParameters )
              * the ready list at the idle priority contains one more task than the
              * number of idle tasks, which is equal to the configured numbers of cores
              * then a task other than the idle task is ready to execute. */
-            if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ tskIDLE_PRIORITY ] ) ) > ( UBaseType_t ) configNUMBER_OF_CORES )
+            if( taskREADY_TASKS_FOR_CORE( tskIDLE_PRIORITY, portGET_CORE_ID() ) > ( UBaseType_t ) configNUMBER_OF_CORES )
             {
                 taskYIELD();
             }
@@ -6082,12 +6735,29 @@ static void prvInitialiseTaskLists( void )
     for( uxPriority = ( UBaseType_t ) 0U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
     {
         vListInitialise( &( pxReadyTasksLists[ uxPriority ] ) );
+
+        #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+        {
+            BaseType_t xCoreID;
+
+            for( xCoreID = ( BaseType_t ) 0; xCoreID < ( BaseType_t ) configNUMBER_OF_CORES; xCoreID++ )
+            {
+                vListInitialise( &( pxCoreReadyTasksLists[ xCoreID ][ uxPriority ] ) );
+            }
+        }
+        #endif
     }
 
     vListInitialise( &xDelayedTaskList1 );
     vListInitialise( &xDelayedTaskList2 );
     vListInitialise( &xPendingReadyList );
 
+    #if ( configUSE_TASK_BUDGETS == 1 )
+    {
+        vListInitialise( &xBudgetedTaskList );
+    }
+    #endif
+
     #if ( INCLUDE_vTaskDelete == 1 )
     {
         vListInitialise( &xTasksWaitingTermination );
@@ -6489,7 +7159,7 @@ static void prvCheckTasksWaitingTermination( void )
             /* The task can only have been allocated dynamically - free both
              * the stack and TCB. */
             vPortFreeStack( pxTCB->pxStack );
-            vPortFree( pxTCB );
+            tskFREE_TCB( pxTCB );
         }
         #elif ( tskSTATIC_AND_DYNAMIC_ALLOCATION_POSSIBLE != 0 )
         {
@@ -6501,13 +7171,13 @@ static void prvCheckTasksWaitingTermination( void )
                 /* Both the stack and TCB were allocated dynamically, so both
                  * must be freed. */
                 vPortFreeStack( pxTCB->pxStack );
-                vPortFree( pxTCB );
+                tskFREE_TCB( pxTCB );
             }
             else if( pxTCB->ucStaticallyAllocated == tskSTATICALLY_ALLOCATED_STACK_ONLY )
             {
                 /* Only the stack was statically allocated, so the TCB is the
                  * only memory that must be freed. */
-                vPortFree( pxTCB );
+                tskFREE_TCB( pxTCB );
             }
             else
             {
@@ -6677,7 +7347,7 @@ static void prvResetNextTaskUnblockTime( void )
 
                 /* If the task being modified is in the ready state it will need
                  * to be moved into a new list. */
-                if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxMutexHolderTCB->uxPriority ] ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
+                if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxMutexHolderTCB, pxMutexHolderTCB->uxPriority ), &( pxMutexHolderTCB->xStateListItem ) ) != pdFALSE )
                 {
                     if( uxListRemove( &( pxMutexHolderTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                     {
@@ -6713,6 +7383,15 @@ static void prvResetNextTaskUnblockTime( void )
 
                 traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
 
+                #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+                {
+                    /* The mutex holder may itself be blocked on a mutex, in
+                     * which case the holder of that mutex must run before it can
+                     * too. */
+                    prvInheritPriorityThroughChain( pxMutexHolderTCB, pxCurrentTCB->uxPriority );
+                }
+                #endif
+
                 /* Inheritance occurred. */
                 xReturn = pdTRUE;
             }
@@ -6910,7 +7589,7 @@ static void prvResetNextTaskUnblockTime( void )
                      * from its current state list if it is in the Ready state as
                      * the task's priority is going to change and there is one
                      * Ready list per priority. */
-                    if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+                    if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE )
                     {
                         if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
                         {
@@ -6940,6 +7619,15 @@ static void prvResetNextTaskUnblockTime( void )
                     {
                         mtCOVERAGE_TEST_MARKER();
                     }
+
+                    #if ( configPRIORITY_INHERITANCE_DEPTH > 1 )
+                    {
+                        /* Any task further along the chain inherited the same
+                         * priority through the mutex holder, so may have to drop
+                         * its priority too. */
+                        prvDisinheritPriorityThroughChain( pxTCB );
+                    }
+                    #endif
                 }
                 else
                 {
@@ -6962,60 +7650,99 @@ static void prvResetNextTaskUnblockTime( void )
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES > 1 )
+#if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) )
 
-/* If not in a critical section then yield immediately.
- * Otherwise set xYieldPendings to true to wait to
- * yield until exiting the critical section.
- */
-    void vTaskYieldWithinAPI( void )
+    void vTaskSetMutexWaitedOn( TaskHandle_t volatile * pxMutexHolder )
     {
-        UBaseType_t ulState;
+        traceENTER_vTaskSetMutexWaitedOn( pxMutexHolder );
 
-        traceENTER_vTaskYieldWithinAPI();
+        pxCurrentTCB->pxMutexHolderWaitedOn = pxMutexHolder;
 
-        ulState = portSET_INTERRUPT_MASK();
+        traceRETURN_vTaskSetMutexWaitedOn();
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvSetInheritedPriority( TCB_t * pxTCB,
+                                         UBaseType_t uxNewPriority )
+    {
+        const UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+        pxTCB->uxPriority = uxNewPriority;
+
+        /* Only reset the event list item value if the value is not being used
+         * for anything else. */
+        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
         {
-            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
 
-            if( portGET_CRITICAL_NESTING_COUNT( xCoreID ) == 0U )
+        /* Every task along the chain but the last is blocked.  The last may be
+         * in any state, but only has to move list if it is Ready. */
+        if( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
             {
-                portYIELD();
+                portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
             }
             else
             {
-                xYieldPendings[ xCoreID ] = pdTRUE;
+                mtCOVERAGE_TEST_MARKER();
             }
-        }
-        portCLEAR_INTERRUPT_MASK( ulState );
 
-        traceRETURN_vTaskYieldWithinAPI();
-    }
-#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+            prvAddTaskToReadyList( pxTCB );
 
+            #if ( configNUMBER_OF_CORES > 1 )
+            {
+                if( uxNewPriority > uxPriorityUsedOnEntry )
+                {
+                    if( taskTASK_IS_RUNNING( pxTCB ) != pdTRUE )
+                    {
+                        prvYieldForTask( pxTCB );
+                    }
+                }
+                else
+                {
+                    if( taskTASK_IS_RUNNING( pxTCB ) == pdTRUE )
+                    {
+                        prvYieldCore( pxTCB->xTaskRunState );
+                    }
+                }
+            }
+            #endif /* if ( configNUMBER_OF_CORES > 1 ) */
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+    }
 /*-----------------------------------------------------------*/
 
-#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
-
-    void vTaskEnterCritical( void )
+    static TCB_t * prvGetMutexHolderWaitedOn( TCB_t * pxTCB )
     {
-        traceENTER_vTaskEnterCritical();
-
-        portDISABLE_INTERRUPTS();
+        List_t * pxEventList;
+        TCB_t * pxMutexHolderTCB = NULL;
 
-        if( xSchedulerRunning != pdFALSE )
+        if( pxTCB->pxMutexHolderWaitedOn != NULL )
         {
-            ( pxCurrentTCB->uxCriticalNesting )++;
+            pxEventList = listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) );
 
-            /* This is not the interrupt safe version of the enter critical
-             * function so  assert() if it is being called from an interrupt
-             * context.  Only API functions that end in "FromISR" can be used in an
-             * interrupt.  Only assert if the critical nesting count is 1 to
-             * protect against recursive calls if the assert function also uses a
-             * critical section. */
-            if( pxCurrentTCB->uxCriticalNesting == 1U )
+            /* The task is only still waiting for the mutex if its event list
+             * item is in the mutex's list of waiting tasks.  If it is in the
+             * pending ready list then the mutex has been given to it already. */
+            if( ( pxEventList != NULL ) && ( pxEventList != &xPendingReadyList ) )
             {
-                portASSERT_IF_IN_ISR();
+                ( void ) uxListRemove( &( pxTCB->xEventListItem ) );
+                vListInsert( pxEventList, &( pxTCB->xEventListItem ) );
+
+                pxMutexHolderTCB = *( pxTCB->pxMutexHolderWaitedOn );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
             }
         }
         else
@@ -7023,21 +7750,165 @@ static void prvResetNextTaskUnblockTime( void )
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskEnterCritical();
+        return pxMutexHolderTCB;
     }
-
-#endif /* #if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
 /*-----------------------------------------------------------*/
 
-#if ( configNUMBER_OF_CORES > 1 )
-
-    void vTaskEnterCritical( void )
+    static void prvInheritPriorityThroughChain( TCB_t * pxTCB,
+                                                UBaseType_t uxInheritedPriority )
     {
-        traceENTER_vTaskEnterCritical();
+        TCB_t * pxMutexHolderTCB = prvGetMutexHolderWaitedOn( pxTCB );
+        UBaseType_t uxDepth = ( UBaseType_t ) 1U;
 
-        portDISABLE_INTERRUPTS();
+        /* The depth limit bounds the time spent here, which is within a
+         * critical section, and also stops the walk if tasks have deadlocked
+         * on each other's mutexes. */
+        while( ( pxMutexHolderTCB != NULL ) &&
+               ( uxDepth < ( UBaseType_t ) configPRIORITY_INHERITANCE_DEPTH ) &&
+               ( pxMutexHolderTCB->uxPriority < uxInheritedPriority ) )
         {
-            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
+            traceTASK_PRIORITY_INHERIT( pxMutexHolderTCB, uxInheritedPriority );
+            prvSetInheritedPriority( pxMutexHolderTCB, uxInheritedPriority );
+
+            pxMutexHolderTCB = prvGetMutexHolderWaitedOn( pxMutexHolderTCB );
+            uxDepth++;
+        }
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvDisinheritPriorityThroughChain( TCB_t * pxTCB )
+    {
+        TCB_t * pxWaitingTCB = pxTCB;
+        TCB_t * pxMutexHolderTCB = prvGetMutexHolderWaitedOn( pxTCB );
+        UBaseType_t uxDepth = ( UBaseType_t ) 1U;
+        UBaseType_t uxPriorityToUse;
+        BaseType_t xContinue = pdTRUE;
+
+        while( ( xContinue != pdFALSE ) &&
+               ( pxMutexHolderTCB != NULL ) &&
+               ( uxDepth < ( UBaseType_t ) configPRIORITY_INHERITANCE_DEPTH ) )
+        {
+            /* As in vTaskPriorityDisinheritAfterTimeout(), only disinherit if
+             * the holder holds no other mutex that may have caused it to
+             * inherit the priority.  The running task cannot have inherited a
+             * priority it is now giving up. */
+            if( ( pxMutexHolderTCB->uxMutexesHeld == ( UBaseType_t ) 1U ) && ( pxMutexHolderTCB != pxCurrentTCB ) )
+            {
+                /* pxWaitingTCB is waiting for the mutex held by
+                 * pxMutexHolderTCB, and was just re-sorted within the list of
+                 * tasks waiting for it, so the head of that list is the highest
+                 * priority task still waiting. */
+                uxPriorityToUse = ( UBaseType_t ) ( ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) listGET_ITEM_VALUE_OF_HEAD_ENTRY( listLIST_ITEM_CONTAINER( &( pxWaitingTCB->xEventListItem ) ) ) );
+
+                if( uxPriorityToUse < pxMutexHolderTCB->uxBasePriority )
+                {
+                    uxPriorityToUse = pxMutexHolderTCB->uxBasePriority;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( uxPriorityToUse < pxMutexHolderTCB->uxPriority )
+                {
+                    traceTASK_PRIORITY_DISINHERIT( pxMutexHolderTCB, uxPriorityToUse );
+                    prvSetInheritedPriority( pxMutexHolderTCB, uxPriorityToUse );
+
+                    pxWaitingTCB = pxMutexHolderTCB;
+                    pxMutexHolderTCB = prvGetMutexHolderWaitedOn( pxMutexHolderTCB );
+                    uxDepth++;
+                }
+                else
+                {
+                    xContinue = pdFALSE;
+                }
+            }
+            else
+            {
+                xContinue = pdFALSE;
+            }
+        }
+    }
+
+#endif /* if ( ( configUSE_MUTEXES == 1 ) && ( configPRIORITY_INHERITANCE_DEPTH > 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+/* If not in a critical section then yield immediately.
+ * Otherwise set xYieldPendings to true to wait to
+ * yield until exiting the critical section.
+ */
+    void vTaskYieldWithinAPI( void )
+    {
+        UBaseType_t ulState;
+
+        traceENTER_vTaskYieldWithinAPI();
+
+        ulState = portSET_INTERRUPT_MASK();
+        {
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
+
+            if( portGET_CRITICAL_NESTING_COUNT( xCoreID ) == 0U )
+            {
+                portYIELD();
+            }
+            else
+            {
+                xYieldPendings[ xCoreID ] = pdTRUE;
+            }
+        }
+        portCLEAR_INTERRUPT_MASK( ulState );
+
+        traceRETURN_vTaskYieldWithinAPI();
+    }
+#endif /* #if ( configNUMBER_OF_CORES > 1 ) */
+
+/*-----------------------------------------------------------*/
+
+#if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) )
+
+    void vTaskEnterCritical( void )
+    {
+        traceENTER_vTaskEnterCritical();
+
+        portDISABLE_INTERRUPTS();
+
+        if( xSchedulerRunning != pdFALSE )
+        {
+            ( pxCurrentTCB->uxCriticalNesting )++;
+
+            /* This is not the interrupt safe version of the enter critical
+             * function so  assert() if it is being called from an interrupt
+             * context.  Only API functions that end in "FromISR" can be used in an
+             * interrupt.  Only assert if the critical nesting count is 1 to
+             * protect against recursive calls if the assert function also uses a
+             * critical section. */
+            if( pxCurrentTCB->uxCriticalNesting == 1U )
+            {
+                portASSERT_IF_IN_ISR();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskEnterCritical();
+    }
+
+#endif /* #if ( ( portCRITICAL_NESTING_IN_TCB == 1 ) && ( configNUMBER_OF_CORES == 1 ) ) */
+/*-----------------------------------------------------------*/
+
+#if ( configNUMBER_OF_CORES > 1 )
+
+    void vTaskEnterCritical( void )
+    {
+        traceENTER_vTaskEnterCritical();
+
+        portDISABLE_INTERRUPTS();
+        {
+            const BaseType_t xCoreID = ( BaseType_t ) portGET_CORE_ID();
 
             if( xSchedulerRunning != pdFALSE )
             {
@@ -7614,87 +8485,1161 @@ static void prvResetNextTaskUnblockTime( void )
                                 #endif /* ifdef portLU_PRINTF_SPECIFIER_REQUIRED */
                             }
 
-                            uxCharsWrittenBySnprintf = prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
-                            uxConsumedBufferLength += uxCharsWrittenBySnprintf;
-                            pcWriteBuffer += uxCharsWrittenBySnprintf;
-                        }
-                        else
-                        {
-                            xOutputBufferFull = pdTRUE;
-                        }
-                    }
-                    else
-                    {
-                        xOutputBufferFull = pdTRUE;
-                    }
+                            uxCharsWrittenBySnprintf = prvSnprintfReturnValueToCharsWritten( iSnprintfReturnValue, uxBufferLength - uxConsumedBufferLength );
+                            uxConsumedBufferLength += uxCharsWrittenBySnprintf;
+                            pcWriteBuffer += uxCharsWrittenBySnprintf;
+                        }
+                        else
+                        {
+                            xOutputBufferFull = pdTRUE;
+                        }
+                    }
+                    else
+                    {
+                        xOutputBufferFull = pdTRUE;
+                    }
+
+                    if( xOutputBufferFull == pdTRUE )
+                    {
+                        break;
+                    }
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
+             * is 0 then vPortFree() will be #defined to nothing. */
+            vPortFree( pxTaskStatusArray );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_vTaskGetRunTimeStatistics();
+    }
+
+#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+/*-----------------------------------------------------------*/
+
+TickType_t uxTaskResetEventItemValue( void )
+{
+    TickType_t uxReturn;
+
+    traceENTER_uxTaskResetEventItemValue();
+
+    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+
+    /* Reset the event list item to its normal value - so it can be used with
+     * queues and semaphores. */
+    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) );
+
+    traceRETURN_uxTaskResetEventItemValue( uxReturn );
+
+    return uxReturn;
+}
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_MUTEXES == 1 )
+
+    TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_pvTaskIncrementMutexHeldCount();
+
+        pxTCB = pxCurrentTCB;
+
+        /* If xSemaphoreCreateMutex() is called before any tasks have been created
+         * then pxCurrentTCB will be NULL. */
+        if( pxTCB != NULL )
+        {
+            ( pxTCB->uxMutexesHeld )++;
+        }
+
+        traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB );
+
+        return pxTCB;
+    }
+
+#endif /* configUSE_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_LIGHT_MUTEXES == 1 )
+
+    BaseType_t xTaskDecrementMutexHeldCount( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xTaskDecrementMutexHeldCount();
+
+        configASSERT( pxTCB->uxMutexesHeld );
+
+        /* The held count is only ever updated by the task that owns it, so a
+         * critical section is only needed if the task's priority has to be
+         * restored, which xTaskPriorityDisinherit() does by moving the task
+         * between the ready lists. */
+        if( pxTCB->uxPriority == pxTCB->uxBasePriority )
+        {
+            ( pxTCB->uxMutexesHeld )--;
+        }
+        else
+        {
+            taskENTER_CRITICAL();
+            {
+                xReturn = xTaskPriorityDisinherit( pxTCB );
+            }
+            taskEXIT_CRITICAL();
+        }
+
+        traceRETURN_xTaskDecrementMutexHeldCount( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskPriorityRaiseToCeiling( uxCeilingPriority );
+
+        configASSERT( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        taskENTER_CRITICAL();
+        {
+            pxTCB = pxCurrentTCB;
+
+            /* A task whose base priority is above the ceiling of a mutex should
+             * not be using the mutex, as the ceiling must be at least the
+             * priority of every task that takes it. */
+            configASSERT( pxTCB->uxBasePriority <= uxCeilingPriority );
+
+            if( pxTCB->uxPriority < uxCeilingPriority )
+            {
+                if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
+                {
+                    listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                /* The calling task is running, so is in the ready list of its
+                 * current priority.  Raising its priority cannot cause it to be
+                 * preempted, so no yield is required. */
+                if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+                {
+                    portRESET_READY_PRIORITY( pxTCB->uxPriority, uxTopReadyPriority );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                traceTASK_PRIORITY_INHERIT( pxTCB, uxCeilingPriority );
+                pxTCB->uxPriority = uxCeilingPriority;
+                prvAddTaskToReadyList( pxTCB );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskPriorityRaiseToCeiling();
+    }
+
+#endif /* configUSE_LIGHT_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_TASK_GROUPS == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) )
+
+    static BaseType_t prvSetBasePriority( TCB_t * const pxTCB,
+                                          UBaseType_t uxNewPriority )
+    {
+        UBaseType_t uxPriorityUsedOnEntry;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        if( uxNewPriority > pxTCB->uxPriority )
+        {
+            /* Raising the priority of the running task cannot cause it to be
+             * preempted. */
+            if( ( pxTCB != pxCurrentTCB ) && ( uxNewPriority > pxCurrentTCB->uxPriority ) )
+            {
+                xYieldRequired = pdTRUE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else if( pxTCB == pxCurrentTCB )
+        {
+            /* Setting the priority of the running task down means there may
+             * now be another task of higher priority that is ready to run. */
+            xYieldRequired = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Remember the ready list the task might be referenced from before its
+         * uxPriority member is changed. */
+        uxPriorityUsedOnEntry = pxTCB->uxPriority;
+
+        #if ( configUSE_MUTEXES == 1 )
+        {
+            /* As in vTaskPrioritySet(), an inherited priority is only replaced
+             * by a higher one. */
+            if( ( pxTCB->uxBasePriority == pxTCB->uxPriority ) || ( uxNewPriority > pxTCB->uxPriority ) )
+            {
+                pxTCB->uxPriority = uxNewPriority;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->uxBasePriority = uxNewPriority;
+        }
+        #else /* if ( configUSE_MUTEXES == 1 ) */
+        {
+            pxTCB->uxPriority = uxNewPriority;
+        }
+        #endif /* if ( configUSE_MUTEXES == 1 ) */
+
+        if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == ( ( TickType_t ) 0U ) )
+        {
+            listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ) );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* A task that is blocked or suspended only needs its priority variable
+         * changed, but a task that is ready must move to the ready list of its
+         * new priority. */
+        if( ( pxTCB->uxPriority != uxPriorityUsedOnEntry ) &&
+            ( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, uxPriorityUsedOnEntry ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+        {
+            if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+            {
+                portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            prvAddTaskToReadyList( pxTCB );
+        }
+        else
+        {
+            /* Only a task in a ready list can preempt the running task. */
+            if( pxTCB != pxCurrentTCB )
+            {
+                xYieldRequired = pdFALSE;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xYieldRequired;
+    }
+
+#endif /* ( configUSE_TASK_GROUPS == 1 ) || ( configUSE_TASK_BUDGETS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_GROUPS == 1 )
+
+
+    BaseType_t xTaskGroupSetPriority( TaskHandle_t xTask,
+                                      UBaseType_t uxNewPriority )
+    {
+        TCB_t * const pxTCB = xTask;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xTaskGroupSetPriority( xTask, uxNewPriority );
+
+        configASSERT( pxTCB );
+        configASSERT( uxNewPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        #if ( configUSE_MUTEXES == 1 )
+            if( pxTCB->uxBasePriority != uxNewPriority )
+        #else
+            if( pxTCB->uxPriority != uxNewPriority )
+        #endif
+        {
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+            /* Called from a task within a critical section, so the ready lists
+             * can be accessed even if the scheduler is suspended. */
+            xReturn = prvSetBasePriority( pxTCB, uxNewPriority );
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskGroupSetPriority( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskGroupRaisePriorityFromISR( TaskHandle_t xTask,
+                                               UBaseType_t uxNewPriority )
+    {
+        TCB_t * const pxTCB = xTask;
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xTaskGroupRaisePriorityFromISR( xTask, uxNewPriority );
+
+        configASSERT( pxTCB );
+        configASSERT( uxNewPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        if( uxNewPriority > pxTCB->uxPriority )
+        {
+            traceTASK_PRIORITY_SET( pxTCB, uxNewPriority );
+
+            if( ( uxSchedulerSuspended != ( UBaseType_t ) 0U ) &&
+                ( listIS_CONTAINED_WITHIN( prvGetReadyListForTask( pxTCB, pxTCB->uxPriority ), &( pxTCB->xStateListItem ) ) != pdFALSE ) )
+            {
+                /* The ready lists cannot be accessed from an interrupt while
+                 * the scheduler is suspended.  The event list item of a ready
+                 * task is not in use, so place it in the pending ready list,
+                 * and let xTaskResumeAll() move the task to the ready list of
+                 * its raised priority. */
+                if( uxNewPriority > pxTCB->uxGroupRaisedPriority )
+                {
+                    pxTCB->uxGroupRaisedPriority = uxNewPriority;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( listIS_CONTAINED_WITHIN( &xPendingReadyList, &( pxTCB->xEventListItem ) ) == pdFALSE )
+                {
+                    listINSERT_END( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( uxNewPriority > pxCurrentTCB->uxPriority )
+                {
+                    xReturn = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                xReturn = prvSetBasePriority( pxTCB, uxNewPriority );
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskGroupRaisePriorityFromISR( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_TASK_GROUPS */
+/*-----------------------------------------------------------*/
+
+#if ( ( configUSE_EDF_SCHEDULING == 1 ) || ( configUSE_PERIODIC_TASKS == 1 ) )
+
+    static void prvPeriodicStart( TCB_t * const pxTCB,
+                                  TickType_t xPeriod,
+                                  TickType_t xDeadline )
+    {
+        pxTCB->xPeriodicRelease = xTickCount;
+        pxTCB->xPeriodicPeriod = xPeriod;
+        pxTCB->xPeriodicDeadline = xDeadline;
+
+        #if ( configUSE_PERIODIC_TASKS == 1 )
+        {
+            UBaseType_t uxBucket;
+
+            pxTCB->xPeriodicMaxResponseTime = ( TickType_t ) 0U;
+            pxTCB->xPeriodicMaxLateness = ( TickType_t ) 0U;
+            pxTCB->ulPeriodicCycles = 0U;
+            pxTCB->ulPeriodicDeadlineMisses = 0U;
+            pxTCB->ulPeriodicOverruns = 0U;
+
+            for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) configPERIODIC_TASK_HISTOGRAM_BUCKETS; uxBucket++ )
+            {
+                pxTCB->ulPeriodicHistogram[ uxBucket ] = 0U;
+            }
+        }
+        #endif /* configUSE_PERIODIC_TASKS */
+    }
+/*-----------------------------------------------------------*/
+
+    static TickType_t prvPeriodicCycleComplete( TCB_t * const pxTCB )
+    {
+        TickType_t xResponseTime;
+        TickType_t xLateness = ( TickType_t ) 0U;
+
+        /* A cycle that completes during the tick of its deadline meets the
+         * deadline. */
+        xResponseTime = xTickCount - pxTCB->xPeriodicRelease;
+
+        if( xResponseTime > pxTCB->xPeriodicDeadline )
+        {
+            xLateness = xResponseTime - pxTCB->xPeriodicDeadline;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        #if ( configUSE_PERIODIC_TASKS == 1 )
+        {
+            TickType_t xBucketWidth;
+            UBaseType_t uxBucket;
+
+            if( xLateness != ( TickType_t ) 0U )
+            {
+                pxTCB->ulPeriodicDeadlineMisses++;
+                uxBucket = ( UBaseType_t ) configPERIODIC_TASK_HISTOGRAM_BUCKETS - ( UBaseType_t ) 1U;
+
+                if( xLateness > pxTCB->xPeriodicMaxLateness )
+                {
+                    pxTCB->xPeriodicMaxLateness = xLateness;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                /* The buckets other than the last divide the time from release
+                 * to deadline evenly.  Their width is the deadline divided by
+                 * their number, rounded up, and bucket n counts the response
+                 * times above n widths and up to n + 1 widths.  A response
+                 * time of 0 is counted in the first bucket. */
+                xBucketWidth = pxTCB->xPeriodicDeadline / ( ( TickType_t ) configPERIODIC_TASK_HISTOGRAM_BUCKETS - ( TickType_t ) 1U );
+
+                if( ( pxTCB->xPeriodicDeadline % ( ( TickType_t ) configPERIODIC_TASK_HISTOGRAM_BUCKETS - ( TickType_t ) 1U ) ) != ( TickType_t ) 0U )
+                {
+                    xBucketWidth++;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( xResponseTime == ( TickType_t ) 0U )
+                {
+                    uxBucket = ( UBaseType_t ) 0U;
+                }
+                else
+                {
+                    uxBucket = ( UBaseType_t ) ( ( xResponseTime - ( TickType_t ) 1U ) / xBucketWidth );
+                }
+            }
+
+            if( xResponseTime > pxTCB->xPeriodicPeriod )
+            {
+                /* The next cycle was released before this one completed, so it
+                 * starts late. */
+                pxTCB->ulPeriodicOverruns++;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            if( xResponseTime > pxTCB->xPeriodicMaxResponseTime )
+            {
+                pxTCB->xPeriodicMaxResponseTime = xResponseTime;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+
+            pxTCB->ulPeriodicHistogram[ uxBucket ]++;
+            pxTCB->ulPeriodicCycles++;
+        }
+        #endif /* configUSE_PERIODIC_TASKS */
+
+        #if ( configUSE_EDF_SCHEDULING == 1 )
+        {
+            if( pxTCB->ulEDFDensity != 0U )
+            {
+                /* Set the deadline of the next job before the task blocks, so
+                 * the deadline is in place when the release makes the task
+                 * ready. */
+                pxTCB->xEDFDeadline = pxTCB->xPeriodicRelease + pxTCB->xPeriodicPeriod + pxTCB->xPeriodicDeadline;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        #endif /* configUSE_EDF_SCHEDULING */
+
+        return xLateness;
+    }
+
+#endif /* ( configUSE_EDF_SCHEDULING == 1 ) || ( configUSE_PERIODIC_TASKS == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_EDF_SCHEDULING == 1 )
+
+    static BaseType_t prvEDFRunsBefore( const TCB_t * const pxTCB,
+                                        const TCB_t * const pxOtherTCB )
+    {
+        BaseType_t xReturn;
+
+        if( pxOtherTCB->ulEDFDensity == 0U )
+        {
+            xReturn = pdFALSE;
+        }
+        else if( pxTCB->ulEDFDensity == 0U )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            /* Deadlines are compared by their distance apart so the comparison
+             * remains correct when the tick count overflows, which it does as
+             * long as no two deadlines are more than half the range of
+             * TickType_t apart. */
+            if( ( ( TickType_t ) ( pxOtherTCB->xEDFDeadline - pxTCB->xEDFDeadline ) - ( TickType_t ) 1U ) < ( portMAX_DELAY >> 1 ) )
+            {
+                xReturn = pdTRUE;
+            }
+            else
+            {
+                xReturn = pdFALSE;
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    static TCB_t * prvEDFSelectTask( void )
+    {
+        const List_t * const pxList = &( pxReadyTasksLists[ configEDF_PRIORITY ] );
+        const ListItem_t * pxIterator;
+        const ListItem_t * const pxEndMarker = listGET_END_MARKER( pxList );
+        TCB_t * pxTCB;
+        TCB_t * pxSelectedTCB = NULL;
+
+        /* The band is expected to hold few ready tasks, so it is searched
+         * rather than kept sorted by deadline. */
+        for( pxIterator = listGET_HEAD_ENTRY( pxList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            if( ( pxSelectedTCB == NULL ) || ( prvEDFRunsBefore( pxTCB, pxSelectedTCB ) != pdFALSE ) )
+            {
+                pxSelectedTCB = pxTCB;
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        configASSERT( pxSelectedTCB != NULL );
+
+        return pxSelectedTCB;
+    }
+/*-----------------------------------------------------------*/
+
+    static uint32_t prvEDFDensity( TickType_t xExecutionTime,
+                                   TickType_t xDeadline )
+    {
+        /* Scale both times down until the deadline fits in 16 bits, rounding
+         * the execution time up so the density is never underestimated. */
+        while( xDeadline > ( TickType_t ) 0xFFFFU )
+        {
+            xExecutionTime = ( xExecutionTime >> 1 ) + ( xExecutionTime & ( TickType_t ) 1U );
+            xDeadline >>= 1;
+        }
+
+        if( xExecutionTime > xDeadline )
+        {
+            xExecutionTime = xDeadline;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return ( ( ( uint32_t ) xExecutionTime << 16 ) + ( uint32_t ) xDeadline - 1U ) / ( uint32_t ) xDeadline;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskEDFAdmit( TaskHandle_t xTask,
+                              TickType_t xExecutionTime,
+                              TickType_t xRelativeDeadline,
+                              TickType_t xPeriod )
+    {
+        TCB_t * pxTCB;
+        TickType_t xDensityDeadline;
+        uint32_t ulDensity = 0U;
+        uint32_t ulOtherDensity;
+        BaseType_t xReturn = pdFAIL;
+
+        traceENTER_xTaskEDFAdmit( xTask, xExecutionTime, xRelativeDeadline, xPeriod );
+
+        configASSERT( xExecutionTime > ( TickType_t ) 0U );
+        configASSERT( xRelativeDeadline > ( TickType_t ) 0U );
+        configASSERT( xPeriod > ( TickType_t ) 0U );
+
+        /* The density test below is sufficient for deadlines shorter than
+         * the period, and exact for deadlines equal to the period. */
+        if( xRelativeDeadline < xPeriod )
+        {
+            xDensityDeadline = xRelativeDeadline;
+        }
+        else
+        {
+            xDensityDeadline = xPeriod;
+        }
+
+        if( ( xExecutionTime > ( TickType_t ) 0U ) &&
+            ( xExecutionTime <= xDensityDeadline ) &&
+            ( xRelativeDeadline <= ( portMAX_DELAY >> 2 ) ) &&
+            ( xPeriod <= ( portMAX_DELAY >> 2 ) ) )
+        {
+            ulDensity = prvEDFDensity( xExecutionTime, xDensityDeadline );
+
+            taskENTER_CRITICAL();
+            {
+                /* If null is passed in here then it is the calling task that
+                 * is being admitted. */
+                pxTCB = prvGetTCBFromHandle( xTask );
+                configASSERT( pxTCB != NULL );
+
+                /* Admitting a task again replaces its previous reservation. */
+                ulOtherDensity = ulEDFTotalDensity - pxTCB->ulEDFDensity;
+
+                if( ulDensity <= ( taskEDF_DENSITY_BOUND - ulOtherDensity ) )
+                {
+                    ulEDFTotalDensity = ulOtherDensity + ulDensity;
+                    pxTCB->ulEDFDensity = ulDensity;
+
+                    /* The first job is released now. */
+                    prvPeriodicStart( pxTCB, xPeriod, xRelativeDeadline );
+                    pxTCB->xEDFDeadline = xTickCount + xRelativeDeadline;
+
+                    xReturn = pdPASS;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+
+            if( xReturn == pdPASS )
+            {
+                vTaskPrioritySet( xTask, ( UBaseType_t ) configEDF_PRIORITY );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskEDFAdmit( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskEDFWaitForNextPeriod( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        TickType_t xLateness;
+        BaseType_t xReturn = pdPASS;
+
+        traceENTER_xTaskEDFWaitForNextPeriod();
+
+        configASSERT( pxTCB->ulEDFDensity != 0U );
+
+        taskENTER_CRITICAL();
+        {
+            xLateness = prvPeriodicCycleComplete( pxTCB );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xLateness != ( TickType_t ) 0U )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn == pdFAIL )
+        {
+            traceTASK_EDF_DEADLINE_MISSED( pxTCB, xLateness );
+
+            #if ( configUSE_EDF_DEADLINE_MISS_HOOK == 1 )
+            {
+                vApplicationEDFDeadlineMissHook( pxTCB, xLateness );
+            }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Wait for the release of the next job, one period after the release
+         * of this one.  If that time has already passed the next job starts
+         * at once, late, rather than the task slipping off its period. */
+        ( void ) xTaskDelayUntil( &( pxTCB->xPeriodicRelease ), pxTCB->xPeriodicPeriod );
+
+        traceRETURN_xTaskEDFWaitForNextPeriod( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+    static BaseType_t prvBudgetReplenish( const TickType_t xConstTickCount )
+    {
+        TCB_t * pxTCB;
+        const ListItem_t * pxIterator;
+        const ListItem_t * const pxEndMarker = listGET_END_MARKER( &xBudgetedTaskList );
+        BaseType_t xSwitchRequired = pdFALSE;
+
+        /* Return the budget consumed one period ago.  The list holds only the
+         * tasks that have a budget, and is expected to be short. */
+        for( pxIterator = listGET_HEAD_ENTRY( &xBudgetedTaskList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+        {
+            /* MISRA Ref 11.5.3 [Void pointer assignment] */
+            /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
+            /* coverity[misra_c_2012_rule_11_5_violation] */
+            pxTCB = listGET_LIST_ITEM_OWNER( pxIterator );
+
+            /* Ticks are skipped while the tick is suppressed, so a
+             * replenishment is due once its time has been reached rather than
+             * only on that exact tick.  Replenishments are never more than a
+             * period ahead, so the comparison is safe across the tick count
+             * overflowing. */
+            while( ( pxTCB->uxBudgetReplenishCount > ( UBaseType_t ) 0U ) &&
+                   ( ( xConstTickCount - pxTCB->xBudgetReplenishTime[ pxTCB->uxBudgetReplenishHead ] ) < ( portMAX_DELAY >> 1 ) ) )
+            {
+                pxTCB->xBudgetRemaining += pxTCB->xBudgetReplenishAmount[ pxTCB->uxBudgetReplenishHead ];
+                pxTCB->uxBudgetReplenishHead = ( UBaseType_t ) ( ( pxTCB->uxBudgetReplenishHead + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_BUDGET_MAX_REPLENISHMENTS );
+                pxTCB->uxBudgetReplenishCount--;
+            }
+
+            if( ( pxTCB->xBudgetExhausted != pdFALSE ) && ( pxTCB->xBudgetRemaining > ( TickType_t ) 0U ) )
+            {
+                traceTASK_BUDGET_REPLENISHED( pxTCB );
+                pxTCB->xBudgetExhausted = pdFALSE;
+
+                if( prvSetBasePriority( pxTCB, pxTCB->uxBudgetPriority ) != pdFALSE )
+                {
+                    xSwitchRequired = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvBudgetTick( const TickType_t xConstTickCount )
+    {
+        TCB_t * pxTCB;
+        UBaseType_t uxTail;
+        BaseType_t xSwitchRequired;
+
+        xSwitchRequired = prvBudgetReplenish( xConstTickCount );
+
+        /* Charge the tick to the task that was running during it. */
+        pxTCB = pxCurrentTCB;
+
+        if( pxTCB->xBudgetPeriod != ( TickType_t ) 0U )
+        {
+            pxTCB->xBudgetConsumed++;
+
+            if( pxTCB->xBudgetExhausted == pdFALSE )
+            {
+                /* As for a sporadic server, the budget consumed by a run of
+                 * consecutive ticks is replenished one period after the run
+                 * started.  A run that continues adds to the replenishment of
+                 * its start.  When no more replenishments can be held, the
+                 * last one absorbs the new run and is delayed to fall due one
+                 * period after it, which never returns budget early. */
+                if( pxTCB->uxBudgetReplenishCount == ( UBaseType_t ) 0U )
+                {
+                    uxTail = pxTCB->uxBudgetReplenishHead;
+                    pxTCB->xBudgetReplenishTime[ uxTail ] = ( xConstTickCount - ( TickType_t ) 1U ) + pxTCB->xBudgetPeriod;
+                    pxTCB->xBudgetReplenishAmount[ uxTail ] = ( TickType_t ) 1U;
+                    pxTCB->uxBudgetReplenishCount = ( UBaseType_t ) 1U;
+                }
+                else
+                {
+                    uxTail = ( UBaseType_t ) ( ( pxTCB->uxBudgetReplenishHead + pxTCB->uxBudgetReplenishCount - ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_BUDGET_MAX_REPLENISHMENTS );
+
+                    if( pxTCB->xBudgetLastCharge == ( xConstTickCount - ( TickType_t ) 1U ) )
+                    {
+                        pxTCB->xBudgetReplenishAmount[ uxTail ]++;
+                    }
+                    else if( pxTCB->uxBudgetReplenishCount < ( UBaseType_t ) configTASK_BUDGET_MAX_REPLENISHMENTS )
+                    {
+                        uxTail = ( UBaseType_t ) ( ( uxTail + ( UBaseType_t ) 1U ) % ( UBaseType_t ) configTASK_BUDGET_MAX_REPLENISHMENTS );
+                        pxTCB->xBudgetReplenishTime[ uxTail ] = ( xConstTickCount - ( TickType_t ) 1U ) + pxTCB->xBudgetPeriod;
+                        pxTCB->xBudgetReplenishAmount[ uxTail ] = ( TickType_t ) 1U;
+                        pxTCB->uxBudgetReplenishCount++;
+                    }
+                    else
+                    {
+                        pxTCB->xBudgetReplenishTime[ uxTail ] = ( xConstTickCount - ( TickType_t ) 1U ) + pxTCB->xBudgetPeriod;
+                        pxTCB->xBudgetReplenishAmount[ uxTail ]++;
+                    }
+                }
+
+                pxTCB->xBudgetLastCharge = xConstTickCount;
+                pxTCB->xBudgetRemaining--;
+
+                if( pxTCB->xBudgetRemaining == ( TickType_t ) 0U )
+                {
+                    traceTASK_BUDGET_EXHAUSTED( pxTCB );
+                    pxTCB->xBudgetExhausted = pdTRUE;
+                    pxTCB->uxBudgetExhaustions++;
+
+                    if( prvSetBasePriority( pxTCB, pxTCB->uxBudgetLowPriority ) != pdFALSE )
+                    {
+                        xSwitchRequired = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xSwitchRequired;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskSetBudget( TaskHandle_t xTask,
+                         TickType_t xBudget,
+                         TickType_t xPeriod,
+                         UBaseType_t uxLowPriority )
+    {
+        TCB_t * pxTCB;
+        BaseType_t xYieldRequired = pdFALSE;
+
+        traceENTER_vTaskSetBudget( xTask, xBudget, xPeriod, uxLowPriority );
+
+        configASSERT( xBudget <= xPeriod );
+        configASSERT( uxLowPriority < ( UBaseType_t ) configMAX_PRIORITIES );
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the calling task that is
+             * having its budget set. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            /* A task whose budget is exhausted is restored to its priority
+             * before the budget is replaced. */
+            if( pxTCB->xBudgetExhausted != pdFALSE )
+            {
+                pxTCB->xBudgetExhausted = pdFALSE;
+                xYieldRequired = prvSetBasePriority( pxTCB, pxTCB->uxBudgetPriority );
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
 
-                    if( xOutputBufferFull == pdTRUE )
-                    {
-                        break;
-                    }
+            if( ( xBudget > ( TickType_t ) 0U ) && ( xPeriod > ( TickType_t ) 0U ) )
+            {
+                #if ( configUSE_MUTEXES == 1 )
+                {
+                    pxTCB->uxBudgetPriority = pxTCB->uxBasePriority;
+                }
+                #else
+                {
+                    pxTCB->uxBudgetPriority = pxTCB->uxPriority;
+                }
+                #endif
+
+                configASSERT( uxLowPriority < pxTCB->uxBudgetPriority );
+
+                pxTCB->xBudget = xBudget;
+                pxTCB->xBudgetPeriod = xPeriod;
+                pxTCB->xBudgetRemaining = xBudget;
+                pxTCB->xBudgetConsumed = ( TickType_t ) 0U;
+                pxTCB->uxBudgetReplenishCount = ( UBaseType_t ) 0U;
+                pxTCB->uxBudgetLowPriority = uxLowPriority;
+                pxTCB->uxBudgetExhaustions = ( UBaseType_t ) 0U;
+
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) == NULL )
+                {
+                    vListInsertEnd( &xBudgetedTaskList, &( pxTCB->xBudgetListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
                 }
             }
             else
             {
-                mtCOVERAGE_TEST_MARKER();
+                /* Remove the budget. */
+                pxTCB->xBudget = ( TickType_t ) 0U;
+                pxTCB->xBudgetPeriod = ( TickType_t ) 0U;
+
+                if( listLIST_ITEM_CONTAINER( &( pxTCB->xBudgetListItem ) ) != NULL )
+                {
+                    ( void ) uxListRemove( &( pxTCB->xBudgetListItem ) );
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
             }
+        }
+        taskEXIT_CRITICAL();
 
-            /* Free the array again.  NOTE!  If configSUPPORT_DYNAMIC_ALLOCATION
-             * is 0 then vPortFree() will be #defined to nothing. */
-            vPortFree( pxTaskStatusArray );
+        if( xYieldRequired != pdFALSE )
+        {
+            taskYIELD_TASK_CORE_IF_USING_PREEMPTION( pxTCB );
         }
         else
         {
             mtCOVERAGE_TEST_MARKER();
         }
 
-        traceRETURN_vTaskGetRunTimeStatistics();
+        traceRETURN_vTaskSetBudget();
     }
+/*-----------------------------------------------------------*/
 
-#endif /* ( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) ) */
+    void vTaskGetBudgetStatus( TaskHandle_t xTask,
+                               TaskBudgetStatus_t * pxBudgetStatus )
+    {
+        TCB_t * pxTCB;
+
+        traceENTER_vTaskGetBudgetStatus( xTask, pxBudgetStatus );
+
+        configASSERT( pxBudgetStatus );
+
+        taskENTER_CRITICAL();
+        {
+            /* If null is passed in here then it is the calling task that is
+             * being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
+
+            pxBudgetStatus->xBudget = pxTCB->xBudget;
+            pxBudgetStatus->xPeriod = pxTCB->xBudgetPeriod;
+            pxBudgetStatus->xRemaining = pxTCB->xBudgetRemaining;
+            pxBudgetStatus->xConsumed = pxTCB->xBudgetConsumed;
+            pxBudgetStatus->uxExhaustions = pxTCB->uxBudgetExhaustions;
+            pxBudgetStatus->xExhausted = pxTCB->xBudgetExhausted;
+
+            #if ( configGENERATE_RUN_TIME_STATS == 1 )
+            {
+                pxBudgetStatus->ulRunTimeCounter = pxTCB->ulRunTimeCounter;
+            }
+            #else
+            {
+                pxBudgetStatus->ulRunTimeCounter = ( configRUN_TIME_COUNTER_TYPE ) 0U;
+            }
+            #endif
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetBudgetStatus();
+    }
+
+#endif /* configUSE_TASK_BUDGETS */
 /*-----------------------------------------------------------*/
 
-TickType_t uxTaskResetEventItemValue( void )
-{
-    TickType_t uxReturn;
+#if ( configUSE_PERIODIC_TASKS == 1 )
 
-    traceENTER_uxTaskResetEventItemValue();
+    void vTaskPeriodicStart( TickType_t xPeriod,
+                             TickType_t xDeadline )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
 
-    uxReturn = listGET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ) );
+        traceENTER_vTaskPeriodicStart( xPeriod, xDeadline );
 
-    /* Reset the event list item to its normal value - so it can be used with
-     * queues and semaphores. */
-    listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxCurrentTCB->uxPriority ) );
+        configASSERT( xPeriod > ( TickType_t ) 0U );
 
-    traceRETURN_uxTaskResetEventItemValue( uxReturn );
+        #if ( configUSE_EDF_SCHEDULING == 1 )
+        {
+            /* The period and deadline of an EDF task are set when it is
+             * admitted. */
+            configASSERT( pxTCB->ulEDFDensity == 0U );
+        }
+        #endif
 
-    return uxReturn;
-}
+        if( xDeadline == ( TickType_t ) 0U )
+        {
+            xDeadline = xPeriod;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        taskENTER_CRITICAL();
+        {
+            prvPeriodicStart( pxTCB, xPeriod, xDeadline );
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskPeriodicStart();
+    }
 /*-----------------------------------------------------------*/
 
-#if ( configUSE_MUTEXES == 1 )
+    BaseType_t xTaskPeriodicWait( void )
+    {
+        TCB_t * const pxTCB = pxCurrentTCB;
+        TickType_t xLateness;
+        BaseType_t xReturn = pdPASS;
 
-    TaskHandle_t pvTaskIncrementMutexHeldCount( void )
+        traceENTER_xTaskPeriodicWait();
+
+        configASSERT( pxTCB->xPeriodicPeriod != ( TickType_t ) 0U );
+
+        taskENTER_CRITICAL();
+        {
+            xLateness = prvPeriodicCycleComplete( pxTCB );
+        }
+        taskEXIT_CRITICAL();
+
+        if( xLateness != ( TickType_t ) 0U )
+        {
+            xReturn = pdFAIL;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        if( xReturn == pdFAIL )
+        {
+            traceTASK_PERIODIC_DEADLINE_MISSED( pxTCB, xLateness );
+
+            #if ( configUSE_PERIODIC_TASK_OVERRUN_HOOK == 1 )
+            {
+                vApplicationPeriodicTaskOverrunHook( pxTCB, xLateness );
+            }
+            #endif
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* Wait for the release of the next cycle, one period after the release
+         * of this one.  A cycle that overran does not shift the releases that
+         * follow it, so the cycles after it are measured against the times
+         * they should have been released. */
+        ( void ) xTaskDelayUntil( &( pxTCB->xPeriodicRelease ), pxTCB->xPeriodicPeriod );
+
+        traceRETURN_xTaskPeriodicWait( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vTaskGetPeriodicStatus( TaskHandle_t xTask,
+                                 TaskPeriodicStatus_t * pxPeriodicStatus )
     {
         TCB_t * pxTCB;
+        UBaseType_t uxBucket;
 
-        traceENTER_pvTaskIncrementMutexHeldCount();
+        traceENTER_vTaskGetPeriodicStatus( xTask, pxPeriodicStatus );
 
-        pxTCB = pxCurrentTCB;
+        configASSERT( pxPeriodicStatus );
 
-        /* If xSemaphoreCreateMutex() is called before any tasks have been created
-         * then pxCurrentTCB will be NULL. */
-        if( pxTCB != NULL )
+        taskENTER_CRITICAL();
         {
-            ( pxTCB->uxMutexesHeld )++;
-        }
+            /* If null is passed in here then it is the calling task that is
+             * being queried. */
+            pxTCB = prvGetTCBFromHandle( xTask );
+            configASSERT( pxTCB != NULL );
 
-        traceRETURN_pvTaskIncrementMutexHeldCount( pxTCB );
+            pxPeriodicStatus->xPeriod = pxTCB->xPeriodicPeriod;
+            pxPeriodicStatus->xDeadline = pxTCB->xPeriodicDeadline;
+            pxPeriodicStatus->xMaxResponseTime = pxTCB->xPeriodicMaxResponseTime;
+            pxPeriodicStatus->xMaxLateness = pxTCB->xPeriodicMaxLateness;
+            pxPeriodicStatus->ulCycles = pxTCB->ulPeriodicCycles;
+            pxPeriodicStatus->ulDeadlineMisses = pxTCB->ulPeriodicDeadlineMisses;
+            pxPeriodicStatus->ulOverruns = pxTCB->ulPeriodicOverruns;
 
-        return pxTCB;
+            for( uxBucket = ( UBaseType_t ) 0U; uxBucket < ( UBaseType_t ) configPERIODIC_TASK_HISTOGRAM_BUCKETS; uxBucket++ )
+            {
+                pxPeriodicStatus->ulHistogram[ uxBucket ] = pxTCB->ulPeriodicHistogram[ uxBucket ];
+            }
+        }
+        taskEXIT_CRITICAL();
+
+        traceRETURN_vTaskGetPeriodicStatus();
     }
 
-#endif /* configUSE_MUTEXES */
+#endif /* configUSE_PERIODIC_TASKS */
 /*-----------------------------------------------------------*/
 
 #if ( configUSE_TASK_NOTIFICATIONS == 1 )
@@ -7995,8 +9940,24 @@ TickType_t uxTaskResetEventItemValue( void )
                 listREMOVE_ITEM( &( pxTCB->xStateListItem ) );
                 prvAddTaskToReadyList( pxTCB );
 
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    /* A task waiting in pxWaitAny() is also on an event list. */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else
+                {
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                }
+                #endif /* configUSE_WAIT_ANY */
 
                 #if ( configUSE_TICKLESS_IDLE != 0 )
                 {
@@ -8134,8 +10095,27 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    /* A task waiting in pxWaitAny() is also on an event list,
+                     * or on the pending ready list if it was unblocked by one
+                     * of the objects it was waiting on while the scheduler was
+                     * suspended. */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else
+                {
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                }
+                #endif /* configUSE_WAIT_ANY */
 
                 if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
                 {
@@ -8167,7 +10147,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8268,8 +10248,27 @@ TickType_t uxTaskResetEventItemValue( void )
              * notification then unblock it now. */
             if( ucOriginalNotifyState == taskWAITING_NOTIFICATION )
             {
-                /* The task should not have been on an event list. */
-                configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                #if ( configUSE_WAIT_ANY == 1 )
+                {
+                    /* A task waiting in pxWaitAny() is also on an event list,
+                     * or on the pending ready list if it was unblocked by one
+                     * of the objects it was waiting on while the scheduler was
+                     * suspended. */
+                    if( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) != NULL )
+                    {
+                        listREMOVE_ITEM( &( pxTCB->xEventListItem ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                #else
+                {
+                    /* The task should not have been on an event list. */
+                    configASSERT( listLIST_ITEM_CONTAINER( &( pxTCB->xEventListItem ) ) == NULL );
+                }
+                #endif /* configUSE_WAIT_ANY */
 
                 if( uxSchedulerSuspended == ( UBaseType_t ) 0U )
                 {
@@ -8301,7 +10300,7 @@ TickType_t uxTaskResetEventItemValue( void )
 
                 #if ( configNUMBER_OF_CORES == 1 )
                 {
-                    if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+                    if( taskTASK_PREEMPTS_CURRENT( pxTCB ) )
                     {
                         /* The notified task has a priority above the currently
                          * executing task so a yield is required. */
@@ -8421,6 +10420,65 @@ TickType_t uxTaskResetEventItemValue( void )
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if ( ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( configUSE_WAIT_ANY == 1 ) )
+
+    BaseType_t xTaskAddNotificationToWaitAny( UBaseType_t uxIndexToWaitOn )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xTaskAddNotificationToWaitAny( uxIndexToWaitOn );
+
+        configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        /* Called from a critical section.  A task that is waiting for a
+         * notification is unblocked by xTaskGenericNotify() and its FromISR
+         * variants even though it is also on the event list of pxWaitAny(). */
+        if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] == taskNOTIFICATION_RECEIVED )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskWAITING_NOTIFICATION;
+            xReturn = pdFALSE;
+        }
+
+        traceRETURN_xTaskAddNotificationToWaitAny( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xTaskRemoveNotificationFromWaitAny( UBaseType_t uxIndexToWaitOn )
+    {
+        BaseType_t xReturn = pdFALSE;
+
+        traceENTER_xTaskRemoveNotificationFromWaitAny( uxIndexToWaitOn );
+
+        configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+        /* The notification itself is left pending to be read by the task. */
+        if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] == taskWAITING_NOTIFICATION )
+        {
+            pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] = taskNOT_WAITING_NOTIFICATION;
+        }
+        else if( pxCurrentTCB->ucNotifyState[ uxIndexToWaitOn ] == taskNOTIFICATION_RECEIVED )
+        {
+            xReturn = pdTRUE;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        traceRETURN_xTaskRemoveNotificationFromWaitAny( xReturn );
+
+        return xReturn;
+    }
+
+#endif /* ( configUSE_TASK_NOTIFICATIONS == 1 ) && ( configUSE_WAIT_ANY == 1 ) */
+/*-----------------------------------------------------------*/
+
 #if ( configGENERATE_RUN_TIME_STATS == 1 )
 
     configRUN_TIME_COUNTER_TYPE ulTaskGetRunTimeCounter( const TaskHandle_t xTask )
@@ -8851,6 +10909,12 @@ void vTaskResetState( void )
     for( xCoreID = 0; xCoreID < configNUMBER_OF_CORES; xCoreID++ )
     {
         xYieldPendings[ xCoreID ] = pdFALSE;
+
+        #if ( configUSE_PER_CORE_READY_LISTS == 1 )
+        {
+            uxCoreTopReadyPriority[ xCoreID ] = tskIDLE_PRIORITY;
+        }
+        #endif
     }
 
     xNumOfOverflows = ( BaseType_t ) 0;
@@ -8868,5 +10932,12 @@ void vTaskResetState( void )
         }
     }
     #endif /* #if ( configGENERATE_RUN_TIME_STATS == 1 ) */
+
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTASK_ARENA_SIZE > 0 ) )
+    {
+        xTaskArena.uxNextUnused = ( UBaseType_t ) 0U;
+        xTaskArena.pvFreeList = NULL;
+    }
+    #endif /* #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTASK_ARENA_SIZE > 0 ) ) */
 }
 /*-----------------------------------------------------------*/
@@ -149,6 +149,20 @@
     PRIVILEGED_DATA static QueueHandle_t xTimerQueue = NULL;
     PRIVILEGED_DATA static TaskHandle_t xTimerTaskHandle = NULL;
 
+    #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTIMER_ARENA_SIZE > 0 ) )
+
+/* Dynamically created timers are taken from this arena, and only from the heap
+ * once it is exhausted. */
+        PRIVILEGED_DATA static Timer_t xTimerArenaStorage[ configTIMER_ARENA_SIZE ];
+        PRIVILEGED_DATA static KernelObjectArena_t xTimerArena = { xTimerArenaStorage, sizeof( Timer_t ), ( UBaseType_t ) configTIMER_ARENA_SIZE, ( UBaseType_t ) 0U, NULL };
+
+        #define tmrALLOCATE_TIMER()         ( ( Timer_t * ) pvTaskAllocateKernelObject( &xTimerArena ) )
+        #define tmrFREE_TIMER( pxTimer )    vTaskFreeKernelObject( &xTimerArena, ( pxTimer ) )
+    #else
+        #define tmrALLOCATE_TIMER()         ( ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) ) )
+        #define tmrFREE_TIMER( pxTimer )    vPortFree( pxTimer )
+    #endif
+
 /*-----------------------------------------------------------*/
 
 /*
@@ -346,7 +360,7 @@
             /* MISRA Ref 11.5.1 [Malloc memory assignment] */
             /* More details at: https://github.com/FreeRTOS/FreeRTOS-Kernel/blob/main/MISRA.md#rule-115 */
             /* coverity[misra_c_2012_rule_11_5_violation] */
-            pxNewTimer = ( Timer_t * ) pvPortMalloc( sizeof( Timer_t ) );
+            pxNewTimer = tmrALLOCATE_TIMER();
 
             if( pxNewTimer != NULL )
             {
@@ -1054,7 +1068,7 @@
                                  * allocated. */
                                 if( ( pxTimer->ucStatus & tmrSTATUS_IS_STATICALLY_ALLOCATED ) == ( uint8_t ) 0 )
                                 {
-                                    vPortFree( pxTimer );
+                                    tmrFREE_TIMER( pxTimer );
                                 }
                                 else
                                 {
@@ -1334,6 +1348,13 @@
     {
         xTimerQueue = NULL;
         xTimerTaskHandle = NULL;
+
+        #if ( ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) && ( configTIMER_ARENA_SIZE > 0 ) )
+        {
+            xTimerArena.uxNextUnused = ( UBaseType_t ) 0U;
+            xTimerArena.pvFreeList = NULL;
+        }
+        #endif
     }
 /*-----------------------------------------------------------*/
 
@@ -0,0 +1,499 @@
+/*
+ * FreeRTOS Kernel V11.3.0
+ * Copyright (C) 2021 Amazon.com, Inc. or its affiliates. All Rights Reserved.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * https://www.FreeRTOS.org
+ * https://github.com/FreeRTOS
+ *
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+ * all the API functions to use the MPU wrappers. That should only be done when
+ * task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "wait_any.h"
+
+/* The MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
+ * for the header files above, but not in this file, in order to generate the
+ * correct privileged Vs unprivileged linkage and placement. */
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+ * to include wait-any functionality. This #if is closed at the very bottom of
+ * this file. If you want to include wait-any functionality then ensure
+ * configUSE_WAIT_ANY is set to 1 in FreeRTOSConfig.h. */
+#if ( configUSE_WAIT_ANY == 1 )
+
+/*
+ * Links pxObject into the object it describes on behalf of pxContext, and
+ * records pxObject in pxContext if the object is already ready.  Returns pdTRUE
+ * if the object is already ready.  Must be called from a critical section.
+ */
+    static BaseType_t prvAddObject( WaitAnyContext_t * const pxContext,
+                                    WaitAnyObject_t * const pxObject ) PRIVILEGED_FUNCTION;
+
+/*
+ * Unlinks pxObject from the object it describes, and records pxObject in
+ * pxContext if it is a task notification that is pending.  Must be called from
+ * a critical section.
+ */
+    static void prvRemoveObject( WaitAnyContext_t * const pxContext,
+                                 WaitAnyObject_t * const pxObject ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+    void vWaitAnySetQueue( WaitAnyObject_t * pxObject,
+                           QueueHandle_t xQueue )
+    {
+        traceENTER_vWaitAnySetQueue( pxObject, xQueue );
+
+        configASSERT( pxObject );
+        configASSERT( xQueue );
+
+        pxObject->pvObject = xQueue;
+        pxObject->uxBitsToWaitFor = ( EventBits_t ) 0;
+        pxObject->uxIndexToWaitOn = ( UBaseType_t ) 0U;
+        pxObject->pxNext = NULL;
+        pxObject->pxContext = NULL;
+        pxObject->ucObjectType = waitanyOBJECT_TYPE_QUEUE;
+
+        traceRETURN_vWaitAnySetQueue();
+    }
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_EVENT_GROUPS == 1 )
+
+        void vWaitAnySetEventGroup( WaitAnyObject_t * pxObject,
+                                    EventGroupHandle_t xEventGroup,
+                                    EventBits_t uxBitsToWaitFor )
+        {
+            traceENTER_vWaitAnySetEventGroup( pxObject, xEventGroup, uxBitsToWaitFor );
+
+            configASSERT( pxObject );
+            configASSERT( xEventGroup );
+            configASSERT( uxBitsToWaitFor != ( EventBits_t ) 0 );
+
+            pxObject->pvObject = xEventGroup;
+            pxObject->uxBitsToWaitFor = uxBitsToWaitFor;
+            pxObject->uxIndexToWaitOn = ( UBaseType_t ) 0U;
+            pxObject->pxNext = NULL;
+            pxObject->pxContext = NULL;
+            pxObject->ucObjectType = waitanyOBJECT_TYPE_EVENT_GROUP;
+
+            traceRETURN_vWaitAnySetEventGroup();
+        }
+
+    #endif /* configUSE_EVENT_GROUPS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_STREAM_BUFFERS == 1 )
+
+        void vWaitAnySetStreamBuffer( WaitAnyObject_t * pxObject,
+                                      StreamBufferHandle_t xStreamBuffer )
+        {
+            traceENTER_vWaitAnySetStreamBuffer( pxObject, xStreamBuffer );
+
+            configASSERT( pxObject );
+            configASSERT( xStreamBuffer );
+
+            pxObject->pvObject = xStreamBuffer;
+            pxObject->uxBitsToWaitFor = ( EventBits_t ) 0;
+            pxObject->uxIndexToWaitOn = ( UBaseType_t ) 0U;
+            pxObject->pxNext = NULL;
+            pxObject->pxContext = NULL;
+            pxObject->ucObjectType = waitanyOBJECT_TYPE_STREAM_BUFFER;
+
+            traceRETURN_vWaitAnySetStreamBuffer();
+        }
+
+    #endif /* configUSE_STREAM_BUFFERS */
+/*-----------------------------------------------------------*/
+
+    #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+
+        void vWaitAnySetNotification( WaitAnyObject_t * pxObject,
+                                      UBaseType_t uxIndexToWaitOn )
+        {
+            traceENTER_vWaitAnySetNotification( pxObject, uxIndexToWaitOn );
+
+            configASSERT( pxObject );
+            configASSERT( uxIndexToWaitOn < configTASK_NOTIFICATION_ARRAY_ENTRIES );
+
+            pxObject->pvObject = NULL;
+            pxObject->uxBitsToWaitFor = ( EventBits_t ) 0;
+            pxObject->uxIndexToWaitOn = uxIndexToWaitOn;
+            pxObject->pxNext = NULL;
+            pxObject->pxContext = NULL;
+            pxObject->ucObjectType = waitanyOBJECT_TYPE_NOTIFICATION;
+
+            traceRETURN_vWaitAnySetNotification();
+        }
+
+    #endif /* configUSE_TASK_NOTIFICATIONS */
+/*-----------------------------------------------------------*/
+
+    WaitAnyObject_t * pxWaitAny( WaitAnyObject_t * pxObjects,
+                                 UBaseType_t uxObjectCount,
+                                 TickType_t xTicksToWait )
+    {
+        WaitAnyContext_t xContext;
+        WaitAnyObject_t * pxReturn;
+        UBaseType_t uxObject;
+        BaseType_t xShouldBlock = pdFALSE;
+        BaseType_t xAlreadyYielded;
+
+        traceENTER_pxWaitAny( pxObjects, uxObjectCount, xTicksToWait );
+
+        configASSERT( pxObjects );
+        configASSERT( uxObjectCount > ( UBaseType_t ) 0U );
+
+        #if ( ( INCLUDE_xTaskGetSchedulerState == 1 ) || ( configUSE_TIMERS == 1 ) )
+        {
+            configASSERT( !( ( xTaskGetSchedulerState() == taskSCHEDULER_SUSPENDED ) && ( xTicksToWait != 0 ) ) );
+        }
+        #endif
+
+        vListInitialise( &( xContext.xTaskWaiting ) );
+        xContext.pxReady = NULL;
+        xContext.pxReadyFunction = NULL;
+
+        /* Link the objects in one at a time, so interrupts are not held off
+         * for the whole array, and stop as soon as one is ready.  Checking
+         * whether an object is ready and linking it in is atomic, so an object
+         * that becomes ready after it is checked records itself in
+         * xContext.pxReady. */
+        for( uxObject = ( UBaseType_t ) 0U; ( uxObject < uxObjectCount ) && ( xContext.pxReady == NULL ); uxObject++ )
+        {
+            if( pxObjects[ uxObject ].ucObjectType != waitanyOBJECT_TYPE_NOTIFICATION )
+            {
+                taskENTER_CRITICAL();
+                {
+                    ( void ) prvAddObject( &xContext, &( pxObjects[ uxObject ] ) );
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        /* A notification unblocks the task directly rather than through
+         * xContext, so notifications are only marked as waited for once the
+         * task is about to join xContext.xTaskWaiting, and from the same
+         * critical section. */
+        vTaskSuspendAll();
+        {
+            taskENTER_CRITICAL();
+            {
+                for( uxObject = ( UBaseType_t ) 0U; ( uxObject < uxObjectCount ) && ( xContext.pxReady == NULL ); uxObject++ )
+                {
+                    if( pxObjects[ uxObject ].ucObjectType == waitanyOBJECT_TYPE_NOTIFICATION )
+                    {
+                        ( void ) prvAddObject( &xContext, &( pxObjects[ uxObject ] ) );
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+
+                if( ( xContext.pxReady == NULL ) && ( xTicksToWait != ( TickType_t ) 0 ) )
+                {
+                    traceBLOCKING_ON_WAIT_ANY( pxObjects, uxObjectCount );
+                    vTaskPlaceOnEventList( &( xContext.xTaskWaiting ), xTicksToWait );
+                    xShouldBlock = pdTRUE;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            taskEXIT_CRITICAL();
+        }
+        xAlreadyYielded = xTaskResumeAll();
+
+        if( ( xShouldBlock != pdFALSE ) && ( xAlreadyYielded == pdFALSE ) )
+        {
+            taskYIELD_WITHIN_API();
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        /* The task was unblocked by an object becoming ready, by a
+         * notification, or by xTicksToWait expiring.  Unlink all the objects
+         * that were linked in before returning, as xContext is about to go out
+         * of scope. */
+        for( uxObject = ( UBaseType_t ) 0U; uxObject < uxObjectCount; uxObject++ )
+        {
+            if( pxObjects[ uxObject ].pxContext != NULL )
+            {
+                taskENTER_CRITICAL();
+                {
+                    prvRemoveObject( &xContext, &( pxObjects[ uxObject ] ) );
+                }
+                taskEXIT_CRITICAL();
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        pxReturn = xContext.pxReady;
+
+        traceRETURN_pxWaitAny( pxReturn );
+
+        return pxReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xWaitAnyNotifyReady( WaitAnyObject_t * pxObjects,
+                                    EventBits_t uxEventBits )
+    {
+        WaitAnyObject_t * pxObject;
+        WaitAnyContext_t * pxContext;
+        BaseType_t xReturn = pdFALSE;
+
+        for( pxObject = pxObjects; pxObject != NULL; pxObject = pxObject->pxNext )
+        {
+            if( ( pxObject->ucObjectType != waitanyOBJECT_TYPE_EVENT_GROUP ) ||
+                ( ( pxObject->uxBitsToWaitFor & uxEventBits ) != ( EventBits_t ) 0 ) )
+            {
+                pxContext = pxObject->pxContext;
+
+                if( pxContext->pxReadyFunction != NULL )
+                {
+                    pxContext->pxReadyFunction( pxObject );
+                }
+                else if( pxContext->pxReady == NULL )
+                {
+                    pxContext->pxReady = pxObject;
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+
+                if( listLIST_IS_EMPTY( &( pxContext->xTaskWaiting ) ) == pdFALSE )
+                {
+                    if( xTaskRemoveFromEventList( &( pxContext->xTaskWaiting ) ) != pdFALSE )
+                    {
+                        xReturn = pdTRUE;
+                    }
+                    else
+                    {
+                        mtCOVERAGE_TEST_MARKER();
+                    }
+                }
+                else
+                {
+                    mtCOVERAGE_TEST_MARKER();
+                }
+            }
+            else
+            {
+                mtCOVERAGE_TEST_MARKER();
+            }
+        }
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    BaseType_t xWaitAnyAddObject( WaitAnyContext_t * pxContext,
+                                  WaitAnyObject_t * pxObject )
+    {
+        BaseType_t xReturn;
+
+        traceENTER_xWaitAnyAddObject( pxContext, pxObject );
+
+        configASSERT( pxContext );
+        configASSERT( pxObject );
+        configASSERT( pxObject->ucObjectType != waitanyOBJECT_TYPE_NOTIFICATION );
+
+        xReturn = prvAddObject( pxContext, pxObject );
+
+        traceRETURN_xWaitAnyAddObject( xReturn );
+
+        return xReturn;
+    }
+/*-----------------------------------------------------------*/
+
+    void vWaitAnyRemoveObject( WaitAnyContext_t * pxContext,
+                               WaitAnyObject_t * pxObject )
+    {
+        traceENTER_vWaitAnyRemoveObject( pxContext, pxObject );
+
+        configASSERT( pxContext );
+        configASSERT( pxObject );
+        configASSERT( pxObject->pxContext == pxContext );
+
+        prvRemoveObject( pxContext, pxObject );
+
+        traceRETURN_vWaitAnyRemoveObject();
+    }
+/*-----------------------------------------------------------*/
+
+    void vWaitAnyLinkObject( WaitAnyObject_t ** ppxList,
+                             WaitAnyObject_t * pxObject )
+    {
+        pxObject->pxNext = *ppxList;
+        *ppxList = pxObject;
+    }
+/*-----------------------------------------------------------*/
+
+    void vWaitAnyUnlinkObject( WaitAnyObject_t ** ppxList,
+                               WaitAnyObject_t * pxObject )
+    {
+        WaitAnyObject_t ** ppxLink = ppxList;
+
+        /* The list only holds one structure for each task waiting on the
+         * object, so is normally very short. */
+        while( ( *ppxLink != NULL ) && ( *ppxLink != pxObject ) )
+        {
+            ppxLink = &( ( *ppxLink )->pxNext );
+        }
+
+        if( *ppxLink != NULL )
+        {
+            *ppxLink = pxObject->pxNext;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxObject->pxNext = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+    static BaseType_t prvAddObject( WaitAnyContext_t * const pxContext,
+                                    WaitAnyObject_t * const pxObject )
+    {
+        BaseType_t xReady = pdFALSE;
+
+        pxObject->pxContext = pxContext;
+
+        switch( pxObject->ucObjectType )
+        {
+            case waitanyOBJECT_TYPE_QUEUE:
+                xReady = xQueueAddToWaitAny( pxObject->pvObject, pxObject );
+                break;
+
+            #if ( configUSE_EVENT_GROUPS == 1 )
+                case waitanyOBJECT_TYPE_EVENT_GROUP:
+                    xReady = xEventGroupAddToWaitAny( pxObject->pvObject, pxObject );
+                    break;
+            #endif
+
+            #if ( configUSE_STREAM_BUFFERS == 1 )
+                case waitanyOBJECT_TYPE_STREAM_BUFFER:
+                    xReady = xStreamBufferAddToWaitAny( pxObject->pvObject, pxObject );
+                    break;
+            #endif
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                case waitanyOBJECT_TYPE_NOTIFICATION:
+                    xReady = xTaskAddNotificationToWaitAny( pxObject->uxIndexToWaitOn );
+                    break;
+            #endif
+
+            default:
+
+                /* The structure was not set with one of the vWaitAnySet...()
+                 * functions. */
+                configASSERT( pdFALSE );
+                break;
+        }
+
+        if( ( xReady != pdFALSE ) && ( pxContext->pxReady == NULL ) )
+        {
+            pxContext->pxReady = pxObject;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        return xReady;
+    }
+/*-----------------------------------------------------------*/
+
+    static void prvRemoveObject( WaitAnyContext_t * const pxContext,
+                                 WaitAnyObject_t * const pxObject )
+    {
+        BaseType_t xReady = pdFALSE;
+
+        switch( pxObject->ucObjectType )
+        {
+            case waitanyOBJECT_TYPE_QUEUE:
+                vQueueRemoveFromWaitAny( pxObject->pvObject, pxObject );
+                break;
+
+            #if ( configUSE_EVENT_GROUPS == 1 )
+                case waitanyOBJECT_TYPE_EVENT_GROUP:
+                    vEventGroupRemoveFromWaitAny( pxObject->pvObject, pxObject );
+                    break;
+            #endif
+
+            #if ( configUSE_STREAM_BUFFERS == 1 )
+                case waitanyOBJECT_TYPE_STREAM_BUFFER:
+                    vStreamBufferRemoveFromWaitAny( pxObject->pvObject, pxObject );
+                    break;
+            #endif
+
+            #if ( configUSE_TASK_NOTIFICATIONS == 1 )
+                case waitanyOBJECT_TYPE_NOTIFICATION:
+                    xReady = xTaskRemoveNotificationFromWaitAny( pxObject->uxIndexToWaitOn );
+                    break;
+            #endif
+
+            default:
+                configASSERT( pdFALSE );
+                break;
+        }
+
+        if( ( xReady != pdFALSE ) && ( pxContext->pxReady == NULL ) )
+        {
+            pxContext->pxReady = pxObject;
+        }
+        else
+        {
+            mtCOVERAGE_TEST_MARKER();
+        }
+
+        pxObject->pxContext = NULL;
+    }
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+ * to include wait-any functionality. If you want to include wait-any
+ * functionality then ensure configUSE_WAIT_ANY is set to 1 in
+ * FreeRTOSConfig.h. */
+#endif /* configUSE_WAIT_ANY == 1 */